@@ -363,16 +363,38 @@ function(spark_add_test_executable target)
     endif()
 endfunction()
 
+#########
+# Helper function that adds a benchmark executable
+# spark_add_benchmark_executable(
+#   target
+#   [EXCLUDE_FROM_ALL]
+#   [CXX_SOURCES <cxx_source_list>]
+#   [PUBLIC_HEADERS <public_header_list>]
+#   [PRIVATE_HEADERS <private_header_list>]
+# )
+# Benchmarks are not added to CTest, they must be run manually.
+#########
+function(spark_add_benchmark_executable target)
+    spark_add_executable(${target}
+        NO_INSTALL
+        ${ARGN}
+    )
+
+    # Put into a "benchmarks" folder in IDE
+    spark_target_folder_property(${target} IS_BENCHMARK)
+endfunction()
+
 #########
 # Set the FOLDER property of a target.
 # Folder tree is based on source directory tree.
 #
-# spark_target_folder_property(target [IS_TEST])
+# spark_target_folder_property(target [IS_TEST] [IS_BENCHMARK])
 # IS_TEST option put the target into a "tests" folder instead of the final folder.
+# IS_BENCHMARK option put the target into a "benchmarks" folder instead of the final folder.
 #########
 function(spark_target_folder_property folder_target)
     # Define the supported set of keywords
-    set(options IS_TEST)
+    set(options IS_TEST IS_BENCHMARK)
     set(one_value_keywords "")
     set(multi_value_keywords "")
 
@@ -389,6 +411,9 @@ function(spark_target_folder_property folder_target)
     if (FOLDER_IS_TEST)
         cmake_path(GET VAR_FOLDER PARENT_PATH VAR_FOLDER)
         cmake_path(APPEND VAR_FOLDER "tests")
+    elseif (FOLDER_IS_BENCHMARK)
+        cmake_path(GET VAR_FOLDER PARENT_PATH VAR_FOLDER)
+        cmake_path(APPEND VAR_FOLDER "benchmarks")
     endif()
     set_property(TARGET ${folder_target} PROPERTY FOLDER ${VAR_FOLDER})
 endfunction()
@@ -12,10 +12,14 @@ namespace boids
 {
     /**
      * \brief A simple bird contained in the boids simulation.
+     *
+     * Birds are updated in parallel. To avoid reading neighbours while they move, a bird only reads their state published by \ref publishState
+     * at the end of the previous frame.
      */
     class Bird final : public spark::core::GameObject
     {
         DECLARE_SPARK_RTTI(Bird, GameObject)
+        SPARK_THREAD_SAFE_UPDATE
 
     public:
         spark::patterns::Signal<Bird*, std::size_t> onCellChanged;
@@ -41,6 +45,13 @@ namespace boids
          */
         [[nodiscard]] std::size_t cell() const;
 
+        /**
+         * \brief Publishes the current position and direction of the bird, to be read by other birds on the next update.
+         *
+         * \note Must not be called while birds are updated.
+         */
+        void publishState();
+
         /// \copydoc GameObject::onUpdate
         void onUpdate(float dt) override;
 
@@ -54,6 +65,8 @@ namespace boids
         const SimulationData* m_simulationSettings = nullptr;
         std::function<std::list<Bird*>(std::size_t)> m_birdsInCellFn;
         spark::math::Vector2<float> m_direction = {0, 0};
+        spark::math::Vector2<float> m_publishedPosition = {0, 0};
+        spark::math::Vector2<float> m_publishedDirection = {0, 0};
         std::size_t m_cellCount = 100;
         std::size_t m_currentCellId = 0;
     };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "spark/math/Vector2.h"
+
 namespace boids
 {
     /**
@@ -30,5 +32,8 @@ namespace boids
 
         /// \brief The field of view of the boids, in degrees to filter which ones affect the current boid.
         float fieldOfView = 100.f;
+
+        /// \brief The position of the mouse cursor, sampled every frame by the manager since the input cannot be read while birds are updated in parallel.
+        spark::math::Vector2<float> mousePosition = {0.f, 0.f};
     };
 }
@@ -3,7 +3,6 @@
 
 #include "spark/core/Application.h"
 #include "spark/core/GameObject.h"
-#include "spark/core/Input.h"
 #include "spark/core/components/Rectangle.h"
 #include "spark/core/components/Transform.h"
 #include "spark/math/Vector2.h"
@@ -33,8 +32,9 @@ namespace boids
             throw spark::base::NullPointerException("Simulation settings cannot be null");
 
         addComponent<spark::core::components::Rectangle>(spark::math::Vector2<float> {2.5f, 2.5f}, spark::math::Vector4<float> {1, 1, 1, 1});
-        transform()->position = std::move(position);
+        transform()->setPosition(std::move(position));
         m_currentCellId = cell();
+        publishState();
     }
 
     void Bird::setCellCount(const std::size_t new_count)
@@ -49,11 +49,17 @@ namespace boids
 
     std::size_t Bird::cell() const
     {
-        const auto position = transform()->position.castTo<std::size_t>();
+        const auto position = transform()->position().castTo<std::size_t>();
         const auto cell_size = spark::core::Application::Instance()->window().size().castTo<std::size_t>() / m_cellCount;
         return position.x / cell_size.x + position.y / cell_size.y * m_cellCount;
     }
 
+    void Bird::publishState()
+    {
+        m_publishedPosition = transform()->position();
+        m_publishedDirection = m_direction;
+    }
+
     void Bird::onUpdate(const float dt)
     {
         const auto nearby_birds = m_birdsInCellFn(m_currentCellId);
@@ -71,7 +77,7 @@ namespace boids
                 continue;
 
             // Vector pointing from the current bird to the other bird
-            const spark::math::Vector2<float> offset = other->transform()->position - transform()->position;
+            const spark::math::Vector2<float> offset = other->m_publishedPosition - transform()->position();
             const float distance = offset.norm();
 
             // Skip birds that are too far away
@@ -92,10 +98,10 @@ namespace boids
                 separation -= offset.normalized() * (m_simulationSettings->maxDistance / (distance + 0.0001f)); // Closer the neighbor, stronger the repulsion
 
             // Alignment: steer towards the average heading of local flockmates
-            alignment += other->m_direction;
+            alignment += other->m_publishedDirection;
 
             // Cohesion: steer to move toward the average position of local flockmates
-            cohesion += other->transform()->position;
+            cohesion += other->m_publishedPosition;
         }
 
         // Calculate the final steering force
@@ -108,7 +114,7 @@ namespace boids
             alignment = alignment / static_cast<float>(neighbor_count);
             alignment = alignment.normalized() * m_simulationSettings->alignmentWeight;
 
-            cohesion = cohesion / static_cast<float>(neighbor_count) - transform()->position;
+            cohesion = cohesion / static_cast<float>(neighbor_count) - transform()->position();
             cohesion = cohesion.normalized() * m_simulationSettings->cohesionWeight;
 
             // Combine all flocking forces
@@ -116,8 +122,7 @@ namespace boids
         }
 
         // Goal-seeking to the mouse position
-        const auto mouse_position = spark::core::Input::MousePosition();
-        const auto mouse_direction = (mouse_position - transform()->position).normalized();
+        const auto mouse_direction = (m_simulationSettings->mousePosition - transform()->position()).normalized();
 
         if (m_simulationSettings->followMouse)
         {
@@ -143,7 +148,7 @@ namespace boids
         }
 
         // Update the position with the new direction
-        transform()->position += m_direction * m_simulationSettings->maxSpeed * dt;
+        transform()->setPosition(transform()->position() + m_direction * m_simulationSettings->maxSpeed * dt);
 
         if (m_simulationSettings->avoidWalls)
         {
@@ -155,27 +160,27 @@ namespace boids
             spark::math::Vector2<float> boundary_force {0.0f, 0.0f};
 
             // Left & Right
-            if (transform()->position.x < margin)
-                boundary_force.x += (margin - transform()->position.x) / margin;
-            else if (transform()->position.x > window_size.x - margin)
-                boundary_force.x -= (transform()->position.x - (window_size.x - margin)) / margin;
+            if (transform()->position().x < margin)
+                boundary_force.x += (margin - transform()->position().x) / margin;
+            else if (transform()->position().x > window_size.x - margin)
+                boundary_force.x -= (transform()->position().x - (window_size.x - margin)) / margin;
 
             // Top & Bottom
-            if (transform()->position.y < margin)
-                boundary_force.y += (margin - transform()->position.y) / margin;
-            else if (transform()->position.y > window_size.y - margin)
-                boundary_force.y -= (transform()->position.y - (window_size.y - margin)) / margin;
+            if (transform()->position().y < margin)
+                boundary_force.y += (margin - transform()->position().y) / margin;
+            else if (transform()->position().y > window_size.y - margin)
+                boundary_force.y -= (transform()->position().y - (window_size.y - margin)) / margin;
 
             // Apply boundary force if needed with hard limit
             if (boundary_force.norm() > 0.0001f)
             {
                 m_direction = (m_direction + boundary_force.normalized() * turn_strength).normalized();
-                transform()->position.x = std::clamp(transform()->position.x, 0.0f, window_size.x);
-                transform()->position.y = std::clamp(transform()->position.y, 0.0f, window_size.y);
+                const auto& position = transform()->position();
+                transform()->setPosition({std::clamp(position.x, 0.0f, window_size.x), std::clamp(position.y, 0.0f, window_size.y)});
             }
         }
 
-        // Update the cell if changed
+        // Update the cell if changed. In the parallel update, the emission is deferred until all birds are updated.
         if (const auto new_cell = cell(); m_currentCellId != new_cell)
         {
             const auto old_cell = m_currentCellId;
@@ -4,6 +4,7 @@
 
 #include "spark/core/Application.h"
 #include "spark/core/GameObject.h"
+#include "spark/core/Input.h"
 #include "spark/lib/Random.h"
 #include "spark/math/Vector2.h"
 
@@ -96,9 +97,15 @@ namespace boids
 
     void BoidsManager::onUpdate(const float /*dt*/)
     {
+        // Birds were updated in parallel before the manager, publish their new state for the next frame
+        for (const auto& birds : m_birds | std::views::values)
+            for (auto* bird : birds)
+                bird->publishState();
+        simulationData.mousePosition = spark::core::Input::MousePosition();
+
         ImGui::Begin("Data");
 
-        if (ImGui::SliderInt("Birds Count", reinterpret_cast<int*>(&boidsCount), 1, 7500))
+        if (ImGui::SliderInt("Birds Count", reinterpret_cast<int*>(&boidsCount), 1, 20000))
             adjustBirdCount();
         if (ImGui::SliderInt("Cell Count", reinterpret_cast<int*>(&cellCount), 5, 500))
             adjustCellCount();
@@ -128,8 +128,8 @@ namespace brickbreaker
                      * - range `[55%, 100%]`, the angle is change proportionally to the paddle position on the right side
                     */
                     const float paddle_length = m_paddle->component<spark::core::components::Rectangle>()->size.x;
-                    const float paddle_position_x = m_paddle->transform()->position.x;
-                    const float ball_center_x = transform()->position.x + component<spark::core::components::Circle>()->radius;
+                    const float paddle_position_x = m_paddle->transform()->position().x;
+                    const float ball_center_x = transform()->position().x + component<spark::core::components::Circle>()->radius;
                     const float ball_position_on_paddle = (ball_center_x - paddle_position_x) / paddle_length;
 
                     if (ball_position_on_paddle < 0.45f) // 0% to 45%
@@ -154,17 +154,17 @@ namespace brickbreaker
                 {
                     if (other.gameObject()->name() == "Top Border")
                     {
-                        transform()->position.y = transform()->position.y + 5;
+                        transform()->setPosition({transform()->position().x, transform()->position().y + 5});
                         direction = {direction.x, -direction.y};
                         m_goingUp = false;
                     } else if (other.gameObject()->name() == "Left Border")
                     {
-                        transform()->position.x = transform()->position.x + 5;
+                        transform()->setPosition({transform()->position().x + 5, transform()->position().y});
                         direction = {-direction.x, direction.y};
                         m_goingLeft = false;
                     } else if (other.gameObject()->name() == "Right Border")
                     {
-                        transform()->position.x = transform()->position.x - 5;
+                        transform()->setPosition({transform()->position().x - 5, transform()->position().y});
                         direction = {-direction.x, direction.y};
                         m_goingLeft = true;
                     }
@@ -176,7 +176,7 @@ namespace brickbreaker
         {
             // Set the ball in the middle of the screen.
             const auto window_size = spark::core::Application::Instance()->window().size().castTo<float>();
-            transform()->position = {window_size.x / 2, window_size.y * 0.6f};
+            transform()->setPosition({window_size.x / 2, window_size.y * 0.6f});
 
             m_paddle = FindByName(root(), "Paddle");
             SPARK_ASSERT(m_paddle != nullptr);
@@ -202,12 +202,13 @@ namespace brickbreaker
                     m_gameStarted = true;
                     m_goingUp = true;
                 }
-                transform()->position.x = m_paddle->transform()->position.x + m_paddle->component<spark::core::components::Rectangle>()->size.x / 2 - component<
+                const float x = m_paddle->transform()->position().x + m_paddle->component<spark::core::components::Rectangle>()->size.x / 2 - component<
                     spark::core::components::Circle>()->radius;
+                transform()->setPosition({x, transform()->position().y});
                 return;
             }
 
-            if (checkLoose(transform()->position))
+            if (checkLoose(transform()->position()))
             {
                 m_remainingHealth--;
                 if (m_remainingHealth == 0)
@@ -225,7 +226,7 @@ namespace brickbreaker
                         spark::core::Application::Instance()->close();
                 }
             }
-            transform()->position += direction * velocity * dt;
+            transform()->setPosition(transform()->position() + direction * velocity * dt);
         }
 
     private:
@@ -234,7 +235,7 @@ namespace brickbreaker
             m_gameStarted = false;
             direction = {0, 0};
             m_music.play();
-            transform()->position.y = spark::core::Application::Instance()->window().size().castTo<float>().y * 0.85f;
+            transform()->setPosition({transform()->position().x, spark::core::Application::Instance()->window().size().castTo<float>().y * 0.85f});
         }
 
         /**
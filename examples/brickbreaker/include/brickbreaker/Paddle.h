@@ -36,13 +36,13 @@ namespace brickbreaker
         {
             // Set the paddle at the bottom of the screen
             const spark::math::Vector2 window_size = spark::core::Application::Instance()->window().size().castTo<float>();
-            transform()->position = {window_size.x - 25 - 10, window_size.y - 50};
+            transform()->setPosition({window_size.x - 25 - 10, window_size.y - 50});
         }
 
         void onUpdate(const float dt) override
         {
             const float next_position = spark::core::Input::MousePosition().x;
-            transform()->position.x = newPaddlePosition(next_position, dt);
+            transform()->setPosition({newPaddlePosition(next_position, dt), transform()->position().y});
         }
 
     private:
@@ -58,7 +58,7 @@ namespace brickbreaker
             const auto screen_width = spark::core::Application::Instance()->window().size().castTo<float>().x;
 
             // Move the paddle towards the desired position, but not faster than the speed
-            const auto raw_pos = transform()->position.x + std::clamp(next_position - paddle_rect->size.x / 2 - transform()->position.x, -speed * dt, speed * dt);
+            const auto raw_pos = transform()->position().x + std::clamp(next_position - paddle_rect->size.x / 2 - transform()->position().x, -speed * dt, speed * dt);
             return std::clamp(raw_pos, 0.0f, screen_width - paddle_rect->size.x);
         }
     };
@@ -74,7 +74,7 @@ namespace brickbreaker
         ScreenBorder(std::string name, spark::core::GameObject* parent, const spark::math::Vector2<float>& position, const spark::math::Vector2<float>& size)
             : GameObject(std::move(name), parent)
         {
-            transform()->position = position;
+            transform()->setPosition(position);
             addComponent<spark::core::components::StaticCollider>(spark::math::Rectangle({0, 0}, size));
         }
     };
@@ -45,7 +45,7 @@ std::unique_ptr<spark::core::Application> spark_main(const std::vector<std::stri
             for (unsigned column = 0; column < brick_count.y; column++)
             {
                 const auto* brick = spark::core::GameObject::Instantiate<brickbreaker::Brick>(std::format("Brick{}{}", row, column), brick_container, brick_size);
-                brick->transform()->position = spark::math::Vector2(window_size.x / 8 + column * brick_size.x + column * 2, window_size.y / 8 + row * brick_size.y + row * 2);
+                brick->transform()->setPosition(spark::math::Vector2(window_size.x / 8 + column * brick_size.x + column * 2, window_size.y / 8 + row * brick_size.y + row * 2));
             }
         }
 
@@ -1,23 +1,22 @@
 #pragma once
 
-#include "spark/core/GameObject.h"
+#include "spark/core/components/Tilemap.h"
 #include "spark/math/Vector2.h"
-#include "spark/patterns/Signal.h"
-#include "spark/patterns/Traverser.h"
 
+#include <cstdint>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
 namespace pathfinding
 {
     /**
-     * \brief A single cell inside a \ref Grid.
+     * \brief A single cell inside a \ref Grid, drawn as a tile of its tilemap.
      */
-    class Cell final : public spark::core::GameObject
+    class Cell final
     {
-        DECLARE_SPARK_RTTI(Cell, GameObject)
-
     public:
-        /// \brief The status of the cell (defining shown color)
+        /// \brief The status of the cell (defining shown color), which is also the tile of the cell in the tilemap of the grid.
         enum class Status : std::uint8_t
         {
             None,
@@ -27,21 +26,13 @@ namespace pathfinding
             Path
         };
 
-    public:
-        /// \brief The signal emitted when the cell is clicked.
-        spark::patterns::Signal<Cell&> onClicked;
-
     public:
         /**
-         * \brief Creates a new square cell with the specified \p size.
-         * \param name The name of the cell.
-         * \param parent The parent of the cell (usually a \ref Grid).
-         * \param size The size in pixels (XY) of the cell.
+         * \brief Creates a new cell.
+         * \param tilemap The tilemap of the grid, where the cell is drawn.
+         * \param position The coordinates of the cell in the grid, which are also the coordinates of its tile.
          */
-        explicit Cell(std::string name, spark::core::GameObject* parent, unsigned size);
-
-        void onSpawn() override;
-        void onDestroyed() override;
+        explicit Cell(spark::core::components::Tilemap& tilemap, const spark::math::Vector2<std::size_t>& position);
 
         /**
          * \brief Resets a cell to a valid status before a computation. (weights & status)
@@ -87,7 +78,7 @@ namespace pathfinding
         [[nodiscard]] std::tuple<std::size_t, std::size_t, std::size_t> weights() const;
 
     private:
-        std::size_t m_mousePressedHandle = 0;
+        spark::core::components::Tilemap* m_tilemap = nullptr;
         spark::math::Vector2<std::size_t> m_position;
         Status m_status = Status::None;
         std::size_t m_startWeight = 0, m_destWeight = 0;
@@ -96,5 +87,3 @@ namespace pathfinding
 
 /// \brief Converts the given cell \p status to a \ref std::string_view.
 std::string_view to_string(pathfinding::Cell::Status status);
-
-IMPLEMENT_SPARK_RTTI(pathfinding::Cell)
@@ -6,10 +6,14 @@
 #include "spark/math/Vector2.h"
 #include "spark/patterns/Signal.h"
 
+#include <vector>
+
 namespace pathfinding
 {
     /**
      * \brief A resizable rectangle grid holding \link Cell cells \endlink.
+     *
+     * The cells are stored row by row and drawn by a single \ref spark::core::components::Tilemap, whose tiles are the status of the cells.
      */
     class Grid final : public spark::core::GameObject
     {
@@ -27,6 +31,9 @@ namespace pathfinding
          */
         explicit Grid(std::string name, spark::core::GameObject* parent);
 
+        void onSpawn() override;
+        void onDestroyed() override;
+
         /**
          * \brief Resizes the grid to the specified \p size and \p cell_size.
          * \param size The new size of the grid in cells.
@@ -44,6 +51,8 @@ namespace pathfinding
         std::vector<std::vector<Cell*>> cells();
 
     private:
+        std::size_t m_mousePressedHandle = 0;
+        std::vector<Cell> m_cells;
         spark::math::Vector2<unsigned> m_gridSize = {0, 0};
     };
 }
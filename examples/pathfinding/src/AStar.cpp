@@ -1,6 +1,8 @@
 #include "pathfinding/AStar.h"
 #include "pathfinding/Cell.h"
 
+#include "spark/base/Macros.h"
+#include "spark/log/Logger.h"
 #include "spark/math/Vector2.h"
 
 #include <algorithm>
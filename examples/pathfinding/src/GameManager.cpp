@@ -53,7 +53,7 @@ namespace pathfinding
 
         // Grid settings
         ImGui::SeparatorText("Grid");
-        should_resize |= ImGui::SliderInt2("Size", reinterpret_cast<int*>(&gridSize.x), 1, 50);
+        should_resize |= ImGui::SliderInt2("Size", reinterpret_cast<int*>(&gridSize.x), 1, 500);
         should_resize |= ImGui::SliderInt("Cell Size", reinterpret_cast<int*>(&cellSize), 1, 50);
         should_resize |= ImGui::SliderInt("Cell Offset:", reinterpret_cast<int*>(&cellBorderSize), 1, 10);
         ImGui::Text("Cell Count: %u", gridSize.x * gridSize.y);
@@ -1,8 +1,10 @@
 #include "pathfinding/Grid.h"
 #include "pathfinding/Cell.h"
 
+#include "spark/base/MouseCodes.h"
 #include "spark/core/GameObject.h"
-#include "spark/core/components/Transform.h"
+#include "spark/core/Input.h"
+#include "spark/core/components/Tilemap.h"
 #include "spark/math/Vector2.h"
 
 #include <cstddef>
@@ -12,25 +14,49 @@
 namespace pathfinding
 {
     Grid::Grid(std::string name, spark::core::GameObject* parent)
-        : spark::core::GameObject(std::move(name), parent) {}
+        : spark::core::GameObject(std::move(name), parent)
+    {
+        // Configure the render component, each tile is the status of its cell
+        addComponent<spark::core::components::Tilemap>();
+        component<spark::core::components::Tilemap>()->palette = {
+            {1.f, 1.f, 1.f, 1.f},
+            {0.f, 0.f, 0.f, 1.f},
+            {246.f / 255.f, 250.f / 255.f, 150.f / 255.f, 1.f},
+            {169.f / 255.f, 201.f / 255.f, 196.f / 255.f, 1.f},
+            {0.f, 0.f, 1.f, 1.f}
+        };
+    }
+
+    void Grid::onSpawn()
+    {
+        // Allow clicking
+        m_mousePressedHandle = spark::core::Input::mousePressedEvents[spark::base::MouseCodes::Left].connect([this]
+        {
+            const auto tile = component<spark::core::components::Tilemap>()->tileAt(spark::core::Input::MousePosition());
+            if (tile.has_value())
+                onCellClicked.emit(m_cells[static_cast<std::size_t>(tile->y) * m_gridSize.x + tile->x]);
+        });
+    }
+
+    void Grid::onDestroyed()
+    {
+        spark::core::Input::mousePressedEvents[spark::base::MouseCodes::Left].disconnect(m_mousePressedHandle);
+    }
 
     void Grid::resize(const spark::math::Vector2<unsigned>& size, const unsigned cell_size, const unsigned cell_offset)
     {
-        // Delete all cells
-        for (auto* cell : GameObject::children())
-            Destroy(cell);
+        // Resize the tilemap, which is filled with empty cells
+        auto* tilemap = component<spark::core::components::Tilemap>();
+        tilemap->resize(size);
+        tilemap->tileSize = {static_cast<float>(cell_size), static_cast<float>(cell_size)};
+        tilemap->spacing = static_cast<float>(cell_offset);
 
-        // Recreate them
-        for (std::size_t i = 0; i < size.x; i++)
-        {
-            for (std::size_t j = 0; j < size.y; j++)
-            {
-                auto* cell = Instantiate<Cell>(std::format("Cell {}x{}", j, i), this, cell_size);
-                cell->position() = {j, i};
-                cell->transform()->position = {static_cast<float>(j * cell_size + j * cell_offset), static_cast<float>(i * cell_size + i * cell_offset)};
-                cell->onClicked.connect([this](Cell& c) { onCellClicked.emit(c); });
-            }
-        }
+        // Recreate the cells
+        m_cells.clear();
+        m_cells.reserve(static_cast<std::size_t>(size.x) * size.y);
+        for (std::size_t y = 0; y < size.y; y++)
+            for (std::size_t x = 0; x < size.x; x++)
+                m_cells.emplace_back(*tilemap, spark::math::Vector2<std::size_t> {x, y});
         m_gridSize = size;
     }
 
@@ -40,11 +66,8 @@ namespace pathfinding
         for (std::size_t i = 0; i < m_gridSize.x; ++i)
             cells[i].resize(m_gridSize.y);
 
-        for (auto* obj : GameObject::children())
-        {
-            const auto cell = static_cast<Cell*>(obj);
-            cells[cell->position().x][cell->position().y] = cell;
-        }
+        for (auto& cell : m_cells)
+            cells[cell.position().x][cell.position().y] = &cell;
 
         return cells;
     }
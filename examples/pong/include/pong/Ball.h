@@ -59,11 +59,11 @@ namespace pong
 
         void onUpdate(const float dt) override
         {
-            const auto [next_position, next_direction] = calculateNextFrame(transform()->position + direction * velocity * dt);
+            const auto [next_position, next_direction] = calculateNextFrame(transform()->position() + direction * velocity * dt);
             if (checkLoose(next_position))
                 onLoose.emit();
 
-            transform()->position = next_position;
+            transform()->setPosition(next_position);
             direction = next_direction;
         }
 
@@ -91,19 +91,19 @@ namespace pong
 
             // Check if the ball is hitting the top or bottom wall.
             if (hit_top_wall || hit_bottom_wall)
-                return {transform()->position, {direction.x, -direction.y}};
+                return {transform()->position(), {direction.x, -direction.y}};
 
             // Check if the ball is hitting the left paddle.
-            if (next_position.x < m_leftPaddle->transform()->position.x + m_paddleSize.x &&
-                next_position.y > m_leftPaddle->transform()->position.y - radius && next_position.y < m_leftPaddle->transform()->position.y + m_paddleSize.y)
+            if (next_position.x < m_leftPaddle->transform()->position().x + m_paddleSize.x &&
+                next_position.y > m_leftPaddle->transform()->position().y - radius && next_position.y < m_leftPaddle->transform()->position().y + m_paddleSize.y)
             {
                 FindByName(root(), "Left Score")->component<ui::Score>()->incrementScore.emit(1);
                 return {{adjusted_position.x + radius, adjusted_position.y}, {-direction.x, direction.y}};
             }
 
             // Check if the ball is hitting the right paddle.
-            if (next_position.x > m_rightPaddle->transform()->position.x - radius * 2 &&
-                next_position.y > m_rightPaddle->transform()->position.y - radius && next_position.y < m_rightPaddle->transform()->position.y + m_paddleSize.y)
+            if (next_position.x > m_rightPaddle->transform()->position().x - radius * 2 &&
+                next_position.y > m_rightPaddle->transform()->position().y - radius && next_position.y < m_rightPaddle->transform()->position().y + m_paddleSize.y)
             {
                 FindByName(root(), "Right Score")->component<ui::Score>()->incrementScore.emit(1);
                 return {{adjusted_position.x - radius, adjusted_position.y}, {-direction.x, direction.y}};
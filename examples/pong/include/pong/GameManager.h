@@ -109,25 +109,25 @@ namespace pong
             // Left paddle
             if (spark::core::Input::IsKeyPressed(spark::base::KeyCodes::Z))
             {
-                const float next_height = m_leftPaddle->transform()->position.y - 200.0f * dt;
-                m_leftPaddle->transform()->position.y = newPaddleHeight(m_leftPaddle, next_height);
+                const float next_height = m_leftPaddle->transform()->position().y - 200.0f * dt;
+                m_leftPaddle->transform()->setPosition({m_leftPaddle->transform()->position().x, newPaddleHeight(m_leftPaddle, next_height)});
             }
             if (spark::core::Input::IsKeyPressed(spark::base::KeyCodes::S))
             {
-                const float requested_height = m_leftPaddle->transform()->position.y + 200.0f * dt;
-                m_leftPaddle->transform()->position.y = newPaddleHeight(m_leftPaddle, requested_height);
+                const float requested_height = m_leftPaddle->transform()->position().y + 200.0f * dt;
+                m_leftPaddle->transform()->setPosition({m_leftPaddle->transform()->position().x, newPaddleHeight(m_leftPaddle, requested_height)});
             }
 
             // Right paddle
             if (spark::core::Input::IsKeyPressed(spark::base::KeyCodes::Up))
             {
-                const float next_height = m_rightPaddle->transform()->position.y - 200.0f * dt;
-                m_rightPaddle->transform()->position.y = newPaddleHeight(m_rightPaddle, next_height);
+                const float next_height = m_rightPaddle->transform()->position().y - 200.0f * dt;
+                m_rightPaddle->transform()->setPosition({m_rightPaddle->transform()->position().x, newPaddleHeight(m_rightPaddle, next_height)});
             }
             if (spark::core::Input::IsKeyPressed(spark::base::KeyCodes::Down))
             {
-                const float requested_height = m_rightPaddle->transform()->position.y + 200.0f * dt;
-                m_rightPaddle->transform()->position.y = newPaddleHeight(m_rightPaddle, requested_height);
+                const float requested_height = m_rightPaddle->transform()->position().y + 200.0f * dt;
+                m_rightPaddle->transform()->setPosition({m_rightPaddle->transform()->position().x, newPaddleHeight(m_rightPaddle, requested_height)});
             }
 
             // Update paddle speed from score
@@ -154,9 +154,9 @@ namespace pong
         {
             const spark::math::Vector2 window_size = spark::core::Application::Instance()->window().size().castTo<float>();
 
-            m_leftPaddle->transform()->position = {10, window_size.y / 2 - 50};
-            m_rightPaddle->transform()->position = {window_size.x - 25 - 10, window_size.y / 2 - 50};
-            m_ball->transform()->position = {window_size.x / 2 - 25, window_size.y / 2 - 25};
+            m_leftPaddle->transform()->setPosition({10, window_size.y / 2 - 50});
+            m_rightPaddle->transform()->setPosition({window_size.x - 25 - 10, window_size.y / 2 - 50});
+            m_ball->transform()->setPosition({window_size.x / 2 - 25, window_size.y / 2 - 25});
             m_ball->velocity = 250.0f;
 
             std::ranges::for_each(FindByName(root(), "Background")->componentsInChildren<ui::Score>(), [](ui::Score* score) { score->reset(); });
@@ -29,8 +29,7 @@ namespace pong::ui
 
             for (std::size_t i = 0; i < window_size.y / (lineLength + verticalOffset); i++)
             {
-                auto transform_matrix = glm::translate(glm::mat4(1.f), {m_xOffset, 20 + i * lineLength + i * verticalOffset, 0})
-                        * glm::scale(glm::mat4(1.f), {5, lineLength, 1});
+                const glm::mat3x2 transform_matrix({5.f, 0.f}, {0.f, lineLength}, {m_xOffset, 20 + i * lineLength + i * verticalOffset});
                 spark::core::Application::Instance()->window().renderer().drawQuad(transform_matrix, {1.f, 1.f, 1.f, 1.f});
             }
         }
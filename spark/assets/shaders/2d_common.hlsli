@@ -0,0 +1,21 @@
+#ifndef SPARK_2D_COMMON_HLSLI
+#define SPARK_2D_COMMON_HLSLI
+
+// Declarations shared by the 2D shaders, the shaders including this file are compiled again when it changes
+
+struct VertexData
+{
+    float4 Position : SV_POSITION;
+    float4 Color : COLOR;
+    float3 Circle : TEXCOORD0; // (x, y, radius)
+    float2 Uv : TEXCOORD1;
+    nointerpolation uint Texture : TEXCOORD2; // Index of the atlas page with the DISTANCE_FIELD flag, or NO_TEXTURE
+};
+
+// Must match Renderer2D::s_noTexture
+static const uint NO_TEXTURE = 0xFFFFFFFF;
+
+// Must match Renderer2D::s_distanceField, the flag of the textures storing a signed distance field in their alpha channel
+static const uint DISTANCE_FIELD = 0x80000000;
+
+#endif
@@ -0,0 +1,54 @@
+#pragma pack_matrix(row_major)
+
+#include "2d_common.hlsli"
+
+struct VertexInput
+{
+    //[[vk::location(0)]] 
+    float3 Position : POSITION;
+};
+
+struct CameraData
+{
+    float4x4 ViewProjection;
+};
+
+// Must match Renderer2D::CompactInstanceBuffer
+struct CompactInstanceData
+{
+    float2 AxisX;
+    float2 AxisY;
+    float2 Translation;
+    uint Color; // RGBA8, red in the lowest byte
+    float Circle;
+    uint UvMin; // UNORM16 (left, top)
+    uint UvMax; // UNORM16 (right, bottom)
+    uint Texture;
+};
+
+StructuredBuffer<CompactInstanceData> instances[] : register(t0, space0);
+[[vk::push_constant]] ConstantBuffer<CameraData> camera : register(b0, space1);
+
+float4 unpack_color(uint color)
+{
+    return float4(color & 0xFF, (color >> 8) & 0xFF, (color >> 16) & 0xFF, color >> 24) / 255.0;
+}
+
+float2 unpack_uv(uint uv)
+{
+    return float2(uv & 0xFFFF, uv >> 16) / 65535.0;
+}
+
+VertexData main(in VertexInput input, uint id : SV_InstanceID)
+{
+    VertexData vertex;
+    CompactInstanceData instance = instances[NonUniformResourceIndex(id)].Load(0);
+
+    float2 position = input.Position.x * instance.AxisX + input.Position.y * instance.AxisY + instance.Translation;
+    vertex.Position = mul(float4(position, 0.0, 1.0), camera.ViewProjection);
+    vertex.Color = unpack_color(instance.Color);
+    vertex.Circle = float3(instance.Translation, instance.Circle);
+    vertex.Uv = lerp(unpack_uv(instance.UvMin), unpack_uv(instance.UvMax), input.Position.xy + 0.5);
+    vertex.Texture = instance.Texture;
+    return vertex;
+}
@@ -0,0 +1,120 @@
+#pragma pack_matrix(row_major)
+
+// Compiled with COMPACT defined for the compact instances, the layouts must match the instances of the `2d_vert` and `2d_compact_vert` shaders
+#ifdef COMPACT
+struct InstanceData
+{
+    float2 AxisX;
+    float2 AxisY;
+    float2 Translation;
+    uint Color;
+    float Circle;
+    uint UvMin;
+    uint UvMax;
+    uint Texture;
+};
+#else
+struct InstanceData
+{
+    float4x4 Transform;
+    float4 Color;
+    float4 Uv;
+    float Circle;
+    uint Texture;
+};
+#endif
+
+// Must match VkDrawIndexedIndirectCommand
+struct DrawArguments
+{
+    uint IndexCount;
+    uint InstanceCount;
+    uint FirstIndex;
+    int VertexOffset;
+    uint FirstInstance;
+};
+
+// The culling runs in two passes over the same thread groups, selected by `Pass`
+#define COUNT_PASS 0
+#define COMPACT_PASS 1
+
+struct CullingData
+{
+    float2 VisibleArea;
+    uint Instances;
+    uint Pass;
+};
+
+#define GROUP_SIZE 64
+
+StructuredBuffer<InstanceData> instances[] : register(t0, space0);
+RWStructuredBuffer<InstanceData> visibleInstances[] : register(u0, space1);
+RWStructuredBuffer<DrawArguments> arguments : register(u0, space2);
+RWStructuredBuffer<uint> groupCounts : register(u1, space2);
+[[vk::push_constant]] ConstantBuffer<CullingData> culling : register(b0, space3);
+
+groupshared uint isVisible[GROUP_SIZE];
+groupshared uint previousGroups[GROUP_SIZE];
+
+// Same test as Renderer2D::isVisible, the hidden instances have no size and are culled as well
+bool visible(InstanceData instance)
+{
+#ifdef COMPACT
+    float2 axis_x = instance.AxisX;
+    float2 axis_y = instance.AxisY;
+    float2 center = instance.Translation;
+#else
+    float2 axis_x = instance.Transform._11_12;
+    float2 axis_y = instance.Transform._21_22;
+    float2 center = instance.Transform._41_42;
+#endif
+
+    float2 half_extent = (abs(axis_x) + abs(axis_y)) * 0.5;
+    return any(half_extent > 0.0) && all(center + half_extent >= 0.0) && all(center - half_extent <= culling.VisibleArea);
+}
+
+// The visible instances are compacted in the order of the static batch, so that the instances overlapping each other at the same depth are always drawn
+// in the same order. The first pass counts the visible instances of each group, the second one writes them after the ones of the previous groups.
+[numthreads(GROUP_SIZE, 1, 1)]
+void main(uint3 id : SV_DispatchThreadID, uint3 group : SV_GroupID, uint index : SV_GroupIndex)
+{
+    InstanceData instance = (InstanceData)0;
+    bool is_visible = false;
+    if (id.x < culling.Instances)
+    {
+        instance = instances[NonUniformResourceIndex(id.x)].Load(0);
+        is_visible = visible(instance);
+    }
+
+    isVisible[index] = is_visible ? 1 : 0;
+    if (culling.Pass == COMPACT_PASS)
+    {
+        // Each thread sums a part of the counts of the previous groups
+        uint previous = 0;
+        for (uint previous_group = index; previous_group < group.x; previous_group += GROUP_SIZE)
+            previous += groupCounts[previous_group];
+        previousGroups[index] = previous;
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    uint offset = 0;
+    for (uint previous_thread = 0; previous_thread < index; ++previous_thread)
+        offset += isVisible[previous_thread];
+
+    if (culling.Pass == COUNT_PASS)
+    {
+        if (index == GROUP_SIZE - 1)
+            groupCounts[group.x] = offset + isVisible[index];
+        return;
+    }
+
+    for (uint thread = 0; thread < GROUP_SIZE; ++thread)
+        offset += previousGroups[thread];
+
+    // The last thread of the last group counts all the visible instances, which are drawn from the first one by the indirect draw
+    uint groups = (culling.Instances + GROUP_SIZE - 1) / GROUP_SIZE;
+    if (group.x == groups - 1 && index == GROUP_SIZE - 1)
+        arguments[0].InstanceCount = offset + isVisible[index];
+    if (is_visible)
+        visibleInstances[NonUniformResourceIndex(offset)][0] = instance;
+}
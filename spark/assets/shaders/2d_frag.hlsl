@@ -1,11 +1,6 @@
 #pragma pack_matrix(row_major)
 
-struct VertexData
-{
-    float4 Position : SV_POSITION;
-    float4 Color : COLOR;
-    float3 Circle : TEXCOORD0; // (x, y, radius)
-};
+#include "2d_common.hlsli"
 
 struct FragmentData
 {
@@ -13,6 +8,9 @@ struct FragmentData
     float Depth : SV_DEPTH;
 };
 
+Texture2D pages[] : register(t0, space2);
+SamplerState atlas_sampler : register(s0, space3);
+
 FragmentData main(VertexData input)
 {
     // If the shape to render is a circle (radius > 0), discard the fragment if it's outside the circle
@@ -23,5 +21,23 @@ FragmentData main(VertexData input)
     FragmentData fragment;
     fragment.Depth = input.Position.z;
     fragment.Color = input.Color;
+
+    // Sprites are tinted by their color, and their transparent pixels are cut out since the instances are not sorted for blending
+    if (input.Texture != NO_TEXTURE)
+    {
+        float4 texel = pages[NonUniformResourceIndex(input.Texture & ~DISTANCE_FIELD)].Sample(atlas_sampler, input.Uv);
+        if ((input.Texture & DISTANCE_FIELD) != 0)
+        {
+            // Glyphs are cut out at their outline, where the distance is 0.5, which stays sharp at any scale
+            if (texel.a < 0.5)
+                discard;
+        }
+        else
+        {
+            fragment.Color *= texel;
+            if (fragment.Color.a == 0)
+                discard;
+        }
+    }
     return fragment;
 }
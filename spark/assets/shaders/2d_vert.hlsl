@@ -1,11 +1,6 @@
 #pragma pack_matrix(row_major)
 
-struct VertexData
-{
-    float4 Position : SV_POSITION;
-    float4 Color : COLOR;
-    float3 Circle : TEXCOORD0; // (x, y, radius)
-};
+#include "2d_common.hlsli"
 
 struct VertexInput
 {
@@ -22,7 +17,9 @@ struct InstanceData
 {
     float4x4 Transform;
     float4 Color;
+    float4 Uv; // (left, top, right, bottom)
     float Circle;
+    uint Texture;
 };
 
 StructuredBuffer<InstanceData> instances[] : register(t0, space0);
@@ -37,5 +34,7 @@ VertexData main(in VertexInput input, uint id : SV_InstanceID)
     vertex.Position = mul(position, camera.ViewProjection);
     vertex.Color = instance.Color;
     vertex.Circle = float3(instance.Transform._41_42, instance.Circle);
+    vertex.Uv = lerp(instance.Uv.xy, instance.Uv.zw, input.Position.xy + 0.5);
+    vertex.Texture = instance.Texture;
     return vertex;
 }
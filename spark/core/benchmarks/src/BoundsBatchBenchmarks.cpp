@@ -0,0 +1,118 @@
+#include "spark/core/GameObject.h"
+#include "spark/core/components/Collider.h"
+#include "spark/core/components/Transform.h"
+#include "spark/core/details/BoundsBatch.h"
+
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace spark::core::benchmarks
+{
+    namespace
+    {
+        /**
+         * \brief Generates \p count random bounds of 10x10 units in a 1000x1000 area.
+         */
+        std::vector<math::Vector4<float>> make_bounds(const std::size_t count)
+        {
+            std::mt19937 generator(42);
+            std::uniform_real_distribution<float> position(0.f, 1000.f);
+
+            std::vector<math::Vector4<float>> bounds;
+            bounds.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float x = position(generator), y = position(generator);
+                bounds.emplace_back(x, y, x + 10.f, y + 10.f);
+            }
+            return bounds;
+        }
+    }
+
+    // The benchmarks test one bounds against all the others, the arguments are the number of bounds and the SIMD level.
+
+    /// Reference: calling Collider::collidesWith, which computes both bounds from the transforms.
+    static void BM_OverlapCollidesWith(benchmark::State& state)
+    {
+        const auto bounds = make_bounds(static_cast<std::size_t>(state.range(0)));
+
+        auto* root = GameObject::Instantiate("Root", nullptr);
+        std::vector<const components::Collider*> colliders;
+        for (std::size_t i = 0; i < bounds.size(); ++i)
+        {
+            auto* object = GameObject::Instantiate(std::to_string(i), root);
+            object->transform()->setPosition({bounds[i].x, bounds[i].y});
+            object->addComponent<components::StaticCollider>(math::Rectangle<float> {{0, 0}, {10, 10}});
+            colliders.push_back(object->component<components::StaticCollider>());
+        }
+
+        for (auto _ : state)
+        {
+            std::size_t hits = 0;
+            for (const components::Collider* collider : colliders)
+                hits += colliders.front()->collidesWith(*collider);
+            benchmark::DoNotOptimize(hits);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+
+        GameObject::Destroy(root, true);
+    }
+
+    BENCHMARK(BM_OverlapCollidesWith)->Arg(1024)->Arg(16384);
+
+    /// The same test on cached bounds stored as an array of structures.
+    static void BM_OverlapCachedBounds(benchmark::State& state)
+    {
+        const auto bounds = make_bounds(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::uint32_t> result;
+        result.reserve(bounds.size());
+
+        for (auto _ : state)
+        {
+            result.clear();
+            for (std::size_t i = 0; i < bounds.size(); ++i)
+                if (components::Collider::Overlaps(bounds.front(), bounds[i]))
+                    result.push_back(static_cast<std::uint32_t>(i));
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_OverlapCachedBounds)->Arg(1024)->Arg(16384);
+
+    /// The test of a BoundsBatch, with each supported instruction set.
+    static void BM_OverlapBoundsBatch(benchmark::State& state)
+    {
+        const auto level = static_cast<details::SimdLevel>(state.range(1));
+        if (level > details::BoundsBatch::SupportedSimdLevel())
+        {
+            state.SkipWithError("SIMD level not supported by the CPU");
+            return;
+        }
+
+        const auto bounds = make_bounds(static_cast<std::size_t>(state.range(0)));
+        details::BoundsBatch batch;
+        for (const auto& b : bounds)
+            batch.push(b);
+        std::vector<std::uint32_t> result;
+        result.reserve(bounds.size());
+
+        for (auto _ : state)
+        {
+            result.clear();
+            batch.overlaps(bounds.front(), 0, batch.size(), result, level);
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_OverlapBoundsBatch)->ArgsProduct({{1024, 16384},
+                                                   {
+                                                       static_cast<int>(details::SimdLevel::Scalar),
+                                                       static_cast<int>(details::SimdLevel::Sse),
+                                                       static_cast<int>(details::SimdLevel::Avx)
+                                                   }});
+}
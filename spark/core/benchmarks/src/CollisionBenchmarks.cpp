@@ -0,0 +1,133 @@
+#include "spark/core/CollisionWorld.h"
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+#include "spark/core/components/Collider.h"
+#include "spark/core/components/Transform.h"
+
+#include "spark/math/Vector2.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace spark::core::benchmarks
+{
+    namespace
+    {
+        /**
+         * \brief A scene of colliders of 10x10 units, spread so that each one overlaps a few others. One collider out of ten is static.
+         */
+        class CollisionScene
+        {
+        public:
+            explicit CollisionScene(const std::size_t count, const Broadphase broadphase)
+                : m_scene(GameObject::Instantiate("Root", nullptr))
+            {
+                std::mt19937 generator(42);
+                std::uniform_real_distribution<float> position(0.f, std::sqrt(static_cast<float>(count)) * 25.f);
+                std::uniform_real_distribution<float> velocity(-1.f, 1.f);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    auto* object = GameObject::Instantiate(std::to_string(i), m_scene.root());
+                    object->transform()->setPosition({position(generator), position(generator)});
+                    if (i % 10 == 0)
+                        object->addComponent<components::StaticCollider>(math::Rectangle<float> {{0, 0}, {10, 10}});
+                    else
+                    {
+                        object->addComponent<components::DynamicCollider>(math::Rectangle<float> {{0, 0}, {10, 10}});
+                        object->component<components::DynamicCollider>()->onCollision.connect([this](const components::Collider& /*other*/) { ++contacts; });
+                        m_moving.push_back(object->transform());
+                        m_velocities.push_back({velocity(generator), velocity(generator)});
+                    }
+                }
+
+                m_scene.collisionWorld().setBroadphase(broadphase);
+                m_scene.collisionWorld().setCellSize(16.f);
+                m_scene.onLoad();
+            }
+
+            /**
+             * \brief Moves the dynamic colliders, then updates the scene.
+             */
+            void frame()
+            {
+                for (std::size_t i = 0; i < m_moving.size(); ++i)
+                    m_moving[i]->setPosition(m_moving[i]->position() + m_velocities[i]);
+                m_scene.onUpdate(1.f / 60.f);
+            }
+
+            /**
+             * \brief Moves the dynamic colliders, then runs the reference algorithm: every dynamic collider scans all the colliders of the scene.
+             */
+            void bruteForceFrame()
+            {
+                for (std::size_t i = 0; i < m_moving.size(); ++i)
+                    m_moving[i]->setPosition(m_moving[i]->position() + m_velocities[i]);
+
+                const auto view = m_scene.view<components::DynamicCollider>();
+                view.each([this](components::DynamicCollider& collider)
+                {
+                    const auto test = [this, &collider](const components::Collider& other)
+                    {
+                        if (&other != &collider && collider.collidesWith(other))
+                            ++contacts;
+                    };
+                    m_scene.view<components::StaticCollider>().each(test);
+                    m_scene.view<components::DynamicCollider>().each(test);
+                });
+            }
+
+        public:
+            std::uint64_t contacts = 0;
+
+        private:
+            Scene m_scene;
+            std::vector<components::Transform*> m_moving;
+            std::vector<math::Vector2<float>> m_velocities;
+        };
+
+        void run(benchmark::State& state, const Broadphase broadphase)
+        {
+            CollisionScene scene(static_cast<std::size_t>(state.range(0)), broadphase);
+            for (auto _ : state)
+                scene.frame();
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+            state.counters["Contacts/frame"] = benchmark::Counter(static_cast<double>(scene.contacts), benchmark::Counter::kAvgIterations);
+        }
+    }
+
+    /// Reference: each dynamic collider tests every collider of the scene, as done before the collision world.
+    static void BM_CollisionBruteForce(benchmark::State& state)
+    {
+        CollisionScene scene(static_cast<std::size_t>(state.range(0)), Broadphase::SweepAndPrune);
+        for (auto _ : state)
+            scene.bruteForceFrame();
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["Contacts/frame"] = benchmark::Counter(static_cast<double>(scene.contacts), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK(BM_CollisionBruteForce)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    /// A scene update with the collision world using the sweep and prune broadphase.
+    static void BM_CollisionSweepAndPrune(benchmark::State& state)
+    {
+        run(state, Broadphase::SweepAndPrune);
+    }
+
+    BENCHMARK(BM_CollisionSweepAndPrune)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+    /// A scene update with the collision world using the uniform grid broadphase.
+    static void BM_CollisionUniformGrid(benchmark::State& state)
+    {
+        run(state, Broadphase::UniformGrid);
+    }
+
+    BENCHMARK(BM_CollisionUniformGrid)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+}
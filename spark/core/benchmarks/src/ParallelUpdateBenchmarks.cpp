@@ -0,0 +1,70 @@
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+
+#include "spark/jobs/JobSystem.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace spark::core::benchmarks
+{
+    /**
+     * \brief A GameObject with a compute-bound update only touching its own state, like a bird of a boids simulation.
+     */
+    class Particle final : public GameObject
+    {
+        DECLARE_SPARK_RTTI(Particle, GameObject)
+        SPARK_THREAD_SAFE_UPDATE
+
+    public:
+        explicit Particle(std::string name, GameObject* parent)
+            : GameObject(std::move(name), parent) {}
+
+        void onUpdate(const float dt) override
+        {
+            for (int i = 0; i < 128; ++i)
+                m_value = std::sqrt(m_value * 1.0001f + dt);
+            benchmark::DoNotOptimize(m_value);
+        }
+
+    private:
+        float m_value = 1.f;
+    };
+}
+
+IMPLEMENT_SPARK_RTTI(spark::core::benchmarks::Particle)
+
+namespace spark::core::benchmarks
+{
+    // The benchmark takes the total number of threads as argument: the calling thread plus (threads - 1) workers.
+    // An argument of 0 updates the scene without a job system, as a reference.
+
+    /// Updating a scene of 10000 thread-safe GameObjects.
+    static void BM_SceneParallelUpdate(benchmark::State& state)
+    {
+        constexpr std::size_t particle_count = 10000;
+
+        auto* root = GameObject::Instantiate("Root", nullptr);
+        for (std::size_t i = 0; i < particle_count; ++i)
+            GameObject::Instantiate<Particle>(std::to_string(i), root);
+
+        Scene scene(root);
+        std::unique_ptr<jobs::JobSystem> job_system;
+        if (state.range(0) != 0)
+        {
+            job_system = std::make_unique<jobs::JobSystem>(static_cast<std::size_t>(state.range(0)) - 1);
+            scene.setJobSystem(job_system.get());
+        }
+        scene.onLoad();
+
+        for (auto _ : state)
+            scene.onUpdate(1.f / 60.f);
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(particle_count));
+    }
+
+    BENCHMARK(BM_SceneParallelUpdate)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
@@ -0,0 +1,421 @@
+#include "spark/core/Renderer2D.h"
+
+#include "spark/render/vk/VulkanBackend.h"
+
+#include "benchmark/benchmark.h"
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace spark::core::benchmarks
+{
+    namespace
+    {
+        using Renderer = Renderer2D<render::vk::VulkanBackend>;
+
+        /**
+         * \brief Creates a headless renderer drawing to offscreen images, so that it can run without a window (for example on lavapipe or SwiftShader).
+         * \param render_area The size of the area to render to.
+         * \param instance_format The layout of the instances sent to the GPU.
+         * \param error Set to the reason of the failure if the renderer cannot be created.
+         * \return The renderer, or `nullptr` if it cannot be created.
+         */
+        std::unique_ptr<Renderer> make_headless_renderer(const math::Vector2<unsigned>& render_area, const InstanceFormat instance_format, std::string& error)
+        {
+            try
+            {
+                return std::make_unique<Renderer>(render_area, std::span<std::string> {}, 2, instance_format);
+            }
+            catch (const std::exception& exception)
+            {
+                error = exception.what();
+                return nullptr;
+            }
+        }
+    }
+
+    /**
+     * Draws a frame of quads of random positions, the arguments are the number of quads and the \ref InstanceFormat.
+     * The full format is fed with 4x4 matrices and the compact one with 3x2 ones, as each is meant to be used. The bytes processed are the bytes written
+     * to the instance buffers.
+     */
+    static void BM_Renderer2DFrame(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        const auto instance_format = static_cast<InstanceFormat>(state.range(1));
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, instance_format, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x)), y(0.f, static_cast<float>(render_area.y));
+
+        std::vector<glm::mat4> transforms(static_cast<std::size_t>(state.range(0)));
+        std::vector<glm::mat3x2> compact_transforms(transforms.size());
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+        {
+            const glm::vec2 position = {x(generator), y(generator)};
+            transforms[i] = glm::scale(glm::translate(glm::mat4(1.f), {position, 0.f}), {8.f, 8.f, 1.f});
+            compact_transforms[i] = glm::mat3x2({8.f, 0.f}, {0.f, 8.f}, position);
+        }
+
+        for (auto _ : state)
+        {
+            if (instance_format == InstanceFormat::Full)
+                for (const glm::mat4& transform : transforms)
+                    renderer->drawQuad(transform, {1.f, 0.5f, 0.f, 1.f});
+            else
+                for (const glm::mat3x2& transform : compact_transforms)
+                    renderer->drawQuad(transform, {1.f, 0.5f, 0.f, 1.f});
+            renderer->render();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(renderer->instanceSize()));
+        state.counters["bytes/instance"] = static_cast<double>(renderer->instanceSize());
+    }
+
+    BENCHMARK(BM_Renderer2DFrame)->ArgsProduct({{1000, 10000, 100000},
+                                                {
+                                                    static_cast<int>(InstanceFormat::Full),
+                                                    static_cast<int>(InstanceFormat::Compact)
+                                                }})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws a frame of quads spread over a scrolling world 8 times as large as the viewport, the argument is the number of quads.
+     * Most of the quads are outside of the viewport and culled before being written to the instance buffers.
+     */
+    static void BM_Renderer2DCulling(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x) * 8), y(0.f, static_cast<float>(render_area.y));
+
+        std::vector<glm::mat3x2> transforms(static_cast<std::size_t>(state.range(0)));
+        for (glm::mat3x2& transform : transforms)
+            transform = glm::mat3x2({8.f, 0.f}, {0.f, 8.f}, {x(generator), y(generator)});
+
+        for (auto _ : state)
+        {
+            for (const glm::mat3x2& transform : transforms)
+                renderer->drawQuad(transform, {1.f, 0.5f, 0.f, 1.f});
+            renderer->render();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["submitted"] = static_cast<double>(renderer->statistics().submitted);
+        state.counters["culled"] = static_cast<double>(renderer->statistics().culled);
+    }
+
+    BENCHMARK(BM_Renderer2DCulling)->Arg(100000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws frames of static quads spread over a world 8 times as large as the viewport, which are culled on the GPU by the culling shader. The arguments
+     * are the number of quads and the \ref InstanceFormat, which selects the culling shader.
+     * A quad added last at the center of the viewport is read back after the frames. The benchmark fails if the culling dropped it, or if it did not keep
+     * the order of the instances, which draws the quads overlapping it after it.
+     */
+    static void BM_Renderer2DStaticCulling(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {256, 256};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, static_cast<InstanceFormat>(state.range(1)), error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x) * 8), y(0.f, static_cast<float>(render_area.y));
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+            renderer->addStatic(glm::mat3x2({2.f, 0.f}, {0.f, 2.f}, {x(generator), y(generator)}), {0.f, 0.f, 1.f, 1.f});
+
+        // All the statics are drawn at the same depth, the last one added is drawn over the others
+        const glm::vec2 center = {static_cast<float>(render_area.x) / 2, static_cast<float>(render_area.y) / 2};
+        renderer->addStatic(glm::mat3x2({32.f, 0.f}, {0.f, 32.f}, center), {1.f, 0.f, 0.f, 1.f});
+
+        for (auto _ : state)
+            renderer->render();
+        state.SetItemsProcessed(state.iterations() * (state.range(0) + 1));
+
+        // The frames are in the B8G8R8A8_UNORM format, the center pixel must be the red quad
+        const std::vector<std::byte> pixels = renderer->readBack();
+        const std::size_t pixel = (static_cast<std::size_t>(render_area.y / 2) * render_area.x + render_area.x / 2) * 4;
+        if (pixels[pixel] != std::byte {0} || pixels[pixel + 1] != std::byte {0} || pixels[pixel + 2] != std::byte {255})
+            state.SkipWithError("The quad at the center of the viewport was culled or drawn out of order.");
+    }
+
+    BENCHMARK(BM_Renderer2DStaticCulling)->ArgsProduct({{100000},
+                                                        {
+                                                            static_cast<int>(InstanceFormat::Full),
+                                                            static_cast<int>(InstanceFormat::Compact)
+                                                        }})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws a frame of labels whose text changes every frame, like a HUD of counters, the argument is the number of labels.
+     * Each label is laid out again before being drawn, the layout being the cost a \ref components::Text only pays when its content changes.
+     */
+    static void BM_Renderer2DChangingLabels(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        const Font* font = nullptr;
+        try
+        {
+            font = &renderer->loadFont(SPARK_BENCHMARK_FONT);
+        }
+        catch (const std::exception& exception)
+        {
+            state.SkipWithError((std::string("Unable to load the font: ") + exception.what()).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x)), y(0.f, static_cast<float>(render_area.y));
+        std::vector<glm::vec2> positions(static_cast<std::size_t>(state.range(0)));
+        for (glm::vec2& position : positions)
+            position = {x(generator), y(generator)};
+
+        std::size_t frame = 0, glyphs = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                const TextLayout layout = font->layout(std::format("Score: {}", frame * positions.size() + i));
+                renderer->drawText(glm::mat3x2({12.f, 0.f}, {0.f, 12.f}, positions[i]), layout, {1.f, 1.f, 1.f, 1.f});
+                glyphs += layout.glyphs.size();
+            }
+            renderer->render();
+            ++frame;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["glyphs/frame"] = benchmark::Counter(static_cast<double>(glyphs), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK(BM_Renderer2DChangingLabels)->Arg(10000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws a frame of a square grid of tiles where a single tile changes every frame, like the grid of the pathfinding example. The arguments are the
+     * number of tiles on each side and whether the tiles are drawn one by one every frame (0) or kept in instance batches of 32x32 tiles (1).
+     */
+    static void BM_Renderer2DTiles(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        constexpr unsigned chunk_size = 32;
+        constexpr float tile_size = 4.f, step = 5.f;
+        const auto side = static_cast<unsigned>(state.range(0));
+        const bool is_batched = state.range(1) != 0;
+        const auto tile_transform = [&](const unsigned x, const unsigned y)
+        {
+            return glm::mat3x2({tile_size, 0.f}, {0.f, tile_size}, {static_cast<float>(x) * step + tile_size / 2, static_cast<float>(y) * step + tile_size / 2});
+        };
+
+        std::vector<math::Vector4<float>> colors(static_cast<std::size_t>(side) * side, {1.f, 1.f, 1.f, 1.f});
+        const auto chunks = (side + chunk_size - 1) / chunk_size;
+        std::vector<InstanceBatch> batches;
+        if (is_batched)
+            for (unsigned chunk_y = 0; chunk_y < chunks; ++chunk_y)
+                for (unsigned chunk_x = 0; chunk_x < chunks; ++chunk_x)
+                {
+                    batches.push_back(renderer->createBatch(chunk_size * chunk_size));
+                    for (unsigned y = chunk_y * chunk_size; y < std::min(side, (chunk_y + 1) * chunk_size); ++y)
+                        for (unsigned x = chunk_x * chunk_size; x < std::min(side, (chunk_x + 1) * chunk_size); ++x)
+                            renderer->updateBatch(batches.back(), (y % chunk_size) * chunk_size + x % chunk_size, tile_transform(x, y), colors[y * side + x]);
+                }
+
+        std::size_t frame = 0;
+        for (auto _ : state)
+        {
+            // Change the color of a tile, like an obstacle placed by the user
+            const unsigned changed_x = static_cast<unsigned>(frame * 7) % side, changed_y = static_cast<unsigned>(frame * 13) % side;
+            math::Vector4<float>& color = colors[changed_y * side + changed_x];
+            color = color.x > 0.f ? math::Vector4<float> {0.f, 0.f, 0.f, 1.f} : math::Vector4<float> {1.f, 1.f, 1.f, 1.f};
+
+            if (is_batched)
+            {
+                const InstanceBatch batch = batches[changed_y / chunk_size * chunks + changed_x / chunk_size];
+                renderer->updateBatch(batch, (changed_y % chunk_size) * chunk_size + changed_x % chunk_size, tile_transform(changed_x, changed_y), color);
+
+                const float chunk_extent = chunk_size * step;
+                for (unsigned chunk = 0; chunk < batches.size(); ++chunk)
+                {
+                    const glm::vec2 corner = {static_cast<float>(chunk % chunks) * chunk_extent, static_cast<float>(chunk / chunks) * chunk_extent};
+                    renderer->drawBatch(batches[chunk], glm::mat3x2({chunk_extent, 0.f}, {0.f, chunk_extent}, corner + chunk_extent / 2));
+                }
+            } else
+                for (unsigned y = 0; y < side; ++y)
+                    for (unsigned x = 0; x < side; ++x)
+                        renderer->drawQuad(tile_transform(x, y), colors[y * side + x]);
+
+            renderer->render();
+            ++frame;
+        }
+        state.SetItemsProcessed(state.iterations() * side * side);
+        state.counters["submitted"] = static_cast<double>(renderer->statistics().submitted);
+        state.counters["culled"] = static_cast<double>(renderer->statistics().culled);
+        state.counters["written"] = static_cast<double>(renderer->statistics().staticUpdates);
+    }
+
+    BENCHMARK(BM_Renderer2DTiles)->ArgsProduct({{500}, {0, 1}})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws frames of quads and counts the command buffers and command pools allocated by the graphics queue, the argument is the number of quads.
+     * The first frames allocate the command buffers kept in flight, the counted frames are the ones after them, which should reuse the recycled ones.
+     */
+    static void BM_Renderer2DCommandBufferAllocations(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x)), y(0.f, static_cast<float>(render_area.y));
+        std::vector<glm::mat3x2> transforms(static_cast<std::size_t>(state.range(0)));
+        for (glm::mat3x2& transform : transforms)
+            transform = glm::mat3x2({8.f, 0.f}, {0.f, 8.f}, {x(generator), y(generator)});
+
+        const auto draw_frame = [&]()
+        {
+            for (const glm::mat3x2& transform : transforms)
+                renderer->drawQuad(transform, {1.f, 0.5f, 0.f, 1.f});
+            renderer->render();
+        };
+
+        // Reach the steady state, where the frames in flight hold all the command buffers they need
+        for (int frame = 0; frame < 8; ++frame)
+            draw_frame();
+
+        std::size_t allocations = 0;
+        for (auto _ : state)
+        {
+            draw_frame();
+            allocations += renderer->statistics().commandBufferAllocations;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["allocations/frame"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK(BM_Renderer2DCommandBufferAllocations)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Creates a renderer until its first frame is submitted, the argument is 1 to start from the pipeline cache of a previous run, 0 to start without it.
+     * Most of the startup of a cold run is the compilation of the pipelines by the driver, which a warm run loads from the cache instead.
+     */
+    static void BM_Renderer2DStartup(benchmark::State& state)
+    {
+        const bool is_warm = state.range(0) != 0;
+        const math::Vector2<unsigned> render_area = {1280, 720};
+        std::string error;
+
+        // Fill the cache once, the renderer saves it when destroyed
+        std::filesystem::remove_all(Renderer::PipelineCacheDirectory());
+        if (is_warm && !make_headless_renderer(render_area, InstanceFormat::Compact, error))
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        for (auto _ : state)
+        {
+            if (!is_warm)
+            {
+                state.PauseTiming();
+                std::filesystem::remove_all(Renderer::PipelineCacheDirectory());
+                state.ResumeTiming();
+            }
+
+            auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+            if (!renderer)
+            {
+                state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+                return;
+            }
+            renderer->render();
+
+            // Saving the cache is part of the shutdown, not of the startup
+            state.PauseTiming();
+            renderer.reset();
+            state.ResumeTiming();
+        }
+    }
+
+    BENCHMARK(BM_Renderer2DStartup)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * Draws a frame of quads and reads it back to the CPU, the argument is the size of the square render area.
+     * This is the cost of a golden image or a thumbnail rendered by a headless renderer, the bytes processed being the read pixels.
+     */
+    static void BM_Renderer2DReadBack(benchmark::State& state)
+    {
+        const math::Vector2<unsigned> render_area = {static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(0))};
+        std::string error;
+        const auto renderer = make_headless_renderer(render_area, InstanceFormat::Compact, error);
+        if (!renderer)
+        {
+            state.SkipWithError(("Unable to create a headless renderer: " + error).c_str());
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(render_area.x)), y(0.f, static_cast<float>(render_area.y));
+
+        std::vector<glm::mat3x2> transforms(1000);
+        for (glm::mat3x2& transform : transforms)
+            transform = glm::mat3x2({8.f, 0.f}, {0.f, 8.f}, {x(generator), y(generator)});
+
+        std::size_t pixels_size = 0;
+        for (auto _ : state)
+        {
+            for (const glm::mat3x2& transform : transforms)
+                renderer->drawQuad(transform, {1.f, 0.5f, 0.f, 1.f});
+            renderer->render();
+
+            const std::vector<std::byte> pixels = renderer->readBack();
+            pixels_size = pixels.size();
+            benchmark::DoNotOptimize(pixels.data());
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(pixels_size));
+    }
+
+    BENCHMARK(BM_Renderer2DReadBack)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
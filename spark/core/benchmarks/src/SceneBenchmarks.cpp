@@ -0,0 +1,133 @@
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+
+#include "spark/base/Macros.h"
+#include "spark/patterns/Traverser.h"
+
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace
+{
+    std::atomic<std::size_t> g_allocations = 0;
+}
+
+// Count every heap allocation of the process to report the allocations made by each frame
+// \note On Windows, this only counts the allocations made by the benchmark executable, not by the SPARK libraries.
+SPARK_WARNING_PUSH
+SPARK_DISABLE_GCC_WARNING(-Wmismatched-new-delete)
+
+void* operator new(const std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+SPARK_WARNING_POP
+
+namespace spark::core::benchmarks
+{
+    namespace
+    {
+        /**
+         * \brief Creates a scene of 11110 GameObjects (10 children per node, 4 levels deep).
+         * \return A pointer to the root of the scene.
+         */
+        GameObject* make_scene_tree()
+        {
+            auto* root = GameObject::Instantiate("Root", nullptr);
+            std::vector<GameObject*> parents = {root};
+            for (std::size_t depth = 0; depth < 4; ++depth)
+            {
+                std::vector<GameObject*> children;
+                for (GameObject* parent : parents)
+                    for (std::size_t i = 0; i < 10; ++i)
+                        children.push_back(GameObject::Instantiate(std::to_string(i), parent));
+                parents = std::move(children);
+            }
+            return root;
+        }
+
+        /**
+         * \brief Reports the number of heap allocations per frame since \p start.
+         */
+        void report_allocations(benchmark::State& state, const std::size_t start)
+        {
+            state.counters["Allocations/frame"] = benchmark::Counter(static_cast<double>(g_allocations - start), benchmark::Counter::kAvgIterations);
+        }
+    }
+
+    /// Reference: the per-frame passes as implemented with patterns::traverse_tree, which copies the children of every node.
+    static void BM_SceneFrameWithTraverser(benchmark::State& state)
+    {
+        GameObject* root = make_scene_tree();
+        Scene scene(root);
+        scene.onLoad();
+
+        const std::size_t start = g_allocations;
+        for (auto _ : state)
+        {
+            auto update = patterns::make_traverser<GameObject>([](GameObject* object)
+            {
+                static_cast<details::AbstractGameObject<GameObject>*>(object)->onUpdate(1.f / 60.f);
+            });
+            patterns::traverse_tree(root, update);
+
+            auto render = patterns::make_traverser<GameObject>([](const GameObject* object)
+            {
+                for (const auto* component : object->components())
+                    component->render();
+            });
+            patterns::traverse_tree(root, render);
+        }
+        report_allocations(state, start);
+    }
+
+    BENCHMARK(BM_SceneFrameWithTraverser);
+
+    /// The per-frame passes of the Scene, iterating the flat traversal order.
+    static void BM_SceneFrame(benchmark::State& state)
+    {
+        Scene scene(make_scene_tree());
+        scene.onLoad();
+
+        const std::size_t start = g_allocations;
+        for (auto _ : state)
+        {
+            scene.onUpdate(1.f / 60.f);
+            scene.onRender();
+        }
+        report_allocations(state, start);
+    }
+
+    BENCHMARK(BM_SceneFrame);
+
+    /// Looking up an object by name on the whole scene.
+    static void BM_SceneFindByName(benchmark::State& state)
+    {
+        Scene scene(make_scene_tree());
+
+        const std::size_t start = g_allocations;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(GameObject::FindByName(scene.root(), "Root"));
+        report_allocations(state, start);
+    }
+
+    BENCHMARK(BM_SceneFindByName);
+}
@@ -0,0 +1,114 @@
+#include "spark/core/GameObject.h"
+#include "spark/core/components/Transform.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+namespace spark::core::benchmarks
+{
+    namespace
+    {
+        /**
+         * \brief A hierarchy of 9840 GameObjects (3 children per node, 8 levels deep) and its transforms sorted by depth.
+         */
+        class Hierarchy
+        {
+        public:
+            static constexpr std::size_t s_branching = 3;
+            static constexpr std::size_t s_depth = 8;
+
+            Hierarchy()
+            {
+                m_root = GameObject::Instantiate("Root", nullptr);
+                m_levels.resize(s_depth);
+
+                std::vector<GameObject*> parents = {m_root};
+                for (std::size_t depth = 0; depth < s_depth; ++depth)
+                {
+                    std::vector<GameObject*> children;
+                    children.reserve(parents.size() * s_branching);
+                    for (GameObject* parent : parents)
+                        for (std::size_t i = 0; i < s_branching; ++i)
+                        {
+                            auto* child = GameObject::Instantiate(std::to_string(i), parent);
+                            child->transform()->setPosition({static_cast<float>(i), 1.f});
+                            child->transform()->setRotation(0.1f);
+                            m_levels[depth].push_back(child->transform());
+                            children.push_back(child);
+                        }
+                    parents = std::move(children);
+                }
+
+                for (const auto& level : m_levels)
+                    m_transforms.insert(m_transforms.end(), level.begin(), level.end());
+            }
+
+            ~Hierarchy()
+            {
+                GameObject::Destroy(m_root, true);
+            }
+
+            Hierarchy(const Hierarchy& other) = delete;
+            Hierarchy(Hierarchy&& other) noexcept = delete;
+            Hierarchy& operator=(const Hierarchy& other) = delete;
+            Hierarchy& operator=(Hierarchy&& other) noexcept = delete;
+
+            /**
+             * \brief Computes the world matrix of every node, as done once per frame by the renderer.
+             */
+            void computeMatrices(benchmark::State& state) const
+            {
+                for (const auto* transform : m_transforms)
+                    benchmark::DoNotOptimize(transform->matrix());
+                state.counters["Nodes"] = static_cast<double>(m_transforms.size());
+            }
+
+            [[nodiscard]] const std::vector<components::Transform*>& level(const std::size_t depth) const { return m_levels[depth]; }
+
+        private:
+            GameObject* m_root = nullptr;
+            std::vector<std::vector<components::Transform*>> m_levels;
+            std::vector<components::Transform*> m_transforms;
+        };
+    }
+
+    /// Nothing moves: every matrix comes from the cache.
+    static void BM_TransformStaticHierarchy(benchmark::State& state)
+    {
+        const Hierarchy hierarchy;
+        for (auto _ : state)
+            hierarchy.computeMatrices(state);
+    }
+
+    BENCHMARK(BM_TransformStaticHierarchy);
+
+    /// Every leaf moves each frame: only the leaves are recomputed.
+    static void BM_TransformMovingLeaves(benchmark::State& state)
+    {
+        const Hierarchy hierarchy;
+        for (auto _ : state)
+        {
+            for (auto* transform : hierarchy.level(Hierarchy::s_depth - 1))
+                transform->setPosition(transform->position() + math::Vector2<float> {0.01f, 0.f});
+            hierarchy.computeMatrices(state);
+        }
+    }
+
+    BENCHMARK(BM_TransformMovingLeaves);
+
+    /// The top level moves each frame: the whole hierarchy is recomputed.
+    static void BM_TransformMovingTopLevel(benchmark::State& state)
+    {
+        const Hierarchy hierarchy;
+        for (auto _ : state)
+        {
+            for (auto* transform : hierarchy.level(0))
+                transform->setRotation(transform->rotation() + 0.01f);
+            hierarchy.computeMatrices(state);
+        }
+    }
+
+    BENCHMARK(BM_TransformMovingTopLevel);
+}
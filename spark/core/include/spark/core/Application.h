@@ -4,6 +4,8 @@
 #include "spark/core/Registries.h"
 #include "spark/core/Window.h"
 
+#include "spark/jobs/JobSystem.h"
+
 #include <filesystem>
 #include <string>
 
@@ -31,6 +33,12 @@ namespace spark::core
             std::string name;
             spark::math::Vector2<unsigned int> size;
             bool resizable = false;
+
+            /// \brief The number of frames the CPU can prepare while the GPU is still drawing the previous ones.
+            unsigned int framesInFlight = 2;
+
+            /// \brief The layout of the instances sent to the GPU by the renderer.
+            InstanceFormat instanceFormat = InstanceFormat::Full;
         };
 
         /**
@@ -96,6 +104,12 @@ namespace spark::core
          */
         [[nodiscard]] Registries& registries();
 
+        /**
+         * \brief Gets the job system of the application, used to run work in parallel on worker threads.
+         * \return A reference to the \link spark::jobs::JobSystem \endlink of the application.
+         */
+        [[nodiscard]] jobs::JobSystem& jobSystem();
+
     private:
         /**
          * \brief Instantiates a new application with the given settings.
@@ -113,6 +127,8 @@ namespace spark::core
         static Application* s_instance;
 
     private:
+        // Declared first to be destroyed last, jobs may still reference the window or the scene
+        std::unique_ptr<jobs::JobSystem> m_jobSystem;
         std::unique_ptr<Window> m_window;
         std::shared_ptr<core::Scene> m_scene;
         Settings m_settings;
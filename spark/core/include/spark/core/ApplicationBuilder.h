@@ -11,6 +11,10 @@ namespace spark::core
         struct set_size_called {};
 
         struct set_resize_policy {};
+
+        struct set_frames_in_flight_called {};
+
+        struct set_instance_format_called {};
     }
 
     template <typename... Tags>
@@ -48,6 +52,24 @@ namespace spark::core
          */
         ApplicationBuilder<details::application_tags::set_resize_policy, Tags...> setResizable(bool resizable);
 
+        /**
+         * \brief Sets the number of frames the CPU can prepare while the GPU is still drawing the previous ones.
+         * \param frames_in_flight The number of frames in flight. Must be greater than zero. Defaults to 2.
+         * \return A new builder used to continue building the application.
+         *
+         * More frames in flight keep the CPU and the GPU busier, at the cost of more memory and latency between the input and the presented frame.
+         */
+        ApplicationBuilder<details::application_tags::set_frames_in_flight_called, Tags...> setFramesInFlight(unsigned int frames_in_flight);
+
+        /**
+         * \brief Sets the layout of the instances sent to the GPU by the renderer.
+         * \param instance_format The \ref InstanceFormat to use. Defaults to \ref InstanceFormat::Full.
+         * \return A new builder used to continue building the application.
+         *
+         * \ref InstanceFormat::Compact sends about a third of the data to the GPU, but only keeps the 2D part of the transformations.
+         */
+        ApplicationBuilder<details::application_tags::set_instance_format_called, Tags...> setInstanceFormat(InstanceFormat instance_format);
+
         /**
          * \brief Builds the application with the given settings.
          * \return A \ref std::unique_ptr to the newly created application.
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "spark/core/Export.h"
+#include "spark/core/details/BoundsBatch.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Vector4.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spark::core
+{
+    namespace components
+    {
+        class Collider;
+    }
+
+    /**
+     * \brief The algorithm used by a \ref CollisionWorld to find the pairs of colliders that may collide.
+     */
+    enum class Broadphase
+    {
+        /// \brief Sorts the colliders along the X axis and only tests the ones overlapping on it.
+        /// Works with any collider size, and is the default.
+        SweepAndPrune,
+
+        /// \brief Buckets the colliders in a grid of square cells and only tests the ones sharing a cell.
+        /// Best when colliders have similar sizes, close to the cell size.
+        UniformGrid
+    };
+
+    /**
+     * \brief Detects the collisions between all the colliders of a Scene.
+     *
+     * Colliders register themselves when attached to a GameObject of a Scene, and unregister when detached. Once per frame, \ref update caches the
+     * bounds of every collider, finds the candidate pairs with the selected \ref Broadphase, and emits \ref components::DynamicCollider::onCollision
+     * for each dynamic collider colliding with another collider.
+     */
+    class SPARK_CORE_EXPORT CollisionWorld final
+    {
+    public:
+        /**
+         * \brief Instantiates a new, empty, collision world.
+         * \param broadphase The algorithm used to find the candidate pairs.
+         * \param cell_size The size of the cells when using \ref Broadphase::UniformGrid.
+         */
+        explicit CollisionWorld(Broadphase broadphase = Broadphase::SweepAndPrune, float cell_size = 64.f);
+        ~CollisionWorld();
+
+        CollisionWorld(const CollisionWorld& other) = delete;
+        CollisionWorld(CollisionWorld&& other) noexcept = delete;
+        CollisionWorld& operator=(const CollisionWorld& other) = delete;
+        CollisionWorld& operator=(CollisionWorld&& other) noexcept = delete;
+
+        /**
+         * \brief Gets the algorithm used to find the candidate pairs.
+         * \return The current \ref Broadphase.
+         */
+        [[nodiscard]] Broadphase broadphase() const;
+
+        /**
+         * \brief Sets the algorithm used to find the candidate pairs. The collisions found are the same with every algorithm.
+         * \param broadphase The new \ref Broadphase.
+         */
+        void setBroadphase(Broadphase broadphase);
+
+        /**
+         * \brief Gets the size of the cells used by \ref Broadphase::UniformGrid.
+         * \return The size of a cell, in screen units.
+         */
+        [[nodiscard]] float cellSize() const;
+
+        /**
+         * \brief Sets the size of the cells used by \ref Broadphase::UniformGrid.
+         * \param cell_size The new size of a cell, in screen units. Must be greater than zero.
+         */
+        void setCellSize(float cell_size);
+
+        /**
+         * \brief Registers a collider in the world.
+         * \param collider The collider to register. It must not be registered in any world.
+         */
+        void add(components::Collider* collider);
+
+        /**
+         * \brief Unregisters a collider from the world. Can be called while collisions are emitted.
+         * \param collider The collider to unregister. It must be registered in this world.
+         */
+        void remove(components::Collider* collider);
+
+        /**
+         * \brief Gets the number of colliders registered in the world.
+         * \return The number of colliders.
+         */
+        [[nodiscard]] std::size_t colliderCount() const;
+
+        /**
+         * \brief Detects the collisions between the registered colliders and emits the corresponding signals.
+         *
+         * The signals are emitted in the order of registration of the dynamic colliders, then of the colliders they collide with. The colliders whose
+         * bounds are not finite, for example after a division by zero in a script, never collide.
+         */
+        void update();
+
+    private:
+        /**
+         * \brief A collision to report: \ref source is a dynamic collider colliding with \ref target. Both are indices in \ref m_colliders.
+         */
+        struct Contact
+        {
+            std::uint32_t source = 0;
+            std::uint32_t target = 0;
+        };
+
+        /**
+         * \brief An entry of the uniform grid: a collider overlapping a cell.
+         */
+        struct GridEntry
+        {
+            std::uint64_t cell = 0;
+            std::uint32_t collider = 0;
+        };
+
+    private:
+        /**
+         * \brief Removes the unregistered colliders from the arrays, keeping the registration order.
+         */
+        void compact();
+
+        /**
+         * \brief Finds the colliding pairs with \ref Broadphase::SweepAndPrune.
+         *
+         * The colliders overlapping on the X axis are then tested in batches with the same test as \ref components::Collider::Overlaps.
+         */
+        void sweepAndPrune();
+
+        /**
+         * \brief Finds the colliding pairs with \ref Broadphase::UniformGrid.
+         *
+         * The colliders sharing a cell are then tested in batches with the same test as \ref components::Collider::Overlaps.
+         */
+        void uniformGrid();
+
+        /**
+         * \brief Records the contacts of two colliding colliders, for each one being dynamic.
+         * \param lhs The index of the first collider.
+         * \param rhs The index of the second collider.
+         */
+        void addContacts(std::uint32_t lhs, std::uint32_t rhs);
+
+    private:
+        Broadphase m_broadphase;
+        float m_cellSize;
+        std::size_t m_removedCount = 0;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::CollisionWorld'
+
+        // Registered colliders, in registration order. Unregistered ones are set to nullptr until the next update.
+        std::vector<components::Collider*> m_colliders;
+        std::vector<std::uint8_t> m_dynamic;
+
+        // Per-frame data, kept between frames to avoid allocations
+        std::vector<math::Vector4<float>> m_bounds;
+        std::vector<math::Vector4<float>> m_boxes;
+        std::vector<std::uint32_t> m_order;
+        std::vector<GridEntry> m_gridEntries;
+        std::vector<float> m_sortedMinX;
+        std::vector<std::uint32_t> m_hits;
+        std::vector<Contact> m_contacts;
+        details::BoundsBatch m_batch;
+
+        SPARK_WARNING_POP
+    };
+}
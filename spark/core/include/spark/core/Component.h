@@ -7,10 +7,36 @@
 #include "spark/lib/Uuid.h"
 #include "spark/rtti/HasRtti.h"
 
+/**
+ * \brief Marks the onUpdate method of a Component or a GameObject as thread-safe, allowing the Scene to run it in its parallel update phase.
+ *
+ * The macro must be used in the class declaration, after \ref DECLARE_SPARK_RTTI. It does not change the access level, so it must be placed in a public
+ * section, such as the one \ref DECLARE_SPARK_RTTI ends with. Only the exact class using it is marked: a derived class must use it again, since its
+ * own onUpdate may not be thread-safe.
+ *
+ * A thread-safe update may only modify the state of its own GameObject and components, and read state not modified during the parallel phase.
+ * It must not instantiate GameObjects nor add or remove components. Signal emissions and \ref spark::core::GameObject::Destroy calls are deferred
+ * until the end of the parallel phase.
+ *
+ * The Transform follows the same rule. Its matrix may be read when neither it nor the transforms above it are modified during the parallel phase,
+ * since the Scene computes the outdated matrices before the phase. Modifying a Transform also outdates the transforms of the children of its
+ * GameObject, which are then modified as well: the children must not use their Transform in the parallel phase.
+ */
+#define SPARK_THREAD_SAFE_UPDATE                                \
+    bool hasThreadSafeUpdate() const override                   \
+    {                                                           \
+        return &rttiInstance() == &classRtti();                 \
+    }
+
 namespace spark::core
 {
     class GameObject;
 
+    namespace details
+    {
+        class ComponentPool;
+    }
+
     /**
      * \brief A component that can be attached to a GameObject to provide additional functionality.
      *
@@ -20,6 +46,7 @@ namespace spark::core
     {
         DECLARE_SPARK_RTTI(Component)
         SPARK_ALLOW_PRIVATE_SERIALIZATION
+        friend class details::ComponentPool;
 
     public:
         /**
@@ -69,6 +96,12 @@ namespace spark::core
          */
         virtual void onUpdate(float dt) { SPARK_UNUSED(dt); }
 
+        /**
+         * \brief Checks if \ref onUpdate can run concurrently with the update of other GameObjects. See \ref SPARK_THREAD_SAFE_UPDATE.
+         * \return `true` if the update is thread-safe, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool hasThreadSafeUpdate() const { return false; }
+
         /**
          * \brief Method called when the component is detached from a GameObject.
          */
@@ -77,6 +110,7 @@ namespace spark::core
     private:
         lib::Uuid m_uuid;
         GameObject* m_gameObject = nullptr;
+        std::size_t m_poolIndex = 0;
     };
 }
 
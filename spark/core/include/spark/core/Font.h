@@ -0,0 +1,96 @@
+#pragma once
+
+#include "spark/core/Export.h"
+#include "spark/core/TextureAtlas.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Vector2.h"
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace spark::core
+{
+    /**
+     * \brief The glyphs of a text placed by \ref Font::layout, in units of the font size.
+     *
+     * Since the layout does not depend on the size of the text, it can be computed once and drawn at any size by scaling it.
+     */
+    struct TextLayout
+    {
+        /**
+         * \brief A glyph of the text.
+         */
+        struct Glyph
+        {
+            /// \brief The signed distance field of the glyph in the atlas of the font.
+            const AtlasRegion* texture = nullptr;
+
+            /// \brief The position of the top-left corner of the glyph, from the top-left corner of the text.
+            math::Vector2<float> position;
+
+            /// \brief The size of the glyph.
+            math::Vector2<float> size;
+        };
+
+        /// \brief The visible glyphs of the text, the whitespaces only move the next ones.
+        std::vector<Glyph> glyphs;
+
+        /// \brief The size of the box around all the lines of the text.
+        math::Vector2<float> size;
+    };
+
+    /**
+     * \brief A TrueType font, rendered as signed distance fields in a \ref TextureAtlas.
+     *
+     * The glyphs of the ASCII and Latin-1 characters are rendered once when the font is loaded. Each glyph stores the distance to its outline in the alpha
+     * channel of the atlas (0.5 on the outline), which keeps sharp edges at any size once thresholded by the fragment shader. The other characters are
+     * replaced by a question mark.
+     */
+    class SPARK_CORE_EXPORT Font final
+    {
+    public:
+        /**
+         * \brief Loads a font and renders its glyphs in \p atlas.
+         * \param path The path of the TrueType (.ttf) or OpenType (.otf) font file.
+         * \param atlas The atlas to render the glyphs in. It must outlive the font.
+         * \param glyph_size The height of the glyphs rendered in the atlas, in pixels. Must be greater than zero.
+         * \param spread The distance from the outline covered by the distance fields, in pixels. Must be greater than zero.
+         *
+         * \throws base::CouldNotOpenFileException If the font file cannot be read.
+         * \throws base::BadArgumentException If the file is not a valid font, or if \p glyph_size or \p spread is zero.
+         */
+        explicit Font(const std::filesystem::path& path, TextureAtlas& atlas, unsigned glyph_size = 48, unsigned spread = 6);
+        ~Font();
+
+        Font(const Font& other) = delete;
+        Font(Font&& other) noexcept = delete;
+        Font& operator=(const Font& other) = delete;
+        Font& operator=(Font&& other) noexcept = delete;
+
+        /**
+         * \brief Places the glyphs of a text, with the kerning of the font.
+         * \param text The UTF-8 text to layout. Lines are separated by `\n`.
+         * \return The \ref TextLayout of the text, for a font size of 1.
+         */
+        [[nodiscard]] TextLayout layout(std::string_view text) const;
+
+        /**
+         * \brief Gets the distance between the baselines of two lines.
+         * \return The line height, for a font size of 1.
+         */
+        [[nodiscard]] float lineHeight() const noexcept;
+
+    private:
+        struct Impl;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::unique_ptr<...>' needs to have dll-interface to be used by clients of class 'spark::core::Font'
+
+        std::unique_ptr<Impl> m_impl;
+
+        SPARK_WARNING_POP
+    };
+}
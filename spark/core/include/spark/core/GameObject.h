@@ -20,7 +20,8 @@ namespace spark::core
     /**
      * \brief A GameObject is any object in the game. It contains a list of components that provides functionality to the GameObject.
      *
-     * GameObjects can be parented to other GameObjects. When a GameObject is destroyed, all its children are destroyed as well with their components.
+     * GameObjects can be parented to other GameObjects, and moved to another parent (even in another Scene) with \ref setParent. When a GameObject is
+     * destroyed, all its children are destroyed as well with their components.
      */
     class SPARK_CORE_EXPORT GameObject : public rtti::HasRtti, public details::AbstractGameObject<GameObject>
     {
@@ -45,6 +46,8 @@ namespace spark::core
          * \brief Destroys the current GameObject and all its children from the current scene.
          * \param object The object to destroy.
          * \param immediate `true` to destroy the object immediately, `false` to destroy it at the end of the frame. Default is `false`.
+         *
+         * \note When called from the parallel update phase of a Scene, the destruction only happens at the end of the phase.
          */
         static void Destroy(GameObject* object, bool immediate = false);
 
@@ -97,6 +100,12 @@ namespace spark::core
          */
         [[nodiscard]] components::Transform* transform() const;
 
+        /**
+         * \brief Gets the Scene the tree of the GameObject belongs to.
+         * \return A pointer to the Scene, or `nullptr` if the tree is not in a Scene.
+         */
+        [[nodiscard]] Scene* scene() const;
+
         /**
          * \brief Adds a component to the GameObject.
          * \param component A pointer to the component to add.
@@ -109,6 +118,8 @@ namespace spark::core
          * \tparam T The type of component to add.
          * \tparam Args The types of the arguments to pass to the constructor of the component.
          * \param args The arguments to pass to the constructor of the component.
+         *
+         * \details The component is created in the pool of its type, shared by all the GameObjects of the same tree. It is managed by the GameObject.
          */
         template <typename T, typename... Args> requires std::is_base_of_v<Component, T>
         void addComponent(Args&&... args);
@@ -116,6 +127,10 @@ namespace spark::core
         /**
          * \brief Removes a component from the GameObject.
          * \param component A pointer to the component to remove.
+         *
+         * \details The component is detached immediately, and is not found nor updated anymore. If it is managed by the GameObject, it is destroyed at
+         * the end of the frame, with the GameObjects destroyed by \ref Destroy. A component can therefore remove itself or another component of its
+         * GameObject while it is updated.
          */
         void removeComponent(Component* component);
 
@@ -183,6 +198,12 @@ namespace spark::core
          */
         virtual void onUpdate(float dt) { SPARK_UNUSED(dt); }
 
+        /**
+         * \brief Checks if \ref onUpdate can run concurrently with the update of other GameObjects. See \ref SPARK_THREAD_SAFE_UPDATE.
+         * \return `true` if the update is thread-safe, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool hasThreadSafeUpdate() const { return false; }
+
         /**
          * \brief Method called when the GameObject is destroyed.
          */
@@ -194,9 +215,27 @@ namespace spark::core
          */
         bool isShown = true;
 
+    protected:
+        /**
+         * \brief Marks the transform of the GameObject as outdated, since it now depends on the transform of another parent.
+         * \param old_parent The previous parent of the GameObject.
+         */
+        void onParentChanged(GameObject* old_parent) override;
+
+    private:
+        /**
+         * \brief Registers a component in the GameObject and in the pool of its type.
+         * \param component A pointer to the component to register.
+         * \param pool The pool to register the component into.
+         * \param managed `true` if the component is destroyed with the GameObject, `false` otherwise.
+         * \param pooled `true` if the component memory is owned by \p pool, `false` otherwise.
+         */
+        void attachComponent(Component* component, details::ComponentPool& pool, bool managed, bool pooled);
+
     private:
         lib::Uuid m_uuid;
         std::string m_name;
+        components::Transform* m_transform = nullptr;
     };
 }
 
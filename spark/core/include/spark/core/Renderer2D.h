@@ -1,18 +1,83 @@
 #pragma once
 
+#include "spark/core/Font.h"
+#include "spark/core/TextureAtlas.h"
+
 #include "spark/math/Vector2.h"
 #include "spark/render/CommandBuffer.h"
+#include "spark/render/DescriptorSet.h"
+#include "spark/render/GpuProfiler.h"
+#include "spark/render/RenderGraph.h"
 #include "spark/render/Scissor.h"
+#include "spark/render/UploadManager.h"
 #include "spark/render/Viewport.h"
 
 #include "glm/matrix.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spark::jobs
+{
+    class JobSystem;
+}
 
 namespace spark::core
 {
+    /**
+     * \brief The layout of the instances sent to the GPU by a \ref Renderer2D.
+     */
+    enum class InstanceFormat
+    {
+        /// \brief A 4x4 transformation matrix and a color of 4 floats per instance. Keeps the depth of the transformations.
+        Full,
+
+        /// \brief A 3x2 affine transformation matrix, an RGBA8 color and 16 bits texture coordinates per instance, less than half of the size of \ref Full.
+        /// Only keeps the 2D part of the transformations. Needs the `2d_compact_vert.spv` shader.
+        Compact
+    };
+
+    /**
+     * \brief The number of instances drawn during a frame of a \ref Renderer2D.
+     */
+    struct RenderStatistics
+    {
+        /// \brief The number of instances sent to the GPU.
+        unsigned submitted = 0;
+
+        /// \brief The number of instances skipped because they were outside of the viewport. The static instances culled on the GPU are not counted.
+        unsigned culled = 0;
+
+        /// \brief The number of instances of the static batch given to the GPU, including the hidden ones and the ones culled on the GPU.
+        unsigned statics = 0;
+
+        /// \brief The number of instance batches drawn, the culled ones excluded.
+        unsigned batches = 0;
+
+        /// \brief The number of instances of the static batch and of the instance batches rewritten because they changed.
+        unsigned staticUpdates = 0;
+
+        /// \brief The number of command buffers and command pools allocated by the graphics queue since the previous frame, 0 once they are all recycled.
+        unsigned commandBufferAllocations = 0;
+    };
+
+    /**
+     * \brief Identifies an instance of the static batch of a \ref Renderer2D.
+     */
+    using StaticInstance = unsigned;
+
+    /**
+     * \brief Identifies an instance batch of a \ref Renderer2D.
+     */
+    using InstanceBatch = unsigned;
+
     /**
      * \brief An object that can render 2D graphics on a surface.
      * \tparam Backend The backend to use for rendering. Must be a subclass of \ref render::RenderBackend.
@@ -37,11 +102,14 @@ namespace spark::core
         using shader_module_type = typename shader_program_type::shader_module_type;
         using input_assembler_type = typename backend_type::input_assembler_type;
         using rasterizer_type = typename backend_type::rasterizer_type;
+        using compute_pipeline_type = typename backend_type::compute_pipeline_type;
         using factory_type = typename device_type::factory_type;
         using vertex_buffer_layout_type = typename factory_type::vertex_buffer_layout_type;
         using vertex_buffer_type = typename factory_type::vertex_buffer_type;
         using index_buffer_layout_type = typename factory_type::index_buffer_layout_type;
         using index_buffer_type = typename factory_type::index_buffer_type;
+        using image_type = typename factory_type::image_type;
+        using sampler_type = typename factory_type::sampler_type;
 
     public:
         /**
@@ -49,10 +117,31 @@ namespace spark::core
          * \param render_area The size of the area to render to.
          * \param surface_factory A factory function that creates a raw surface handle from a raw device handle.
          * \param required_extensions The list of extensions that the renderer backend requires.
+         * \param frames_in_flight The number of frames the CPU can prepare while the GPU is still drawing the previous ones. Must be greater than zero.
+         * \param instance_format The layout of the instances sent to the GPU.
+         *
+         * The pipelines compiled by the previous runs are loaded from \ref PipelineCacheDirectory, and the cache is saved there when the renderer is destroyed.
          */
         explicit Renderer2D(const math::Vector2<unsigned>& render_area,
                             std::function<typename surface_type::handle_type(const typename backend_type::handle_type&)> surface_factory,
-                            std::span<std::string> required_extensions);
+                            std::span<std::string> required_extensions,
+                            unsigned frames_in_flight = 2,
+                            InstanceFormat instance_format = InstanceFormat::Full);
+
+        /**
+         * \brief Creates a new headless 2D renderer, which draws to offscreen images instead of a surface.
+         * \param render_area The size of the area to render to.
+         * \param required_extensions The list of extensions that the renderer backend requires.
+         * \param frames_in_flight The number of frames the CPU can prepare while the GPU is still drawing the previous ones. Must be greater than zero.
+         * \param instance_format The layout of the instances sent to the GPU.
+         *
+         * It needs neither a window nor presentation support, so that it runs on machines without display or with a software implementation of the
+         * backend (lavapipe, SwiftShader). The drawn frames can be read with \ref readBack().
+         */
+        explicit Renderer2D(const math::Vector2<unsigned>& render_area,
+                            std::span<std::string> required_extensions = {},
+                            unsigned frames_in_flight = 2,
+                            InstanceFormat instance_format = InstanceFormat::Full);
 
         ~Renderer2D();
 
@@ -61,21 +150,76 @@ namespace spark::core
         Renderer2D& operator=(const Renderer2D& other) = delete;
         Renderer2D& operator=(Renderer2D&& other) noexcept = delete;
 
+        /**
+         * \brief Gets the directory where the renderers keep the pipelines compiled by the driver, to skip their compilation at the next startup.
+         * \return The `cache` directory next to the executable.
+         */
+        [[nodiscard]] static std::filesystem::path PipelineCacheDirectory();
+
         /**
          * \brief Recreates the swap chain with frame buffers of the new \p size.
          * \param new_size The new size of the render area.
          */
         void recreateSwapChain(const math::Vector2<unsigned>& new_size);
 
+        /**
+         * \brief Gets the number of frames the CPU can prepare while the GPU is still drawing the previous ones.
+         * \return The number of frames in flight.
+         */
+        [[nodiscard]] unsigned framesInFlight() const noexcept;
+
+        /**
+         * \brief Gets the layout of the instances sent to the GPU.
+         * \return The \ref InstanceFormat of the renderer.
+         */
+        [[nodiscard]] InstanceFormat instanceFormat() const noexcept;
+
+        /**
+         * \brief Gets the number of bytes sent to the GPU for each drawn instance.
+         * \return The size of an instance in the instance buffers, including the alignment required by the device.
+         */
+        [[nodiscard]] std::size_t instanceSize() const noexcept;
+
+        /**
+         * \brief Gets the number of instances drawn and culled during the last rendered frame.
+         * \return The \ref RenderStatistics of the last call to \ref render.
+         */
+        [[nodiscard]] const RenderStatistics& statistics() const noexcept;
+
+        /**
+         * \brief Gets the GPU profiler measuring the passes of the render graph.
+         * \return The \ref render::IGpuProfiler of the device, whose results are the GPU time and pipeline statistics of each pass a few frames ago.
+         */
+        [[nodiscard]] const render::IGpuProfiler& profiler() const noexcept;
+
         /**
          * \brief Draws the current frame.
+         *
+         * The frame is submitted to the GPU without waiting for it to be drawn. The CPU only waits when it starts drawing a frame while the GPU is still
+         * drawing the frame which used the same resources, \ref framesInFlight() frames before.
          */
         void render();
 
+        /**
+         * \brief Reads the last frame drawn by a headless renderer back to the CPU, waiting for it to be finished.
+         * \return The pixels of the frame, row by row without padding, in the B8G8R8A8_UNORM format.
+         *
+         * \throws base::BadArgumentException If the renderer is not headless, since the presented frames cannot be read.
+         */
+        [[nodiscard]] std::vector<std::byte> readBack() const;
+
+        /**
+         * \brief Sets the job system recording the independent passes of the render graph in parallel, each one into its own command buffer.
+         * \param job_system A pointer to the job system, or `nullptr` to record every pass on the calling thread.
+         */
+        void setJobSystem(jobs::JobSystem* job_system) noexcept;
+
         /**
          * \brief Draws a 1x1 quad with the given @p transformation_matrix.
          * \param transform_matrix The 4x4 matrix describing the transformation of the 1x1 quad into the final world space.
          * \param color The color of the quad. Defaults to white.
+         *
+         * Like every drawn instance, the quad is skipped if its bounds in world space are outside of the viewport.
          */
         void drawQuad(const glm::mat4& transform_matrix, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
 
@@ -91,12 +235,192 @@ namespace spark::core
          */
         void drawCircle(const glm::mat4& transform_matrix, float radius, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
 
+        /**
+         * \brief Draws a 1x1 quad with the given 2D affine @p transform_matrix.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad: its columns are the X axis, the Y axis and the translation.
+         * \param color The color of the quad. Defaults to white.
+         *
+         * This avoids building a 4x4 matrix on the CPU, and is written as is with \ref InstanceFormat::Compact.
+         */
+        void drawQuad(const glm::mat3x2& transform_matrix, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
+
+        /**
+         * \brief Draws a circle with the given 2D affine @p transformation_matrix and @p radius.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the circle: its columns are the X axis, the Y axis and the translation.
+         * \param radius The desired radius of the circle.
+         * \param color The color of the circle. Defaults to white.
+         *
+         * This avoids building a 4x4 matrix on the CPU, and is written as is with \ref InstanceFormat::Compact.
+         */
+        void drawCircle(const glm::mat3x2& transform_matrix, float radius, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
+
+        /**
+         * \brief Loads an image into the texture atlas of the renderer, or gets it if it was already loaded.
+         * \param path The path of the image file.
+         * \return The region of the texture in the atlas, to pass to \ref drawSprite.
+         *
+         * The modified pages of the atlas are uploaded to the GPU at the start of the next \ref render, into new textures so that the frames in flight keep
+         * sampling the previous ones. Since a modified page is uploaded whole, textures should still be loaded when loading a scene rather than every frame.
+         */
+        const AtlasRegion& loadTexture(const std::filesystem::path& path);
+
+        /**
+         * \brief Gets the texture atlas of the renderer, for example to add generated textures.
+         * \return The \ref TextureAtlas holding all the textures of the sprites.
+         */
+        [[nodiscard]] TextureAtlas& textureAtlas() noexcept;
+
+        /**
+         * \brief Draws a 1x1 quad with the given @p transformation_matrix, filled with a texture of the atlas.
+         * \param transform_matrix The 4x4 matrix describing the transformation of the 1x1 quad into the final world space.
+         * \param texture The region of the texture in the atlas of this renderer.
+         * \param color The color multiplied with the texture. Defaults to white.
+         *
+         * Sprites are drawn in the same batch as the quads and circles, whatever their texture. Fully transparent pixels of the texture are discarded.
+         */
+        void drawSprite(const glm::mat4& transform_matrix, const AtlasRegion& texture, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
+
+        /**
+         * \brief Draws a 1x1 quad with the given 2D affine @p transform_matrix, filled with a texture of the atlas.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad: its columns are the X axis, the Y axis and the translation.
+         * \param texture The region of the texture in the atlas of this renderer.
+         * \param color The color multiplied with the texture. Defaults to white.
+         */
+        void drawSprite(const glm::mat3x2& transform_matrix, const AtlasRegion& texture, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
+
+        /**
+         * \brief Loads a font and renders its glyphs into the texture atlas of the renderer, or gets it if it was already loaded.
+         * \param path The path of the font file.
+         * \return The \ref Font, to layout the texts passed to \ref drawText. It stays valid as long as the renderer.
+         *
+         * Like \ref loadTexture, fonts should be loaded when loading a scene, not while drawing.
+         */
+        const Font& loadFont(const std::filesystem::path& path);
+
+        /**
+         * \brief Draws the glyphs of a text laid out by a font of this renderer.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the layout, including the font size: its columns are the X axis, the Y axis and
+         * the position of the top-left corner of the text.
+         * \param layout The glyphs to draw, from \ref Font::layout.
+         * \param color The color of the text. Defaults to white.
+         *
+         * Each glyph is an instance in the same batch as the quads, sampling its signed distance field in the atlas.
+         */
+        void drawText(const glm::mat3x2& transform_matrix, const TextLayout& layout, const spark::math::Vector4<float>& color = {1.f, 1.f, 1.f, 1.f});
+
+        /**
+         * \brief Adds an instance to the static batch, which keeps it on the GPU across frames.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad: its columns are the X axis, the Y axis and the translation.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance in the atlas of this renderer, or `nullptr` if it is not textured.
+         * \param visible `false` to add the instance hidden.
+         * \return The identifier of the instance, to update or remove it.
+         *
+         * The instances of the static batch are drawn every frame before the instances drawn during the frame. They are only written to the GPU when they
+         * are added or changed, which suits the objects that rarely move, like walls or tiles. They are culled on the GPU by a compute pass, which writes the
+         * visible ones and the number of instances to draw, so that the CPU does not spend any time on them whatever their number.
+         *
+         * \throws base::ArgumentOutOfRangeException If the static batch is full.
+         */
+        StaticInstance addStatic(const glm::mat3x2& transform_matrix,
+                                 const spark::math::Vector4<float>& color,
+                                 float radius = 0.f,
+                                 const AtlasRegion* texture = nullptr,
+                                 bool visible = true);
+
+        /**
+         * \brief Updates an instance of the static batch, which is only written to the GPU if it changed.
+         * \param instance The identifier of the instance, returned by \ref addStatic.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad: its columns are the X axis, the Y axis and the translation.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance in the atlas of this renderer, or `nullptr` if it is not textured.
+         * \param visible `false` to hide the instance.
+         *
+         * \throws base::ArgumentOutOfRangeException If the instance does not exist or was removed.
+         */
+        void updateStatic(StaticInstance instance,
+                          const glm::mat3x2& transform_matrix,
+                          const spark::math::Vector4<float>& color,
+                          float radius = 0.f,
+                          const AtlasRegion* texture = nullptr,
+                          bool visible = true);
+
+        /**
+         * \brief Removes an instance from the static batch. Its identifier can be returned again by \ref addStatic.
+         * \param instance The identifier of the instance, returned by \ref addStatic.
+         *
+         * \throws base::ArgumentOutOfRangeException If the instance does not exist or was already removed.
+         */
+        void removeStatic(StaticInstance instance);
+
+        /**
+         * \brief Creates an instance batch, which keeps a fixed number of instances on the GPU across frames like the static batch.
+         * \param capacity The number of instances of the batch, which are all hidden until updated. Must be greater than zero.
+         * \return The identifier of the batch, to update, draw or destroy it.
+         *
+         * Unlike the static batch, a batch is only drawn during the frames it is passed to \ref drawBatch, and is culled as a whole. It suits the groups of
+         * objects close to each other which rarely change, like the chunks of a tilemap.
+         *
+         * \throws base::BadArgumentException If \p capacity is zero or greater than the maximum number of instances.
+         */
+        InstanceBatch createBatch(unsigned capacity);
+
+        /**
+         * \brief Updates an instance of a batch, which is only written to the GPU if it changed.
+         * \param batch The identifier of the batch, returned by \ref createBatch.
+         * \param instance The index of the instance in the batch.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad: its columns are the X axis, the Y axis and the translation.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance in the atlas of this renderer, or `nullptr` if it is not textured.
+         * \param visible `false` to hide the instance.
+         *
+         * \throws base::ArgumentOutOfRangeException If the batch or the instance does not exist.
+         */
+        void updateBatch(InstanceBatch batch,
+                         unsigned instance,
+                         const glm::mat3x2& transform_matrix,
+                         const spark::math::Vector4<float>& color,
+                         float radius = 0.f,
+                         const AtlasRegion* texture = nullptr,
+                         bool visible = true);
+
+        /**
+         * \brief Draws a batch during the current frame, unless its bounds are outside of the viewport.
+         * \param batch The identifier of the batch, returned by \ref createBatch.
+         * \param bounds The 3x2 matrix of the 1x1 quad covering all the instances of the batch, to cull it.
+         *
+         * \throws base::ArgumentOutOfRangeException If the batch does not exist.
+         */
+        void drawBatch(InstanceBatch batch, const glm::mat3x2& bounds);
+
+        /**
+         * \brief Destroys a batch. Its GPU buffers are released once the frames in flight do not use them anymore.
+         * \param batch The identifier of the batch, returned by \ref createBatch. It can be returned again by \ref createBatch.
+         *
+         * \throws base::ArgumentOutOfRangeException If the batch does not exist.
+         */
+        void destroyBatch(InstanceBatch batch);
+
     private:
         /**
          * \brief Init the geometry and render graph.
          */
         void initRenderGraph();
 
+        /**
+         * \brief Records a part of the instances of the frame: the static instances, the drawn batches, then the instances drawn during the frame.
+         *
+         * The instances are shared evenly between the parts, in order, so that executing the parts one after another draws the instances in the same
+         * order as a single command buffer. When they are culled on the GPU, the static instances are drawn by the first part with an indirect draw, since
+         * their number is only known by the GPU.
+         * \param command_buffer The command buffer of the part of the geometry pass.
+         * \param part The index of the part, between 0 and \ref s_geometryParts.
+         */
+        void recordGeometry(const render::ICommandBuffer& command_buffer, std::size_t part);
+
         /**
          * \brief Calculates the new camera and updates the camera buffer.
          * \param command_buffer The command buffer to use for the update.
@@ -104,9 +428,87 @@ namespace spark::core
         void updateCamera(const render::ICommandBuffer& command_buffer);
 
         /**
-         * \brief Uploads the current vertices and indices to the GPU.
+         * \brief Uploads the pages of the texture atlas modified since the last frame into new textures, and binds them.
+         *
+         * The replaced textures and binding are retired with the resources of the current frame, since the frames in flight may still sample them.
          */
-        void upload();
+        void uploadTextureAtlas();
+
+        /**
+         * \brief Writes an instance in the current frame, in the format of the renderer, unless it is outside of the viewport.
+         * \param transform_matrix The 4x4 matrix describing the transformation of the instance.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance, or `nullptr` if it is not textured.
+         * \param is_distance_field `true` if the texture is a signed distance field in its alpha channel, `false` if it is a color texture.
+         */
+        void drawInstance(const glm::mat4& transform_matrix, const spark::math::Vector4<float>& color, float radius, const AtlasRegion* texture, bool is_distance_field = false);
+
+        /**
+         * \brief Writes an instance in the current frame, in the format of the renderer, unless it is outside of the viewport.
+         * \param transform_matrix The 3x2 affine matrix describing the transformation of the instance.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance, or `nullptr` if it is not textured.
+         * \param is_distance_field `true` if the texture is a signed distance field in its alpha channel, `false` if it is a color texture.
+         */
+        void drawInstance(const glm::mat3x2& transform_matrix, const spark::math::Vector4<float>& color, float radius, const AtlasRegion* texture, bool is_distance_field = false);
+
+        /**
+         * \brief Writes an instance in the format of the renderer.
+         * \param memory The memory of the instance.
+         * \param transform_matrix The 4x4 matrix describing the transformation of the instance.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance, or `nullptr` if it is not textured.
+         * \param is_distance_field `true` if the texture is a signed distance field in its alpha channel, `false` if it is a color texture.
+         */
+        void writeInstance(void* memory,
+                           const glm::mat4& transform_matrix,
+                           const spark::math::Vector4<float>& color,
+                           float radius,
+                           const AtlasRegion* texture,
+                           bool is_distance_field) const;
+
+        /**
+         * \brief Writes an instance in the format of the renderer.
+         * \param memory The memory of the instance.
+         * \param transform_matrix The 3x2 affine matrix describing the transformation of the instance.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance, or `nullptr` if it is not textured.
+         * \param is_distance_field `true` if the texture is a signed distance field in its alpha channel, `false` if it is a color texture.
+         */
+        void writeInstance(void* memory,
+                           const glm::mat3x2& transform_matrix,
+                           const spark::math::Vector4<float>& color,
+                           float radius,
+                           const AtlasRegion* texture,
+                           bool is_distance_field) const;
+
+        /**
+         * \brief Packs a color of 4 floats between 0 and 1 into 8 bits per channel, red in the lowest byte.
+         * \param color The color to pack.
+         * \return The packed RGBA8 color.
+         */
+        [[nodiscard]] static std::uint32_t PackColor(const spark::math::Vector4<float>& color) noexcept;
+
+        /**
+         * \brief Packs texture coordinates between 0 and 1 into 16 bits per coordinate, x in the lowest bits.
+         * \param u The horizontal texture coordinate.
+         * \param v The vertical texture coordinate.
+         * \return The packed texture coordinates.
+         */
+        [[nodiscard]] static std::uint32_t PackUv(float u, float v) noexcept;
+
+        /**
+         * \brief Tests if a transformed 1x1 quad overlaps the area seen by the camera, from its bounds in world space.
+         * \param x_axis The X axis of the transformation of the quad.
+         * \param y_axis The Y axis of the transformation of the quad.
+         * \param center The translation of the transformation of the quad, which is its center.
+         * \return `true` if the quad may be visible, `false` if it is outside of the viewport.
+         */
+        [[nodiscard]] bool isVisible(const glm::vec2& x_axis, const glm::vec2& y_axis, const glm::vec2& center) const noexcept;
 
     private:
         inline static constexpr std::array s_rectangleVertices = {
@@ -120,25 +522,252 @@ namespace spark::core
 
         device_type* m_device;
         std::unique_ptr<backend_type> m_renderBackend;
+        std::unique_ptr<render::UploadManager> m_uploads;
         std::shared_ptr<input_assembler_type> m_inputAssembler;
         std::unique_ptr<render::IViewport> m_viewport;
         std::unique_ptr<render::IScissor> m_scissor;
-        std::vector<std::size_t> m_transferFences;
+        glm::vec2 m_visibleArea = glm::vec2(0.f);
+        unsigned m_framesInFlight;
+        InstanceFormat m_instanceFormat;
 
         SPARK_WARNING_PUSH
         SPARK_DISABLE_MSVC_WARNING(4324) // 'InstanceBuffer': structure was padded due to alignment specifier. This is intended to align the CPU buffer to GPU one.
 
+        // Must match the `InstanceData` structure of the `2d_vert` and `2d_cull_comp` shaders, which is aligned on its `float4` members
         struct alignas(sizeof(glm::vec4)) InstanceBuffer
         {
             glm::mat4 transform;
             glm::vec4 color;
+            glm::vec4 uv;
+            float radius;
+            std::uint32_t texture;
+        };
+
+        SPARK_WARNING_POP
+
+        static_assert(sizeof(InstanceBuffer) == 112, "The instances must have the layout of the `InstanceData` structure of the shaders");
+
+        // Must match the `CompactInstanceData` structure of the `2d_compact_vert` shader, which is aligned on its `float2` members
+        struct alignas(sizeof(glm::vec2)) CompactInstanceBuffer
+        {
+            glm::vec2 xAxis;
+            glm::vec2 yAxis;
+            glm::vec2 translation;
+            std::uint32_t color;
             float radius;
+            std::uint32_t uvMin;
+            std::uint32_t uvMax;
+            std::uint32_t texture;
         };
 
+        static_assert(sizeof(CompactInstanceBuffer) == 48, "The compact instances must stay tightly packed");
+
+        // Must match the `DrawArguments` structure of the `2d_cull_comp` shader, which is read as a VkDrawIndexedIndirectCommand
+        struct DrawArguments
+        {
+            std::uint32_t indexCount = 0;
+            std::uint32_t instanceCount = 0;
+            std::uint32_t firstIndex = 0;
+            std::int32_t vertexOffset = 0;
+            std::uint32_t firstInstance = 0;
+        };
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4324) // 'CullingData': structure was padded due to alignment specifier. This is intended to match the size of the push constants.
+
+        // Must match the `CullingData` push constants of the `2d_cull_comp` shader
+        struct alignas(sizeof(glm::vec4)) CullingData
+        {
+            glm::vec2 visibleArea;
+            std::uint32_t instances;
+            std::uint32_t pass;
+        };
+
+        // The passes of the `2d_cull_comp` shader, must match `COUNT_PASS` and `COMPACT_PASS`
+        inline static constexpr std::uint32_t s_countPass = 0;
+        inline static constexpr std::uint32_t s_compactPass = 1;
+
         SPARK_WARNING_POP
 
-        inline static constexpr std::size_t s_maxInstances = 1024 * 8;
-        std::vector<InstanceBuffer> m_instanceData;
+        // The texture index of the instances which are not textured, must match `NO_TEXTURE` in `2d_common.hlsli`
+        inline static constexpr std::uint32_t s_noTexture = std::numeric_limits<std::uint32_t>::max();
+
+        // The flag of the texture index of the instances sampling a distance field, must match `DISTANCE_FIELD` in `2d_common.hlsli`
+        inline static constexpr std::uint32_t s_distanceField = 0x80000000;
+
+        /**
+         * \brief Instances written directly into a persistently mapped buffer read by the GPU, which grows when it cannot hold more instances.
+         */
+        struct InstanceStream
+        {
+            std::unique_ptr<buffer_type> buffer;
+            std::unique_ptr<render::IDescriptorSet> binding;
+            std::byte* memory = nullptr;
+            std::size_t stride = 0;
+            unsigned capacity = 0;
+            unsigned count = 0;
+        };
+
+        /**
+         * \brief The resources of a frame culling the static instances on the GPU.
+         *
+         * The culling reads the copy of the static batch of the frame through \ref input, and compacts the visible instances into \ref visible through
+         * \ref output, in the order of the batch. A first pass counts the visible instances of each thread group in \ref groupCounts, so that the second
+         * one writes them after the ones of the previous groups and counts them in \ref arguments. The geometry pass then draws \ref visible through
+         * \ref visibleBinding with the counted instances.
+         */
+        struct StaticCulling
+        {
+            std::unique_ptr<buffer_type> visible;
+            std::unique_ptr<render::IDescriptorSet> visibleBinding;
+            std::unique_ptr<render::IDescriptorSet> input;
+            std::unique_ptr<render::IDescriptorSet> output;
+            std::unique_ptr<buffer_type> arguments;
+            std::unique_ptr<buffer_type> groupCounts;
+            std::unique_ptr<render::IDescriptorSet> argumentsBinding;
+            const buffer_type* source = nullptr;
+            unsigned capacity = 0;
+        };
+
+        /**
+         * \brief The resources of a frame in flight, used in turn by the frames.
+         *
+         * The instances drawn during the frame are written into \ref instances. The buffers of the destroyed batches used by the frame are kept in
+         * \ref retired, and the atlas pages and bindings replaced during the frame in \ref retiredPages and \ref retiredAtlasBindings. The resources are
+         * only written or released once the GPU reached the \ref fence of the last frame which used them.
+         */
+        struct FrameResources
+        {
+            InstanceStream instances;
+            StaticCulling culling;
+            std::vector<InstanceStream> retired;
+            std::vector<std::unique_ptr<image_type>> retiredPages;
+            std::vector<std::unique_ptr<render::IDescriptorSet>> retiredAtlasBindings;
+            std::size_t fence = 0;
+        };
+
+        /**
+         * \brief An instance kept across frames, as given to \ref addStatic or \ref updateBatch.
+         */
+        struct RetainedInstanceData
+        {
+            glm::mat3x2 transform = glm::mat3x2(0.f);
+            math::Vector4<float> color;
+            float radius = 0.f;
+            const AtlasRegion* texture = nullptr;
+            bool isVisible = false;
+
+            [[nodiscard]] bool operator==(const RetainedInstanceData& other) const = default;
+        };
+
+        /**
+         * \brief Instances kept across frames, of the static batch or of an instance batch.
+         *
+         * Each frame in flight keeps its copy of the instances in \ref streams, where only the instances listed in its \ref dirty list, or added since it
+         * last drew the batch, are written again.
+         */
+        struct RetainedBatch
+        {
+            std::vector<RetainedInstanceData> instances;
+            std::vector<InstanceStream> streams;
+            std::vector<std::vector<unsigned>> dirty;
+        };
+
+        /**
+         * \brief Gets the resources of the current frame, waiting for the GPU to release them the first time they are used during the frame.
+         * \return The resources of the current frame.
+         */
+        FrameResources& acquireFrame();
+
+        /**
+         * \brief Gets the memory of a new instance in the current frame.
+         * \return A pointer to the memory of the instance, or `nullptr` if the frame is full.
+         */
+        [[nodiscard]] void* nextInstance();
+
+        /**
+         * \brief Replaces the buffer of \p stream by a new one of \p capacity instances, keeping the instances already written.
+         * \param stream The instances to resize. The GPU must not be reading them.
+         * \param capacity The new number of instances the stream can hold.
+         */
+        void resizeInstances(InstanceStream& stream, unsigned capacity);
+
+        /**
+         * \brief Changes an instance of a retained batch, and marks it to be written again by every frame if it changed.
+         * \param batch The batch of the instance.
+         * \param instance The index of the instance in the batch.
+         * \param data The new instance.
+         */
+        void setRetained(RetainedBatch& batch, unsigned instance, const RetainedInstanceData& data);
+
+        /**
+         * \brief Writes the instances of a retained batch which changed since the current frame last drew it into its copy of the batch.
+         * \param batch The batch to write.
+         * \return The copy of the batch of the current frame.
+         */
+        InstanceStream& uploadRetained(RetainedBatch& batch);
+
+        /**
+         * \brief Culls the static instances of the current frame on the GPU, before the geometry pass draws the visible ones with an indirect draw.
+         * \param frame The resources of the current frame.
+         * \param statics The copy of the static batch of the current frame.
+         *
+         * The culling is recorded into its own command buffer, submitted before the render pass since dispatches cannot be recorded inside it.
+         */
+        void cullStatics(FrameResources& frame, const InstanceStream& statics);
+
+        /**
+         * \brief Gets an instance batch.
+         * \param batch The identifier of the batch.
+         * \return The batch.
+         *
+         * \throws base::ArgumentOutOfRangeException If the batch does not exist.
+         */
+        RetainedBatch& retainedBatch(InstanceBatch batch);
+
+        // The instances are bound as an unbounded array of descriptors, which is limited by the size of the descriptor set layout
+        inline static constexpr unsigned s_initialInstances = 1024;
+        inline static constexpr unsigned s_maxInstances = 104857;
+
+        // The geometry is recorded in parallel into several command buffers, each one only worth it for enough instances
+        inline static constexpr std::size_t s_geometryParts = 4;
+        inline static constexpr std::size_t s_minInstancesPerPart = 4096;
+
+        // The passes of a frame are ordered by the render graph, and each part of a pass is recorded into its own secondary command buffer of the
+        // render pass, which has its own command pool so that the parts can be recorded by different threads
+        render::RenderGraph m_renderGraph;
+        jobs::JobSystem* m_jobSystem = nullptr;
+        std::vector<const InstanceStream*> m_frameStreams;
+
+        std::vector<FrameResources> m_frames;
+        std::size_t m_currentFrame = 0;
+        unsigned m_lastBackBuffer = 0;
+        bool m_isFrameAcquired = false;
+        bool m_isFullWarningLogged = false;
+        RenderStatistics m_statistics;
+        RenderStatistics m_lastStatistics;
+        std::size_t m_commandBufferAllocations = 0;
+
+        // The removed static instances are hidden and their identifiers reused, they are culled on the GPU when the graphics queue supports compute shaders
+        RetainedBatch m_statics;
+        bool m_hasStaticCulling = false;
+        std::vector<StaticInstance> m_freeStatics;
+        std::vector<bool> m_isStaticAlive;
+
+        // The identifiers of the destroyed batches are reused, the batches drawn during the frame are listed in order
+        std::vector<std::unique_ptr<RetainedBatch>> m_batches;
+        std::vector<InstanceBatch> m_freeBatches;
+        std::vector<InstanceBatch> m_drawnBatches;
+
+        // The pages of the atlas are bound as an unbounded array of textures, indexed by the instances
+        TextureAtlas m_textureAtlas;
+        std::vector<std::unique_ptr<image_type>> m_atlasPages;
+        std::unique_ptr<sampler_type> m_atlasSampler;
+        std::unique_ptr<render::IDescriptorSet> m_atlasBinding;
+        std::unique_ptr<render::IDescriptorSet> m_samplerBinding;
+
+        // The fonts render their glyphs in the texture atlas, so they are declared after it
+        std::unordered_map<std::string, std::unique_ptr<Font>> m_fonts;
     };
 }
 
@@ -1,12 +1,24 @@
 #pragma once
 
+#include "spark/core/CollisionWorld.h"
 #include "spark/core/Export.h"
 #include "spark/core/GameObject.h"
+#include "spark/core/View.h"
 
 #include "experimental/ser/SerializerScheme.h"
+#include "spark/base/Macros.h"
 #include "spark/lib/Uuid.h"
+#include "spark/patterns/DeferredCalls.h"
 #include "spark/rtti/HasRtti.h"
 
+#include <memory>
+#include <vector>
+
+namespace spark::jobs
+{
+    class JobSystem;
+}
+
 namespace spark::core
 {
     class SPARK_CORE_EXPORT Scene final : public rtti::HasRtti
@@ -15,13 +27,17 @@ namespace spark::core
         SPARK_ALLOW_PRIVATE_SERIALIZATION
 
     public:
+        /**
+         * \brief Instantiates a new Scene, which owns a tree of GameObjects. It cannot be moved, since the GameObjects point to it.
+         * \param scene_root The root of the tree.
+         */
         explicit Scene(GameObject* scene_root);
         ~Scene() override;
 
         Scene(const Scene& other) = delete;
-        Scene(Scene&& other) noexcept = default;
+        Scene(Scene&& other) noexcept = delete;
         Scene& operator=(const Scene& other) = delete;
-        Scene& operator=(Scene&& other) noexcept = default;
+        Scene& operator=(Scene&& other) noexcept = delete;
 
         /**
          * \brief Gets the UUID of the Scene.
@@ -35,6 +51,29 @@ namespace spark::core
          */
         [[nodiscard]] GameObject* root();
 
+        /**
+         * \brief Gets a view over all the GameObjects of the Scene having all the components \p T and \p Others.
+         * \tparam T The type of the component driving the iteration.
+         * \tparam Others The types of the other required components.
+         * \return A \ref View iterating linearly over the pool of \p T components.
+         *
+         * \details The components are matched on their exact type, a view of a base class does not yield the components of its derived classes.
+         */
+        template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+        [[nodiscard]] View<T, Others...> view() const;
+
+        /**
+         * \brief Gets the collision world detecting the collisions between the colliders of the Scene.
+         * \return A reference to the \ref CollisionWorld of the Scene.
+         */
+        [[nodiscard]] CollisionWorld& collisionWorld();
+
+        /**
+         * \brief Sets the job system used to run the parallel update phase of the Scene.
+         * \param job_system A pointer to the job system, or `nullptr` to update every GameObject on the calling thread.
+         */
+        void setJobSystem(jobs::JobSystem* job_system);
+
         /**
          * \brief Method called when the Scene is loaded.
          */
@@ -42,6 +81,15 @@ namespace spark::core
 
         /**
          * \brief Method called on every frame.
+         * \param dt The time in seconds since the last frame.
+         *
+         * When a job system is set, the update runs in two phases:
+         * - the parallel phase computes the outdated Transform matrices, then updates the GameObjects and components marked with
+         *   \ref SPARK_THREAD_SAFE_UPDATE, concurrently on the job system. Signal emissions and destructions requested during this phase are applied at
+         *   its end, in the order of the tree.
+         * - the serial phase then updates everything else on the calling thread, in the order of the tree.
+         *
+         * The collisions are then detected by the \ref CollisionWorld of the Scene.
          */
         void onUpdate(float dt);
 
@@ -55,11 +103,37 @@ namespace spark::core
          */
         void onUnload();
 
+    private:
+        /**
+         * \brief Runs the parallel and serial update phases described in \ref onUpdate.
+         * \param dt The time in seconds since the last frame.
+         */
+        void parallelUpdate(float dt);
+
+        /**
+         * \brief Gets the flat traversal order of the Scene tree, used by the per-frame passes to iterate over the GameObjects without allocating.
+         * \return A reference to the \ref details::TraversalOrder of the root.
+         */
+        [[nodiscard]] details::TraversalOrder& traversalOrder();
+
     private:
         lib::Uuid m_uuid;
         GameObject* m_root = nullptr;
         bool m_isLoaded = false;
+
+        jobs::JobSystem* m_jobSystem = nullptr;
+        std::unique_ptr<patterns::DeferredCalls> m_deferredCalls;
+        std::unique_ptr<CollisionWorld> m_collisionWorld;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::Scene'
+
+        std::vector<GameObject*> m_parallelObjects;
+
+        SPARK_WARNING_POP
     };
 }
 
 IMPLEMENT_SPARK_RTTI(spark::core::Scene)
+
+#include "spark/core/impl/Scene.h"
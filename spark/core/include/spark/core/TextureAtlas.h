@@ -0,0 +1,150 @@
+#pragma once
+
+#include "spark/core/Export.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Vector2.h"
+#include "spark/math/Vector4.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spark::core
+{
+    /**
+     * \brief The location of a texture packed in a \ref TextureAtlas.
+     */
+    struct AtlasRegion
+    {
+        /// \brief The index of the page holding the texture.
+        unsigned page = 0;
+
+        /// \brief The texture coordinates of the texture in its page, as (left, top, right, bottom) between 0 and 1.
+        math::Vector4<float> uv;
+
+        /// \brief The size of the texture, in pixels.
+        math::Vector2<unsigned> size;
+    };
+
+    /**
+     * \brief Packs textures into square pages of RGBA8 pixels, so that sprites using different textures can be drawn together.
+     *
+     * The textures are packed on shelves: each page is split in rows as high as the first texture placed in them, and a texture goes on the row wasting
+     * the least height. The border pixels of each texture are repeated around it, so that filtering never samples a neighbouring texture.
+     * Textures are only added, a page keeps the same content once a texture is placed in it.
+     */
+    class SPARK_CORE_EXPORT TextureAtlas final
+    {
+    public:
+        /**
+         * \brief Instantiates a new, empty, texture atlas.
+         * \param page_size The width and height of a page, in pixels. Must be greater than twice the \p padding.
+         * \param padding The number of pixels repeated around each texture.
+         */
+        explicit TextureAtlas(unsigned page_size = 2048, unsigned padding = 1);
+
+        /**
+         * \brief Loads an image file and adds it to the atlas, or gets it if it was already loaded.
+         * \param path The path of the image file. Any format supported by SFML can be used.
+         * \return The region of the texture in the atlas. It stays valid as long as the atlas.
+         *
+         * \throws base::CouldNotOpenFileException If the image cannot be loaded.
+         * \throws base::BadArgumentException If the image does not fit in a page.
+         */
+        const AtlasRegion& load(const std::filesystem::path& path);
+
+        /**
+         * \brief Adds a texture to the atlas.
+         * \param name The name used to find the texture.
+         * \param size The size of the texture, in pixels.
+         * \param pixels The RGBA8 pixels of the texture, row by row.
+         * \return The region of the texture in the atlas. It stays valid as long as the atlas.
+         *
+         * \throws base::BadArgumentException If a texture with the same name already exists, if the number of pixels does not match the size or if the texture
+         * does not fit in a page.
+         */
+        const AtlasRegion& add(const std::string& name, const math::Vector2<unsigned>& size, std::span<const std::uint8_t> pixels);
+
+        /**
+         * \brief Finds a texture of the atlas.
+         * \param name The name of the texture, or the generic path of a loaded image.
+         * \return A pointer to the region of the texture, or `nullptr` if there is no texture with this name.
+         */
+        [[nodiscard]] const AtlasRegion* find(const std::string& name) const;
+
+        /**
+         * \brief Gets the width and height of the pages.
+         * \return The size of a page, in pixels.
+         */
+        [[nodiscard]] unsigned pageSize() const noexcept;
+
+        /**
+         * \brief Gets the number of pages of the atlas.
+         * \return The number of pages.
+         */
+        [[nodiscard]] std::size_t pageCount() const noexcept;
+
+        /**
+         * \brief Gets the pixels of a page.
+         * \param page The index of the page.
+         * \return The RGBA8 pixels of the page, row by row.
+         */
+        [[nodiscard]] std::span<const std::uint8_t> pixels(std::size_t page) const;
+
+        /**
+         * \brief Gets the pages modified since the last call to \ref clearDirtyPages.
+         * \return The indices of the modified pages, in increasing order.
+         */
+        [[nodiscard]] std::vector<std::size_t> dirtyPages() const;
+
+        /**
+         * \brief Marks all the pages as up-to-date, for example once they were uploaded to the GPU.
+         */
+        void clearDirtyPages() noexcept;
+
+    private:
+        /**
+         * \brief A row of a page, filled from left to right.
+         */
+        struct Shelf
+        {
+            unsigned y = 0;
+            unsigned height = 0;
+            unsigned width = 0;
+        };
+
+        struct Page
+        {
+            std::vector<std::uint8_t> pixels;
+            std::vector<Shelf> shelves;
+            unsigned height = 0;
+            bool isDirty = true;
+        };
+
+        /**
+         * \brief Finds the position of a padded rectangle in the pages, creating a new page if none has enough space.
+         * \param width The width of the padded rectangle.
+         * \param height The height of the padded rectangle.
+         * \param page Set to the index of the page holding the rectangle.
+         * \return The top-left corner of the padded rectangle in the page.
+         */
+        math::Vector2<unsigned> allocate(unsigned width, unsigned height, std::size_t& page);
+
+    private:
+        unsigned m_pageSize;
+        unsigned m_padding;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::TextureAtlas'
+
+        std::vector<Page> m_pages;
+        std::unordered_map<std::string, AtlasRegion> m_regions;
+
+        SPARK_WARNING_POP
+    };
+}
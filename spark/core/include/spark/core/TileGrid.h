@@ -0,0 +1,135 @@
+#pragma once
+
+#include "spark/core/Export.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Rectangle.h"
+#include "spark/math/Vector2.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace spark::core
+{
+    /**
+     * \brief The identifier of the type of a tile in a \ref TileGrid.
+     */
+    using TileId = std::uint16_t;
+
+    /**
+     * \brief A dense 2D array of tiles, split in square chunks which track the tiles modified in them.
+     *
+     * The tiles are stored row by row in a single array. A chunk only lists the tiles modified since the last call to \ref clearDirtyTiles, so that the
+     * renderer only writes them again. All the tiles are modified when the grid is created.
+     */
+    class SPARK_CORE_EXPORT TileGrid final
+    {
+    public:
+        /**
+         * \brief Instantiates a new grid, filled with the tile 0.
+         * \param size The number of tiles of the grid, on each axis.
+         * \param chunk_size The number of tiles of a chunk, on each axis. Must be greater than zero.
+         *
+         * \throws base::BadArgumentException If \p chunk_size is zero.
+         */
+        explicit TileGrid(const math::Vector2<unsigned>& size = {0, 0}, unsigned chunk_size = 32);
+
+        /**
+         * \brief Gets the number of tiles of the grid.
+         * \return The number of tiles on each axis.
+         */
+        [[nodiscard]] const math::Vector2<unsigned>& size() const noexcept;
+
+        /**
+         * \brief Gets a tile.
+         * \param position The coordinates of the tile.
+         * \return The identifier of the tile.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p position is outside of the grid.
+         */
+        [[nodiscard]] TileId at(const math::Vector2<unsigned>& position) const;
+
+        /**
+         * \brief Changes a tile, which is marked as modified in its chunk if it changed.
+         * \param position The coordinates of the tile.
+         * \param tile The new identifier of the tile.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p position is outside of the grid.
+         */
+        void set(const math::Vector2<unsigned>& position, TileId tile);
+
+        /**
+         * \brief Changes all the tiles of the grid.
+         * \param tile The new identifier of the tiles.
+         */
+        void fill(TileId tile);
+
+        /**
+         * \brief Gets the number of tiles of a chunk, on each axis. The chunks on the right and bottom borders may be smaller.
+         * \return The size of the chunks.
+         */
+        [[nodiscard]] unsigned chunkSize() const noexcept;
+
+        /**
+         * \brief Gets the number of chunks of the grid.
+         * \return The number of chunks, stored row by row.
+         */
+        [[nodiscard]] std::size_t chunkCount() const noexcept;
+
+        /**
+         * \brief Gets the tiles covered by a chunk.
+         * \param chunk The index of the chunk.
+         * \return The coordinates of the top-left tile of the chunk and its number of tiles on each axis.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p chunk does not exist.
+         */
+        [[nodiscard]] math::Rectangle<unsigned> chunkTiles(std::size_t chunk) const;
+
+        /**
+         * \brief Gets the tiles of a chunk modified since the last call to \ref clearDirtyTiles.
+         * \param chunk The index of the chunk.
+         * \return The coordinates of the modified tiles, each listed once.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p chunk does not exist.
+         */
+        [[nodiscard]] std::span<const math::Vector2<unsigned>> dirtyTiles(std::size_t chunk) const;
+
+        /**
+         * \brief Marks all the tiles of a chunk as up-to-date, for example once they were written to the GPU.
+         * \param chunk The index of the chunk.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p chunk does not exist.
+         */
+        void clearDirtyTiles(std::size_t chunk);
+
+    private:
+        /**
+         * \brief Gets the index of the chunk holding a tile.
+         * \param position The coordinates of the tile, inside of the grid.
+         * \return The index of the chunk.
+         */
+        [[nodiscard]] std::size_t chunkOf(const math::Vector2<unsigned>& position) const noexcept;
+
+        /**
+         * \brief Marks a tile as modified in its chunk, if it is not already.
+         * \param position The coordinates of the tile, inside of the grid.
+         */
+        void markDirty(const math::Vector2<unsigned>& position);
+
+    private:
+        math::Vector2<unsigned> m_size;
+        unsigned m_chunkSize;
+        math::Vector2<unsigned> m_chunkCount;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::TileGrid'
+
+        std::vector<TileId> m_tiles;
+        std::vector<bool> m_isTileDirty;
+        std::vector<std::vector<math::Vector2<unsigned>>> m_dirtyTiles;
+
+        SPARK_WARNING_POP
+    };
+}
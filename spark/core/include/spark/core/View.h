@@ -0,0 +1,105 @@
+#pragma once
+
+#include "spark/core/Component.h"
+#include "spark/core/GameObject.h"
+#include "spark/core/details/ComponentStorage.h"
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+namespace spark::core
+{
+    /**
+     * \brief A view over all the GameObjects of a tree having every component in \p T and \p Others.
+     * \tparam T The type of the component driving the iteration. The view walks linearly through the pool of this type.
+     * \tparam Others The types of the other components a GameObject must have to be part of the view.
+     *
+     * Iterating the view yields a tuple of references to the components, in the same order as the template parameters:
+     * \code
+     * for (auto [transform, rectangle] : scene.view<components::Transform, components::Rectangle>())
+     *     ...
+     * \endcode
+     *
+     * The components are matched on their exact type, like \ref GameObject::component: the pools are keyed on the RTTI of the components, so a view of
+     * a base class does not yield the components of its derived classes.
+     *
+     * \note Adding or removing components of type \p T while iterating over the view invalidates it.
+     */
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    class View
+    {
+    public:
+        /**
+         * \brief An iterator over the components of a \ref View.
+         */
+        class Iterator
+        {
+        public:
+            using value_type = std::tuple<T&, Others&...>;
+            using difference_type = std::ptrdiff_t;
+
+        public:
+            Iterator() = default;
+
+            /**
+             * \brief Creates an iterator pointing to the first GameObject matching the view at or after \p index.
+             * \param components The dense array of components of type \p T.
+             * \param index The index to start from.
+             */
+            explicit Iterator(const std::vector<Component*>* components, std::size_t index);
+
+            value_type operator*() const;
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.m_index == rhs.m_index; }
+            friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+
+        private:
+            /**
+             * \brief Moves the iterator forward until it points to a GameObject having all the components of the view (or the end).
+             */
+            void settle();
+
+        private:
+            const std::vector<Component*>* m_components = nullptr;
+            std::size_t m_index = 0;
+            std::tuple<T*, Others*...> m_current;
+        };
+
+    public:
+        /**
+         * \brief Creates a view over the components stored in \p storage.
+         * \param storage The storage holding the pools of the components.
+         */
+        explicit View(const details::ComponentStorage& storage);
+
+        /**
+         * \brief Gets an iterator to the first GameObject matching the view.
+         * \return An \ref Iterator to the first element of the view.
+         */
+        [[nodiscard]] Iterator begin() const;
+
+        /**
+         * \brief Gets an iterator past the last GameObject matching the view.
+         * \return An \ref Iterator to the end of the view.
+         */
+        [[nodiscard]] Iterator end() const;
+
+        /**
+         * \brief Calls \p fn for each GameObject matching the view.
+         * \param fn A function taking a reference to each component of the view, in the same order as the template parameters.
+         */
+        template <typename Fn>
+        void each(Fn&& fn) const;
+
+    private:
+        inline static const std::vector<Component*> s_empty;
+        const std::vector<Component*>* m_components = &s_empty;
+    };
+}
+
+#include "spark/core/impl/View.h"
@@ -27,6 +27,8 @@ namespace spark::core
             spark::math::Vector2<unsigned int> size;
             std::function<void(events::Event&)> eventCallback;
             bool resizable;
+            unsigned int framesInFlight = 2;
+            InstanceFormat instanceFormat = InstanceFormat::Full;
         };
 
         /// \brief Event triggered when the window is resized.
@@ -2,6 +2,7 @@
 
 #include "spark/core/Application.h"
 #include "spark/core/components/Transform.h"
+#include "spark/core/details/RetainedInstance.h"
 
 #include "spark/math/Vector2.h"
 #include "spark/rtti/HasRtti.h"
@@ -18,6 +19,10 @@ namespace spark::core::components
     public:
         float radius = 25;
 
+        /// \brief `true` to keep the instance in the static batch of the renderer, for the objects that rarely change.
+        bool isStatic = false;
+        bool isVisible = true;
+
     public:
         /**
          * \brief Creates a new @link Circle circle component @endlink. Defaults to a radius of 25.
@@ -38,14 +43,23 @@ namespace spark::core::components
         {
             Component::render();
 
-            // Get the transform matrix for the circle
-            auto transform_matrix = gameObject()->transform()->matrix();
-            transform_matrix = glm::translate(transform_matrix, {radius, radius, 0.0f});
-            transform_matrix = glm::scale(transform_matrix, {radius * 2, radius * 2, 1.0f});
+            // Scale the centered 1x1 quad to the diameter of the circle and move its top-left corner to the origin, directly in 2D
+            const glm::mat4& matrix = gameObject()->transform()->matrix();
+            const glm::vec2 x_axis = glm::vec2(matrix[0]) * (radius * 2), y_axis = glm::vec2(matrix[1]) * (radius * 2);
+            const glm::mat3x2 transform_matrix(x_axis, y_axis, glm::vec2(matrix[3]) + (x_axis + y_axis) / 2.f);
 
             // Draw the circle
-            core::Application::Instance()->window().renderer().drawCircle(transform_matrix, radius);
+            m_instance.draw(transform_matrix, {1.f, 1.f, 1.f, 1.f}, radius, nullptr, isStatic, isVisible);
         }
+
+        void onDetach() override
+        {
+            m_instance.release();
+            Component::onDetach();
+        }
+
+    private:
+        mutable details::RetainedInstance m_instance;
     };
 }
 
@@ -1,17 +1,20 @@
 #pragma once
 
+#include "spark/core/CollisionWorld.h"
 #include "spark/core/Component.h"
 #include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
 #include "spark/core/components/Transform.h"
 
 #include "spark/math/Rectangle.h"
 #include "spark/math/Vector4.h"
 #include "spark/patterns/Signal.h"
-#include "spark/patterns/Traverser.h"
 #include "spark/rtti/HasRtti.h"
 
 #include "glm/gtc/matrix_transform.hpp"
 
+#include <cstdint>
+
 namespace spark::core::components
 {
     /**
@@ -22,8 +25,22 @@ namespace spark::core::components
     {
         DECLARE_SPARK_RTTI(Collider, Component)
         SPARK_ALLOW_PRIVATE_SERIALIZATION
+        friend class spark::core::CollisionWorld;
 
     public:
+        /**
+         * \brief Checks if two bounds, as returned by \ref bounds, are overlapping.
+         * \param lhs The bounds of the first collider.
+         * \param rhs The bounds of the second collider.
+         * \return `true` if the bounds are overlapping, `false` otherwise.
+         */
+        [[nodiscard]] static bool Overlaps(const math::Vector4<float>& lhs, const math::Vector4<float>& rhs)
+        {
+            // Check if the colliders are colliding using this formula:
+            //   - x1 <= x2 + w2 && x1 + w1 >= x2 && y1 <= y2 + h2 && y1 + h1 >= y2)
+            return lhs.x <= rhs.z && lhs.z >= rhs.x && lhs.y <= rhs.w && lhs.w >= rhs.y;
+        }
+
         /**
          * \brief Gets the bounds of the rectangle in screen space.
          * \return A @ref spark::math::Vector4<float> containing the bounds of the rectangle. [xMin, yMin, xMax, yMax]
@@ -48,14 +65,25 @@ namespace spark::core::components
          */
         [[nodiscard]] bool collidesWith(const Collider& other) const
         {
-            const math::Vector4<float> this_bounds = bounds();
-            const math::Vector4<float> other_bounds = other.bounds();
+            return Overlaps(bounds(), other.bounds());
+        }
 
-            // Check if the colliders are colliding using this formula:
-            //   - x1 <= x2 + w2 && x1 + w1 >= x2 && y1 <= y2 + h2 && y1 + h1 >= y2)
-            if (this_bounds.x <= other_bounds.z && this_bounds.z >= other_bounds.x && this_bounds.y <= other_bounds.w && this_bounds.w >= other_bounds.y)
-                return true;
-            return false;
+        /**
+         * \brief Registers the collider in the \ref CollisionWorld of the scene of its GameObject.
+         */
+        void onAttach() override
+        {
+            if (Scene* scene = gameObject()->scene())
+                scene->collisionWorld().add(this);
+        }
+
+        /**
+         * \brief Unregisters the collider from its \ref CollisionWorld.
+         */
+        void onDetach() override
+        {
+            if (m_collisionWorld)
+                m_collisionWorld->remove(this);
         }
 
     protected:
@@ -64,6 +92,8 @@ namespace spark::core::components
 
     private:
         math::Rectangle<float> m_rectangle;
+        CollisionWorld* m_collisionWorld = nullptr;
+        std::uint32_t m_collisionIndex = 0;
     };
 
     /**
@@ -89,7 +119,7 @@ namespace spark::core::components
         DECLARE_SPARK_RTTI(DynamicCollider, Collider)
 
     public:
-        /// \brief Signal emitted when a collision is detected.
+        /// \brief Signal emitted by the \ref CollisionWorld of the scene when a collision is detected, once all the GameObjects are updated.
         patterns::Signal<const Collider&> onCollision;
 
     public:
@@ -98,33 +128,6 @@ namespace spark::core::components
 
         explicit DynamicCollider(GameObject* parent, math::Rectangle<float> rectangle)
             : Collider(parent, std::move(rectangle)) {}
-
-        void onUpdate(float /*dt*/) override
-        {
-            // Check for collision with each collider and trigger the onCollision signal if a collision is detected
-            for (const auto* collider : allColliders())
-                if (collider != this)
-                    if (collidesWith(*collider))
-                        onCollision.emit(*collider);
-        }
-
-    private:
-        /**
-         * \brief Gets all colliders in the scene.
-         * \return A @ref std::vector of all colliders in the scene.
-         */
-        [[nodiscard]] std::vector<const Collider*> allColliders()
-        {
-            std::vector<const Collider*> colliders;
-            auto traverser = patterns::make_traverser<GameObject>([&](const GameObject* obj)
-            {
-                for (const auto* component : obj->components())
-                    if (&component->rttiInstance() == &StaticCollider::classRtti() || &component->rttiInstance() == &DynamicCollider::classRtti())
-                        colliders.push_back(static_cast<const Collider*>(component));
-            });
-            patterns::traverse_tree(gameObject()->root(), traverser);
-            return colliders;
-        }
     };
 }
 
@@ -1,19 +1,35 @@
 #pragma once
 
+#include "spark/core/Application.h"
 #include "spark/core/Component.h"
+#include "spark/core/components/Transform.h"
+#include "spark/core/details/RetainedInstance.h"
+
+#include "spark/math/Vector2.h"
+#include "spark/math/Vector4.h"
 
 #include <filesystem>
+#include <optional>
 
 namespace spark::core::components
 {
     /**
      * \brief A simple component to render an image
+     *
+     * The image is packed in the texture atlas of the renderer when the component is attached, and drawn as a sprite in the same batch as the other shapes.
      */
     class Image final : public Component
     {
         DECLARE_SPARK_RTTI(Image, Component)
         SPARK_ALLOW_PRIVATE_SERIALIZATION
 
+    public:
+        math::Vector4<float> color = {1.f, 1.f, 1.f, 1.f};
+
+        /// \brief `true` to keep the instance in the static batch of the renderer, for the objects that rarely change.
+        bool isStatic = false;
+        bool isVisible = true;
+
     public:
         explicit Image(GameObject* parent)
             : Component(parent) {}
@@ -21,14 +37,55 @@ namespace spark::core::components
         explicit Image(GameObject* parent, std::filesystem::path path)
             : Component(parent), m_path(std::move(path)) {}
 
+        /**
+         * \brief Creates a new @link Image image component @endlink.
+         * \param parent The parent game object.
+         * \param path The path of the image file.
+         * \param size The size of the image, in pixels. Defaults to the size of the image file.
+         */
+        explicit Image(GameObject* parent, std::filesystem::path path, const math::Vector2<float>& size)
+            : Component(parent), m_path(std::move(path)), m_size(size) {}
+
+        void onAttach() override
+        {
+            Component::onAttach();
+
+            // Load the image while loading the scene, since the atlas uploads wait for the frames in flight
+            if (!m_path.empty())
+                m_texture = &core::Application::Instance()->window().renderer().loadTexture(m_path);
+        }
+
         void render() const override
         {
-            //core::Renderer2D::DrawImage(m_path, gameObject()->transform()->position, core::Application::Instance()->window().size().castTo<float>());
+            Component::render();
+            if (m_path.empty())
+                return;
+
+            auto& renderer = core::Application::Instance()->window().renderer();
+            if (!m_texture)
+                m_texture = &renderer.loadTexture(m_path);
+
+            // Scale the centered 1x1 quad to the size of the image and move its top-left corner to the origin, directly in 2D
+            const math::Vector2<float> size = m_size.value_or(m_texture->size.castTo<float>());
+            const glm::mat4& matrix = gameObject()->transform()->matrix();
+            const glm::vec2 x_axis = glm::vec2(matrix[0]) * size.x, y_axis = glm::vec2(matrix[1]) * size.y;
+            const glm::mat3x2 transform_matrix(x_axis, y_axis, glm::vec2(matrix[3]) + (x_axis + y_axis) / 2.f);
+
+            // Draw the image
+            m_instance.draw(transform_matrix, color, 0.f, m_texture, isStatic, isVisible);
+        }
+
+        void onDetach() override
+        {
+            m_instance.release();
+            Component::onDetach();
         }
 
     private:
         std::filesystem::path m_path;
         std::optional<math::Vector2<float>> m_size;
+        mutable const AtlasRegion* m_texture = nullptr;
+        mutable details::RetainedInstance m_instance;
     };
 }
 
@@ -2,6 +2,7 @@
 
 #include "spark/core/Application.h"
 #include "spark/core/components/Transform.h"
+#include "spark/core/details/RetainedInstance.h"
 
 #include "spark/math/Vector2.h"
 #include "spark/math/Vector4.h"
@@ -20,6 +21,10 @@ namespace spark::core::components
         math::Vector2<float> size = {50, 50};
         math::Vector4<float> color = {1.f, 1.f, 1.f, 1.f};
 
+        /// \brief `true` to keep the instance in the static batch of the renderer, for the objects that rarely change.
+        bool isStatic = false;
+        bool isVisible = true;
+
     public:
         explicit Rectangle(GameObject* parent)
             : Component(parent) {}
@@ -31,15 +36,23 @@ namespace spark::core::components
         {
             Component::render();
 
-            // Get the transform matrix for the rectangle
-            auto transform_matrix = gameObject()->transform()->matrix();
-
-            transform_matrix = glm::translate(transform_matrix, {size.x / 2.0f, size.y / 2.0f, 0.0f});
-            transform_matrix = glm::scale(transform_matrix, {size.x, size.y, 1.0f});
+            // Scale the centered 1x1 quad to the size of the rectangle and move its top-left corner to the origin, directly in 2D
+            const glm::mat4& matrix = gameObject()->transform()->matrix();
+            const glm::vec2 x_axis = glm::vec2(matrix[0]) * size.x, y_axis = glm::vec2(matrix[1]) * size.y;
+            const glm::mat3x2 transform_matrix(x_axis, y_axis, glm::vec2(matrix[3]) + (x_axis + y_axis) / 2.f);
 
             // Draw the rectangle
-            core::Application::Instance()->window().renderer().drawQuad(transform_matrix, color);
+            m_instance.draw(transform_matrix, color, 0.f, nullptr, isStatic, isVisible);
+        }
+
+        void onDetach() override
+        {
+            m_instance.release();
+            Component::onDetach();
         }
+
+    private:
+        mutable details::RetainedInstance m_instance;
     };
 }
 
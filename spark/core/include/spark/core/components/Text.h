@@ -1,17 +1,35 @@
 #pragma once
 
+#include "spark/core/Application.h"
 #include "spark/core/Component.h"
+#include "spark/core/Font.h"
+#include "spark/core/components/Transform.h"
 
 #include "spark/math/Vector2.h"
+#include "spark/math/Vector4.h"
 #include "spark/rtti/HasRtti.h"
 
+#include <filesystem>
+#include <string>
+
 namespace spark::core::components
 {
+    /**
+     * \brief A simple component to render a text.
+     *
+     * The text is laid out once by its font and the layout is kept until the content or the font changes, so drawing a text only writes its glyphs
+     * into the instances of the renderer.
+     */
     class Text final : public Component
     {
         DECLARE_SPARK_RTTI(Text, Component)
         SPARK_ALLOW_PRIVATE_SERIALIZATION
 
+    public:
+        /// \brief The height of a line of text, in pixels.
+        float fontSize = 72.f;
+        math::Vector4<float> color = {1.f, 1.f, 1.f, 1.f};
+
     public:
         explicit Text(GameObject* parent)
             : Component(parent) {}
@@ -19,15 +37,74 @@ namespace spark::core::components
         explicit Text(GameObject* parent, std::string content, const math::Vector2<float> offset, std::filesystem::path font_path = "")
             : Component(parent), m_content(std::move(content)), m_offset(offset), m_fontPath(std::move(font_path)) {}
 
+        /**
+         * \brief Changes the text to render.
+         * \param content The new UTF-8 text.
+         */
+        void setContent(std::string content)
+        {
+            m_content = std::move(content);
+            m_isLayoutDirty = true;
+        }
+
+        /**
+         * \brief Gets the text rendered by the component.
+         * \return The UTF-8 text.
+         */
+        [[nodiscard]] const std::string& content() const noexcept { return m_content; }
+
+        /**
+         * \brief Changes the font of the text.
+         * \param font_path The path of the new font file.
+         */
+        void setFont(std::filesystem::path font_path)
+        {
+            m_fontPath = std::move(font_path);
+            m_font = nullptr;
+            m_isLayoutDirty = true;
+        }
+
+        void onAttach() override
+        {
+            Component::onAttach();
+
+            // Load the font while loading the scene, since it renders its glyphs in the texture atlas
+            if (!m_fontPath.empty())
+                m_font = &core::Application::Instance()->window().renderer().loadFont(m_fontPath);
+        }
+
         void render() const override
         {
-            //core::Renderer2D::DrawText(m_content, Transform::LocalToWorld(gameObject()->transform()) + m_offset, 72, m_fontPath);
+            Component::render();
+            if (m_fontPath.empty())
+                return;
+
+            auto& renderer = core::Application::Instance()->window().renderer();
+            if (!m_font)
+                m_font = &renderer.loadFont(m_fontPath);
+            if (m_isLayoutDirty)
+            {
+                m_layout = m_font->layout(m_content);
+                m_isLayoutDirty = false;
+            }
+
+            // The layout is computed for a font size of 1, scale it and move its top-left corner to the offset, directly in 2D
+            const glm::mat4& matrix = gameObject()->transform()->matrix();
+            const glm::vec2 x_axis = glm::vec2(matrix[0]), y_axis = glm::vec2(matrix[1]);
+            const glm::mat3x2 transform_matrix(x_axis * fontSize, y_axis * fontSize, glm::vec2(matrix[3]) + x_axis * m_offset.x + y_axis * m_offset.y);
+
+            // Draw the glyphs
+            renderer.drawText(transform_matrix, m_layout, color);
         }
 
     private:
         std::string m_content;
         math::Vector2<float> m_offset;
         std::filesystem::path m_fontPath;
+
+        mutable const Font* m_font = nullptr;
+        mutable TextLayout m_layout;
+        mutable bool m_isLayoutDirty = true;
     };
 }
 
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "spark/core/Application.h"
+#include "spark/core/Component.h"
+#include "spark/core/TileGrid.h"
+#include "spark/core/components/Transform.h"
+
+#include "spark/math/Vector2.h"
+#include "spark/math/Vector4.h"
+#include "spark/rtti/HasRtti.h"
+
+#include "glm/matrix.hpp"
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace spark::core::components
+{
+    /**
+     * \brief A component to render a grid of colored tiles, with a top-left corner at the origin of its game object.
+     *
+     * The tiles are stored in a \ref TileGrid split in chunks. Each chunk is kept in an instance batch of the renderer, where only the modified tiles are
+     * written again, and is culled as a whole. Drawing a large map which does not change therefore only costs one call per chunk.
+     */
+    class Tilemap final : public Component
+    {
+        DECLARE_SPARK_RTTI(Tilemap, Component)
+
+    public:
+        /// \brief The size of a tile, in pixels.
+        math::Vector2<float> tileSize = {32.f, 32.f};
+
+        /// \brief The space between two tiles, in pixels.
+        float spacing = 0.f;
+
+        /// \brief The color of each type of tile, indexed by \ref TileId. The tiles without a color are hidden.
+        std::vector<math::Vector4<float>> palette = {{1.f, 1.f, 1.f, 1.f}};
+
+    public:
+        explicit Tilemap(GameObject* parent)
+            : Component(parent) {}
+
+        /**
+         * \brief Creates a new @link Tilemap tilemap component @endlink filled with the tile 0.
+         * \param parent The parent game object.
+         * \param size The number of tiles on each axis.
+         * \param tile_size The size of a tile, in pixels.
+         * \param tile_spacing The space between two tiles, in pixels.
+         */
+        explicit Tilemap(GameObject* parent, const math::Vector2<unsigned>& size, const math::Vector2<float>& tile_size, const float tile_spacing = 0.f)
+            : Component(parent), tileSize(tile_size), spacing(tile_spacing), m_grid(size, s_chunkSize) {}
+
+        /**
+         * \brief Changes the number of tiles of the map, which is filled with the tile 0 again.
+         * \param size The new number of tiles on each axis.
+         */
+        void resize(const math::Vector2<unsigned>& size)
+        {
+            releaseChunks();
+            m_grid = TileGrid(size, s_chunkSize);
+        }
+
+        /**
+         * \brief Gets the number of tiles of the map.
+         * \return The number of tiles on each axis.
+         */
+        [[nodiscard]] const math::Vector2<unsigned>& size() const noexcept { return m_grid.size(); }
+
+        /**
+         * \brief Changes a tile. Only its chunk is written again to the GPU.
+         * \param position The coordinates of the tile.
+         * \param tile The new type of the tile.
+         */
+        void setTile(const math::Vector2<unsigned>& position, const TileId tile) { m_grid.set(position, tile); }
+
+        /**
+         * \brief Gets a tile.
+         * \param position The coordinates of the tile.
+         * \return The type of the tile.
+         */
+        [[nodiscard]] TileId tile(const math::Vector2<unsigned>& position) const { return m_grid.at(position); }
+
+        /**
+         * \brief Changes all the tiles of the map.
+         * \param tile The new type of the tiles.
+         */
+        void fill(const TileId tile) { m_grid.fill(tile); }
+
+        /**
+         * \brief Finds the tile under a point.
+         * \param point The point, in the same space as the game object.
+         * \return The coordinates of the tile, or `std::nullopt` if the point is outside of the map or between two tiles.
+         */
+        [[nodiscard]] std::optional<math::Vector2<unsigned>> tileAt(const math::Vector2<float>& point) const
+        {
+            const glm::vec4 local = glm::inverse(gameObject()->transform()->matrix()) * glm::vec4(point.x, point.y, 0.f, 1.f);
+            const float step_x = tileSize.x + spacing, step_y = tileSize.y + spacing;
+            if (local.x < 0.f || local.y < 0.f || std::fmod(local.x, step_x) > tileSize.x || std::fmod(local.y, step_y) > tileSize.y)
+                return std::nullopt;
+
+            const math::Vector2<unsigned> position = {static_cast<unsigned>(local.x / step_x), static_cast<unsigned>(local.y / step_y)};
+            if (position.x >= m_grid.size().x || position.y >= m_grid.size().y)
+                return std::nullopt;
+            return position;
+        }
+
+        void render() const override
+        {
+            Component::render();
+
+            auto& renderer = core::Application::Instance()->window().renderer();
+            const glm::mat4& matrix = gameObject()->transform()->matrix();
+            const glm::vec2 x_axis = glm::vec2(matrix[0]), y_axis = glm::vec2(matrix[1]), origin = glm::vec2(matrix[3]);
+            const glm::vec2 step = {tileSize.x + spacing, tileSize.y + spacing};
+
+            // Create the batches of the chunks the first time the map is drawn, and write all the tiles again when they all moved or changed color
+            const bool is_new = m_chunks.empty() && m_grid.chunkCount() > 0;
+            if (is_new)
+                for (std::size_t chunk = 0; chunk < m_grid.chunkCount(); ++chunk)
+                {
+                    const auto tiles = m_grid.chunkTiles(chunk);
+                    m_chunks.push_back(renderer.createBatch(tiles.extent.x * tiles.extent.y));
+                }
+            const bool is_moved = is_new || matrix != m_matrix || tileSize != m_tileSize || spacing != m_spacing || palette != m_palette;
+            if (is_moved)
+            {
+                m_matrix = matrix;
+                m_tileSize = tileSize;
+                m_spacing = spacing;
+                m_palette = palette;
+            }
+
+            for (std::size_t chunk = 0; chunk < m_chunks.size(); ++chunk)
+            {
+                const auto tiles = m_grid.chunkTiles(chunk);
+                const auto write = [&](const math::Vector2<unsigned>& position)
+                {
+                    // Scale the centered 1x1 quad to the size of the tile and move its top-left corner to the tile, directly in 2D
+                    const TileId tile = m_grid.at(position);
+                    const glm::vec2 corner = origin + x_axis * (static_cast<float>(position.x) * step.x) + y_axis * (static_cast<float>(position.y) * step.y);
+                    const glm::vec2 tile_x = x_axis * tileSize.x, tile_y = y_axis * tileSize.y;
+                    const unsigned instance = (position.y - tiles.position.y) * tiles.extent.x + position.x - tiles.position.x;
+                    if (tile < palette.size())
+                        renderer.updateBatch(m_chunks[chunk], instance, glm::mat3x2(tile_x, tile_y, corner + (tile_x + tile_y) / 2.f), palette[tile]);
+                    else
+                        renderer.updateBatch(m_chunks[chunk], instance, glm::mat3x2(0.f), {}, 0.f, nullptr, false);
+                };
+
+                if (is_moved)
+                {
+                    for (unsigned y = tiles.position.y; y < tiles.position.y + tiles.extent.y; ++y)
+                        for (unsigned x = tiles.position.x; x < tiles.position.x + tiles.extent.x; ++x)
+                            write({x, y});
+                } else
+                    for (const math::Vector2<unsigned>& position : m_grid.dirtyTiles(chunk))
+                        write(position);
+                m_grid.clearDirtyTiles(chunk);
+
+                // Draw the chunk, unless its bounds are outside of the viewport
+                const glm::vec2 bounds_x = x_axis * (static_cast<float>(tiles.extent.x) * step.x - spacing);
+                const glm::vec2 bounds_y = y_axis * (static_cast<float>(tiles.extent.y) * step.y - spacing);
+                const glm::vec2 corner = origin + x_axis * (static_cast<float>(tiles.position.x) * step.x) + y_axis * (static_cast<float>(tiles.position.y) * step.y);
+                renderer.drawBatch(m_chunks[chunk], glm::mat3x2(bounds_x, bounds_y, corner + (bounds_x + bounds_y) / 2.f));
+            }
+        }
+
+        void onDetach() override
+        {
+            releaseChunks();
+            Component::onDetach();
+        }
+
+    private:
+        /**
+         * \brief Destroys the batches of the chunks, which are created again with all their tiles the next time the map is drawn.
+         */
+        void releaseChunks()
+        {
+            if (!m_chunks.empty() && core::Application::Instance())
+                for (const InstanceBatch batch : m_chunks)
+                    core::Application::Instance()->window().renderer().destroyBatch(batch);
+            m_chunks.clear();
+        }
+
+        // Larger chunks need less draw calls, smaller ones are culled more precisely and cost less to write again
+        inline static constexpr unsigned s_chunkSize = 32;
+
+    private:
+        mutable TileGrid m_grid = TileGrid({0, 0}, s_chunkSize);
+        mutable std::vector<InstanceBatch> m_chunks;
+
+        // The values used to write the tiles, which are all written again when one of them changes
+        mutable glm::mat4 m_matrix = glm::mat4(0.f);
+        mutable math::Vector2<float> m_tileSize;
+        mutable float m_spacing = 0.f;
+        mutable std::vector<math::Vector4<float>> m_palette;
+    };
+}
+
+IMPLEMENT_SPARK_RTTI(spark::core::components::Tilemap)
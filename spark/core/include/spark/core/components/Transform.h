@@ -12,6 +12,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "glm/gtx/quaternion.hpp"
 
+#include <cstddef>
+
 namespace spark::core::components
 {
     /**
@@ -20,45 +22,123 @@ namespace spark::core::components
     class SPARK_CORE_EXPORT Transform final : public Component
     {
         DECLARE_SPARK_RTTI(Transform, Component)
-
-    public:
-        math::Vector2<float> position = {0.f, 0.f};
-        float rotation = 0;
-        math::Vector2<float> scale = {1.f, 1.f};
+        friend class spark::core::GameObject;
 
     public:
         explicit Transform(GameObject* parent)
-            : Component(parent) {}
+            : Component(parent)
+        {
+            // If this transform replaces a removed one, the matrices of the children were computed without it
+            for (std::size_t i = 0; i < parent->childCount(); ++i)
+                if (Transform* child = parent->child(i)->transform())
+                    child->invalidate();
+        }
 
-        friend bool operator==(const Transform& lhs, const Transform& rhs) { return lhs.position == rhs.position; }
+        friend bool operator==(const Transform& lhs, const Transform& rhs) { return lhs.m_position == rhs.m_position; }
         friend bool operator!=(const Transform& lhs, const Transform& rhs) { return !(lhs == rhs); }
 
         /**
-         * \brief Gets the transformation matrix of the transform.
-         * \return A \ref glm::mat4 representing the transformation matrix.
+         * \brief Gets the position of the transform, relative to its parent.
+         * \return A const reference to the position.
          */
-        glm::mat4 matrix() const
+        [[nodiscard]] const math::Vector2<float>& position() const { return m_position; }
+
+        /**
+         * \brief Sets the position of the transform, relative to its parent.
+         * \param position The new position.
+         */
+        void setPosition(const math::Vector2<float>& position)
         {
-            glm::mat4 matrix(1.f);
+            m_position = position;
+            invalidate();
+        }
+
+        /**
+         * \brief Gets the rotation of the transform in radians, relative to its parent.
+         * \return The rotation.
+         */
+        [[nodiscard]] float rotation() const { return m_rotation; }
+
+        /**
+         * \brief Sets the rotation of the transform in radians, relative to its parent.
+         * \param rotation The new rotation.
+         */
+        void setRotation(const float rotation)
+        {
+            m_rotation = rotation;
+            invalidate();
+        }
+
+        /**
+         * \brief Gets the scale of the transform, relative to its parent.
+         * \return A const reference to the scale.
+         */
+        [[nodiscard]] const math::Vector2<float>& scale() const { return m_scale; }
+
+        /**
+         * \brief Sets the scale of the transform, relative to its parent.
+         * \param scale The new scale.
+         */
+        void setScale(const math::Vector2<float>& scale)
+        {
+            m_scale = scale;
+            invalidate();
+        }
+
+        /**
+         * \brief Gets the local-to-world transformation matrix of the transform.
+         * \return A const reference to a \ref glm::mat4 representing the transformation matrix.
+         *
+         * The matrix is cached. Changing this transform or one of its parents marks it as outdated, and it is only recomputed on the next call.
+         * Recomputing it writes the cache of this transform and of the outdated ones above it, which is why the Scene computes the outdated matrices
+         * before its parallel update phase. See \ref SPARK_THREAD_SAFE_UPDATE.
+         */
+        const glm::mat4& matrix() const
+        {
+            if (!m_dirty)
+                return m_matrix;
 
             // Apply local transform
-            matrix = glm::translate(matrix, {gameObject()->transform()->position.x, gameObject()->transform()->position.y, 0.f});
-            matrix = glm::rotate(matrix, gameObject()->transform()->rotation, {0.0f, 0.0f, 1.0f});
-            matrix = glm::scale(matrix, {gameObject()->transform()->scale.x, gameObject()->transform()->scale.y, 1.0f});
+            glm::mat4 matrix(1.f);
+            matrix = glm::translate(matrix, {m_position.x, m_position.y, 0.f});
+            matrix = glm::rotate(matrix, m_rotation, {0.0f, 0.0f, 1.0f});
+            matrix = glm::scale(matrix, {m_scale.x, m_scale.y, 1.0f});
 
-            // Apply parent transforms
+            // Apply parent transforms, the parent is read from the tree as the GameObject may have been moved
             const GameObject* parent = gameObject()->parent();
-            while (parent)
-            {
-                const Transform& parent_transform = *parent->transform();
-                matrix = glm::translate(matrix, {parent_transform.position.x, parent_transform.position.y, 0.f});
-                matrix = glm::rotate(matrix, parent_transform.rotation, {0.0f, 0.0f, 1.0f});
-                matrix = glm::scale(matrix, {parent_transform.scale.x, parent_transform.scale.y, 1.0f});
-                parent = parent_transform.gameObject()->parent();
-            }
-
-            return matrix;
+            if (const Transform* parent_transform = parent ? parent->transform() : nullptr)
+                matrix = matrix * parent_transform->matrix();
+
+            m_matrix = matrix;
+            m_dirty = false;
+            return m_matrix;
+        }
+
+    private:
+        /**
+         * \brief Marks the matrix of this transform and of all the transforms below it in the tree as outdated.
+         *
+         * A transform is never up to date while its parent is outdated, so an outdated transform already has all its children outdated.
+         */
+        void invalidate()
+        {
+            if (m_dirty)
+                return;
+
+            m_dirty = true;
+            const GameObject* object = gameObject();
+            for (std::size_t i = 0; i < object->childCount(); ++i)
+                if (Transform* child = object->child(i)->transform())
+                    child->invalidate();
         }
+
+    private:
+        math::Vector2<float> m_position = {0.f, 0.f};
+        float m_rotation = 0;
+        math::Vector2<float> m_scale = {1.f, 1.f};
+
+        mutable glm::mat4 m_matrix = glm::mat4(1.f);
+        mutable bool m_dirty = true;
     };
 }
 
@@ -1,11 +1,18 @@
 #pragma once
 
+#include "spark/core/details/ComponentStorage.h"
+#include "spark/core/details/TraversalOrder.h"
+
 #include "experimental/ser/SerializerScheme.h"
 #include "spark/patterns/Composite.h"
 
+#include <memory>
+#include <vector>
+
 namespace spark::core
 {
     class GameObject;
+    class Scene;
 }
 
 namespace spark::core::details
@@ -13,6 +20,34 @@ namespace spark::core::details
     template <typename Impl>
     struct GameObjectDeleter;
 
+    /**
+     * \brief An entry in the list of components of a GameObject.
+     */
+    struct ComponentEntry
+    {
+        /// \brief The RTTI of the component, used to find it by type.
+        const rtti::RttiBase* type = nullptr;
+
+        /// \brief A pointer to the component.
+        Component* component = nullptr;
+
+        /// \brief The pool in which the component is registered, in the storage of the tree of the GameObject.
+        ComponentPool* pool = nullptr;
+
+        /// \brief The pool owning the memory of the component, or nullptr if it was allocated outside of a pool. It does not change when the GameObject is
+        /// moved to another tree.
+        ComponentPool* allocator = nullptr;
+
+        /// \brief `true` if the component is destroyed with the GameObject, `false` otherwise.
+        bool managed = false;
+
+        /// \brief `true` if the component is updated in the parallel update phase of the Scene, `false` otherwise.
+        bool threadSafeUpdate = false;
+
+        /// \brief `true` once the component was removed from its GameObject, until the entry is erased at the end of the frame.
+        bool removed = false;
+    };
+
     /**
      * \brief A CRTP class to implement a GameObject. It is used to wrap the onSpawn, onUpdate and onDestroyed methods to include custom code around user implementation.
      * \tparam Impl The implementation of the GameObject.
@@ -21,6 +56,8 @@ namespace spark::core::details
     class AbstractGameObject : public patterns::Composite<GameObject, GameObjectDeleter>
     {
         friend class spark::core::GameObject;
+        friend class spark::core::Scene;
+        friend class TraversalOrder;
         SPARK_ALLOW_PRIVATE_SERIALIZATION
 
     public:
@@ -43,14 +80,122 @@ namespace spark::core::details
          */
         void onUpdate(float dt);
 
+        /**
+         * \brief Updates the implementation and components having a thread-safe update. Called concurrently for several GameObjects.
+         * \param dt The time in seconds since the last frame.
+         */
+        void onParallelUpdate(float dt);
+
+        /**
+         * \brief Updates the implementation and components not updated by \ref onParallelUpdate.
+         * \param dt The time in seconds since the last frame.
+         */
+        void onSerialUpdate(float dt);
+
         /**
          * \brief Method calling the corresponding method on the implementation, the children and components.
          */
         void onDestroyed();
 
+        /**
+         * \brief Checks if the implementation or any component has a thread-safe update.
+         * \return `true` if \ref onParallelUpdate has something to update, `false` otherwise.
+         */
+        [[nodiscard]] bool hasParallelUpdate() const;
+
+        /**
+         * \brief Destroys the components removed from GameObjects since the last call.
+         *
+         * The removed components are only destroyed at the end of the frame, since the GameObject or the Scene may be iterating over them when they are
+         * removed. It is called by \ref GameObjectDeleter::DeleteMarkedObjects.
+         */
+        static void DestroyRemovedComponents();
+
+        /**
+         * \brief Gets the storage of the components, shared by all the GameObjects of the tree.
+         * \return A const reference to the \ref ComponentStorage of the tree.
+         */
+        [[nodiscard]] const ComponentStorage& componentStorage() const;
+
+    protected:
+        /**
+         * \brief Invalidates the traversal order of the tree when a child is added or removed.
+         */
+        void onChildrenChanged() override;
+
+        /**
+         * \brief Moves the components of the GameObject and its descendants to the storage of their new tree.
+         * \param old_parent The previous parent of the GameObject.
+         */
+        void onParentChanged(GameObject* old_parent) override;
+
+    private:
+        /**
+         * \brief Detects the destruction of a GameObject by the user code it calls, for example when it destroys itself in its update.
+         */
+        class DestructionGuard final
+        {
+        public:
+            explicit DestructionGuard(AbstractGameObject& object);
+            ~DestructionGuard();
+
+            DestructionGuard(const DestructionGuard& other) = delete;
+            DestructionGuard(DestructionGuard&& other) noexcept = delete;
+            DestructionGuard& operator=(const DestructionGuard& other) = delete;
+            DestructionGuard& operator=(DestructionGuard&& other) noexcept = delete;
+
+            /**
+             * \brief Checks if the GameObject was destroyed since the creation of the guard.
+             * \return `true` if the GameObject was destroyed and must not be accessed anymore, `false` otherwise.
+             */
+            [[nodiscard]] bool destroyed() const;
+
+        private:
+            AbstractGameObject* m_object;
+            bool* m_previous;
+            bool m_isDestroyed = false;
+        };
+
+        /**
+         * \brief Gets the traversal order of the tree of this GameObject, owned by its root.
+         * \return A reference to the \ref TraversalOrder of the tree.
+         */
+        [[nodiscard]] TraversalOrder& traversalOrder();
+
+        /**
+         * \brief Destroys a component of the GameObject, if it owns it.
+         * \param entry The entry of the component, which must already be erased from its pool.
+         */
+        static void destroyComponent(const ComponentEntry& entry);
+
+        /**
+         * \brief Registers the components of this GameObject and its descendants in the pools of \p storage instead of their current ones.
+         * \param storage The storage of the new tree of the GameObject.
+         */
+        void moveComponents(const std::shared_ptr<ComponentStorage>& storage);
+
     private:
         bool m_initialized = false;
-        std::unordered_map<rtti::RttiBase*, std::pair<Component*, bool>> m_components;
+        std::vector<ComponentEntry> m_components;
+        std::shared_ptr<ComponentStorage> m_storage;
+
+        /// \brief The storages of the previous trees of the GameObject, which still own the memory of some of its components.
+        std::vector<std::shared_ptr<ComponentStorage>> m_previousStorages;
+
+        std::unique_ptr<TraversalOrder> m_traversalOrder;
+        std::size_t m_traversalIndex = 0, m_subtreeSize = 0;
+
+        /// \brief The Scene of the tree. Only set on the root.
+        Scene* m_scene = nullptr;
+
+        /// \brief The flag of the innermost \ref DestructionGuard of the GameObject, set when it is destroyed.
+        bool* m_destroyed = nullptr;
+
+        /// \brief `true` if some components were removed from the GameObject and are not destroyed yet.
+        bool m_hasRemovedComponents = false;
+
+        /// \brief The GameObjects having removed components to destroy at the end of the frame.
+        inline static std::vector<AbstractGameObject*> s_objectsWithRemovedComponents;
     };
 
     /**
@@ -64,6 +209,7 @@ namespace spark::core::details
 
         static void DeleteMarkedObjects()
         {
+            AbstractGameObject<GameObject>::DestroyRemovedComponents();
             for (std::size_t i = 0; i < objectsToDestroy.size(); i++)
                 delete objectsToDestroy[i];
             objectsToDestroy.clear();
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "spark/core/Export.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Vector4.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spark::core::details
+{
+    /**
+     * \brief The instruction sets a \ref BoundsBatch can use to test the bounds.
+     */
+    enum class SimdLevel
+    {
+        /// \brief One test at a time, with scalar instructions.
+        Scalar,
+
+        /// \brief 4 tests per instruction, with SSE instructions.
+        Sse,
+
+        /// \brief 8 tests per instruction, with AVX instructions.
+        Avx
+    };
+
+    /**
+     * \brief Collider bounds stored as a structure of arrays, to test one bounds against many with SIMD instructions.
+     *
+     * The bounds have the layout returned by \ref components::Collider::bounds, and the test is the same as \ref components::Collider::Overlaps.
+     */
+    class SPARK_CORE_EXPORT BoundsBatch final
+    {
+    public:
+        /**
+         * \brief Gets the best instruction set supported by the CPU.
+         * \return The \ref SimdLevel used by default by \ref overlaps.
+         */
+        [[nodiscard]] static SimdLevel SupportedSimdLevel();
+
+        /**
+         * \brief Removes all the bounds of the batch, keeping its memory.
+         */
+        void clear();
+
+        /**
+         * \brief Reserves memory for \p count bounds.
+         * \param count The number of bounds to reserve.
+         */
+        void reserve(std::size_t count);
+
+        /**
+         * \brief Adds bounds at the end of the batch.
+         * \param bounds The bounds to add. [xMin, yMin, xMax, yMax]
+         */
+        void push(const math::Vector4<float>& bounds);
+
+        /**
+         * \brief Gets the number of bounds in the batch.
+         * \return The size of the batch.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * \brief Tests \p bounds against the bounds of the batch in [\p begin, \p end), and appends the indices of the overlapping ones to \p result.
+         * \param bounds The bounds to test.
+         * \param begin The index of the first bounds of the batch to test.
+         * \param end The index past the last bounds of the batch to test.
+         * \param result The vector receiving the indices of the overlapping bounds, in increasing order.
+         * \param level The instruction set to use. Must be supported by the CPU.
+         */
+        void overlaps(const math::Vector4<float>& bounds,
+                      std::size_t begin,
+                      std::size_t end,
+                      std::vector<std::uint32_t>& result,
+                      SimdLevel level = SupportedSimdLevel()) const;
+
+    private:
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::details::BoundsBatch'
+
+        std::vector<float> m_x, m_y, m_z, m_w;
+
+        SPARK_WARNING_POP
+    };
+}
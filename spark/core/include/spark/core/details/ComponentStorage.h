@@ -0,0 +1,146 @@
+#pragma once
+
+#include "spark/core/Export.h"
+
+#include "spark/base/Macros.h"
+#include "spark/rtti/RttiBase.h"
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace spark::core
+{
+    class Component;
+}
+
+namespace spark::core::details
+{
+    /**
+     * \brief A pool holding every component of a single type.
+     *
+     * Components created through the pool are constructed in place inside fixed-size pages, so components of the same type are stored next to each other
+     * and never move once created. Every component registered in the pool (created by it or not) is also referenced in a dense array used to iterate
+     * over all of them linearly.
+     */
+    class SPARK_CORE_EXPORT ComponentPool final
+    {
+    public:
+        explicit ComponentPool() = default;
+        ~ComponentPool();
+
+        ComponentPool(const ComponentPool& other) = delete;
+        ComponentPool(ComponentPool&& other) noexcept = delete;
+        ComponentPool& operator=(const ComponentPool& other) = delete;
+        ComponentPool& operator=(ComponentPool&& other) noexcept = delete;
+
+        /**
+         * \brief Constructs a new component of type \p T in the pool memory.
+         * \tparam T The type of the component to create.
+         * \param args The arguments to pass to the constructor of the component.
+         * \return A pointer to the newly created component. It is not registered in the dense array, see \ref insert.
+         */
+        template <typename T, typename... Args>
+        T* create(Args&&... args);
+
+        /**
+         * \brief Destroys a component created by \ref create and gives its memory back to the pool.
+         * \param component A pointer to the component to destroy.
+         */
+        void destroy(Component* component);
+
+        /**
+         * \brief Registers a component in the dense array of the pool.
+         * \param component A pointer to the component to register.
+         */
+        void insert(Component* component);
+
+        /**
+         * \brief Removes a component from the dense array of the pool.
+         * \param component A pointer to the component to remove.
+         *
+         * \note The last component of the array takes the place of the removed one, so the order of the components is not preserved.
+         */
+        void erase(Component* component);
+
+        /**
+         * \brief Gets all the components registered in the pool.
+         * \return A const reference to the dense array of components.
+         */
+        [[nodiscard]] const std::vector<Component*>& components() const;
+
+    private:
+        /**
+         * \brief Gets a free slot in the pool pages, allocating a new page if none is available.
+         * \param size The size of the component to store.
+         * \param alignment The alignment of the component to store.
+         * \return A pointer to uninitialized memory able to store the component.
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * \brief Gives a slot back to the pool.
+         * \param ptr A pointer to the slot previously returned by \ref allocate.
+         */
+        void deallocate(void* ptr);
+
+    private:
+        /// \brief The size in bytes of a page. Every page holds at least one component.
+        inline static constexpr std::size_t s_pageSize = 16 * 1024;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::details::ComponentPool'
+
+        std::size_t m_elementSize = 0;
+        std::size_t m_elementAlignment = 0;
+        std::size_t m_pageCapacity = 0;
+        std::size_t m_usedInLastPage = 0;
+        std::vector<std::byte*> m_pages;
+        std::vector<void*> m_freeSlots;
+        std::vector<Component*> m_components;
+
+        SPARK_WARNING_POP
+    };
+
+    /**
+     * \brief Holds one \ref ComponentPool per component type for a whole GameObject tree.
+     *
+     * A storage is created by every root GameObject and shared with all its children. Since a \ref spark::core::Scene owns its root, it owns the pools of
+     * all the components of the objects in the scene. When a GameObject is moved to another tree, its components are registered in the storage of the new
+     * tree, but their memory stays in the pools which created them.
+     */
+    class SPARK_CORE_EXPORT ComponentStorage final
+    {
+    public:
+        explicit ComponentStorage() = default;
+        ~ComponentStorage() = default;
+
+        ComponentStorage(const ComponentStorage& other) = delete;
+        ComponentStorage(ComponentStorage&& other) noexcept = delete;
+        ComponentStorage& operator=(const ComponentStorage& other) = delete;
+        ComponentStorage& operator=(ComponentStorage&& other) noexcept = delete;
+
+        /**
+         * \brief Gets the pool for the given component type, creating it if it does not exist yet.
+         * \param type The RTTI of the component type.
+         * \return A reference to the pool of the component type.
+         */
+        [[nodiscard]] ComponentPool& pool(const rtti::RttiBase& type);
+
+        /**
+         * \brief Finds the pool for the given component type.
+         * \param type The RTTI of the component type.
+         * \return A pointer to the pool of the component type, or nullptr if no component of this type was ever added.
+         */
+        [[nodiscard]] const ComponentPool* find(const rtti::RttiBase& type) const;
+
+    private:
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::unordered_map<...>' needs to have dll-interface to be used by clients of class 'spark::core::details::ComponentStorage'
+        std::unordered_map<const rtti::RttiBase*, std::unique_ptr<ComponentPool>> m_pools;
+        SPARK_WARNING_POP
+    };
+}
+
+#include "spark/core/impl/ComponentStorage.h"
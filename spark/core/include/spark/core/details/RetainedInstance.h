@@ -0,0 +1,92 @@
+#pragma once
+
+#include "spark/core/Application.h"
+#include "spark/core/Renderer2D.h"
+
+#include "spark/math/Vector4.h"
+
+#include <optional>
+#include <utility>
+
+namespace spark::core::details
+{
+    /**
+     * \brief The instance drawn by a renderable component, either drawn again every frame or kept in the static batch of the renderer.
+     *
+     * A component marked as static adds its instance to the static batch the first time it is drawn and then only updates it, which does not write anything
+     * to the GPU unless the instance changed.
+     */
+    class RetainedInstance final
+    {
+    public:
+        RetainedInstance() = default;
+        ~RetainedInstance() = default;
+
+        RetainedInstance(const RetainedInstance& other) = delete;
+        RetainedInstance& operator=(const RetainedInstance& other) = delete;
+
+        // The components are moved by their pools, which moves the ownership of their static instance
+        RetainedInstance(RetainedInstance&& other) noexcept
+            : m_static(std::exchange(other.m_static, std::nullopt)) {}
+
+        RetainedInstance& operator=(RetainedInstance&& other) noexcept
+        {
+            if (this != &other)
+                m_static = std::exchange(other.m_static, std::nullopt);
+            return *this;
+        }
+
+        /**
+         * \brief Draws the instance of the component for the current frame.
+         * \param transform_matrix The 3x2 matrix describing the transformation of the 1x1 quad.
+         * \param color The color of the instance.
+         * \param radius The radius of the instance if it is a circle, 0 otherwise.
+         * \param texture The texture of the instance, or `nullptr` if it is not textured.
+         * \param is_static `true` to keep the instance in the static batch, `false` to draw it during the frame.
+         * \param is_visible `false` to hide the instance.
+         */
+        void draw(const glm::mat3x2& transform_matrix,
+                  const math::Vector4<float>& color,
+                  const float radius,
+                  const AtlasRegion* texture,
+                  const bool is_static,
+                  const bool is_visible)
+        {
+            auto& renderer = Application::Instance()->window().renderer();
+            if (is_static)
+            {
+                if (m_static)
+                    renderer.updateStatic(*m_static, transform_matrix, color, radius, texture, is_visible);
+                else
+                    m_static = renderer.addStatic(transform_matrix, color, radius, texture, is_visible);
+                return;
+            }
+
+            // The component is not static (anymore), draw it with the other instances of the frame
+            release();
+            if (!is_visible)
+                return;
+            if (texture)
+                renderer.drawSprite(transform_matrix, *texture, color);
+            else if (radius > 0.f)
+                renderer.drawCircle(transform_matrix, radius, color);
+            else
+                renderer.drawQuad(transform_matrix, color);
+        }
+
+        /**
+         * \brief Removes the instance from the static batch, if it is in it.
+         */
+        void release()
+        {
+            if (!m_static)
+                return;
+            if (Application::Instance())
+                Application::Instance()->window().renderer().removeStatic(*m_static);
+            m_static.reset();
+        }
+
+    private:
+        std::optional<StaticInstance> m_static;
+    };
+}
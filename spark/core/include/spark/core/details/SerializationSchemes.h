@@ -9,9 +9,11 @@
 #include "spark/core/components/Image.h"
 #include "spark/core/components/Rectangle.h"
 #include "spark/core/components/Text.h"
+#include "spark/core/components/Tilemap.h"
 #include "spark/core/components/Transform.h"
 
 #include "spark/math/Vector2.h"
+#include "spark/math/Vector4.h"
 
 template <typename SerializerType>
 struct experimental::ser::SerializerScheme<SerializerType, std::filesystem::path>
@@ -70,6 +72,26 @@ struct experimental::ser::SerializerScheme<SerializerType, spark::math::Vector2<
     }
 };
 
+template <typename SerializerType, typename T>
+struct experimental::ser::SerializerScheme<SerializerType, spark::math::Vector4<T>>
+{
+    static void serialize(SerializerType& serializer, const spark::math::Vector4<T>& obj)
+    {
+        serializer << obj.x;
+        serializer << obj.y;
+        serializer << obj.z;
+        serializer << obj.w;
+    }
+
+    static void deserialize(SerializerType& deserializer, spark::math::Vector4<T>& obj)
+    {
+        deserializer >> obj.x;
+        deserializer >> obj.y;
+        deserializer >> obj.z;
+        deserializer >> obj.w;
+    }
+};
+
 template <typename SerializerType, typename T>
 struct experimental::ser::SerializerScheme<SerializerType, spark::math::Rectangle<T>>
 {
@@ -95,7 +117,79 @@ SPARK_SERIALIZE_RTTI_CLASS(spark::core::components::DynamicCollider)
 SPARK_SERIALIZE_RTTI_CLASS(spark::core::components::Image, m_path, m_size)
 SPARK_SERIALIZE_RTTI_CLASS(spark::core::components::Rectangle, size)
 SPARK_SERIALIZE_RTTI_CLASS(spark::core::components::Text, m_content, m_offset, m_fontPath)
-SPARK_SERIALIZE_RTTI_CLASS(spark::core::components::Transform, position, rotation, scale)
+
+// The transform is deserialized through its setters, so the matrices of the children are recomputed
+template <typename SerializerType>
+struct experimental::ser::SerializerScheme<SerializerType, spark::core::components::Transform>
+{
+    static void serialize(SerializerType& serializer, const spark::core::components::Transform& obj)
+    {
+        serializer << static_cast<const spark::core::Component&>(obj);
+        serializer << obj.position();
+        serializer << obj.rotation();
+        serializer << obj.scale();
+    }
+
+    static void deserialize(SerializerType& deserializer, spark::core::components::Transform& obj)
+    {
+        deserializer >> static_cast<spark::core::Component&>(obj);
+
+        spark::math::Vector2<float> position, scale;
+        float rotation = 0;
+        deserializer >> position;
+        deserializer >> rotation;
+        deserializer >> scale;
+        obj.setPosition(position);
+        obj.setRotation(rotation);
+        obj.setScale(scale);
+    }
+};
+
+// The tiles are deserialized through the public interface of the tilemap, so all its chunks are written again the next time it is drawn
+template <typename SerializerType>
+struct experimental::ser::SerializerScheme<SerializerType, spark::core::components::Tilemap>
+{
+    static void serialize(SerializerType& serializer, const spark::core::components::Tilemap& obj)
+    {
+        serializer << static_cast<const spark::core::Component&>(obj);
+        serializer << obj.tileSize;
+        serializer << obj.spacing;
+
+        serializer << obj.palette.size();
+        for (const auto& color : obj.palette)
+            serializer << color;
+
+        const spark::math::Vector2<unsigned>& size = obj.size();
+        serializer << size;
+        for (unsigned y = 0; y < size.y; ++y)
+            for (unsigned x = 0; x < size.x; ++x)
+                serializer << obj.tile({x, y});
+    }
+
+    static void deserialize(SerializerType& deserializer, spark::core::components::Tilemap& obj)
+    {
+        deserializer >> static_cast<spark::core::Component&>(obj);
+        deserializer >> obj.tileSize;
+        deserializer >> obj.spacing;
+
+        std::size_t palette_size = 0;
+        deserializer >> palette_size;
+        obj.palette.resize(palette_size);
+        for (auto& color : obj.palette)
+            deserializer >> color;
+
+        spark::math::Vector2<unsigned> size;
+        deserializer >> size;
+        obj.resize(size);
+        for (unsigned y = 0; y < size.y; ++y)
+            for (unsigned x = 0; x < size.x; ++x)
+            {
+                spark::core::TileId tile = 0;
+                deserializer >> tile;
+                obj.setTile({x, y}, tile);
+            }
+    }
+};
 
 template <typename SerializerType>
 struct experimental::ser::SerializerScheme<SerializerType, spark::core::GameObject>
@@ -133,8 +227,12 @@ struct experimental::ser::SerializerScheme<SerializerType, spark::core::GameObje
 
             // If the class already haves the component, don't recreate it. Only deserialize in place.
             spark::core::Component* component = nullptr;
-            if (auto it = obj.m_components.find(spark::rtti::RttiDatabase::Get(type)); it != obj.m_components.end())
-                component = it->second.first;
+            if (auto it = std::ranges::find_if(obj.m_components,
+                                               [rtti = spark::rtti::RttiDatabase::Get(type)](const spark::core::details::ComponentEntry& entry)
+                                               {
+                                                   return entry.type == rtti && !entry.removed;
+                                               }); it != obj.m_components.end())
+                component = it->component;
             else
             {
                 component = spark::core::Application::Instance()->registries().component.create(type, &obj).release();
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "spark/core/Export.h"
+
+#include "spark/base/Macros.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace spark::core
+{
+    class GameObject;
+}
+
+namespace spark::core::details
+{
+    /**
+     * \brief A flat pre-order list of all the GameObjects of a tree.
+     *
+     * The list is owned by the root of the tree and only rebuilt when a GameObject is added to or removed from the tree. Iterating it does not allocate,
+     * unlike \ref patterns::traverse_tree which copies the children of every node. Any subtree is a contiguous range of the list.
+     */
+    class SPARK_CORE_EXPORT TraversalOrder final
+    {
+    public:
+        /**
+         * \brief Creates the traversal order of a tree.
+         * \param root The root of the tree.
+         */
+        explicit TraversalOrder(GameObject* root);
+        ~TraversalOrder() = default;
+
+        TraversalOrder(const TraversalOrder& other) = delete;
+        TraversalOrder(TraversalOrder&& other) noexcept = delete;
+        TraversalOrder& operator=(const TraversalOrder& other) = delete;
+        TraversalOrder& operator=(TraversalOrder&& other) noexcept = delete;
+
+        /**
+         * \brief Marks the order as outdated, it will be rebuilt on next access.
+         */
+        void invalidate();
+
+        /**
+         * \brief Notifies the order that \p object and its descendants are removed from the tree. Called before they are destroyed.
+         * \param object The GameObject removed from the tree. Its children must still be set.
+         */
+        void onRemoved(const GameObject* object);
+
+        /**
+         * \brief Gets all the descendants of \p object in pre-order (the same order as \ref patterns::traverse_tree).
+         * \param object The GameObject to get the descendants of. It must be in the tree of this order.
+         * \return A \ref std::span over the descendants of \p object, excluding itself. It is invalidated when the tree changes.
+         */
+        [[nodiscard]] std::span<GameObject* const> descendants(const GameObject* object);
+
+        /**
+         * \brief Calls \p fn on every descendant of the root, in pre-order.
+         * \param fn The function to call with a pointer to each GameObject.
+         *
+         * If \p fn changes the tree, the order is rebuilt and the iteration continues after the current GameObject, so new objects placed after it are
+         * also visited. If \p fn removes the current GameObject from the tree (for example by destroying it), the iteration continues after the last
+         * visited GameObject still in the tree, without accessing the removed ones again. Any number of objects may be removed by a single call.
+         */
+        template <typename Fn>
+        void forEach(Fn&& fn);
+
+    private:
+        /**
+         * \brief Rebuilds the list if the tree changed since the last build.
+         */
+        void update();
+
+        /**
+         * \brief Appends \p object and all its descendants to the list.
+         * \param object The GameObject to append.
+         */
+        void append(GameObject* object);
+
+        /**
+         * \brief Clears the entries of \p object and its descendants in the list, so that \ref forEach does not access them anymore.
+         * \param object A GameObject removed from the tree.
+         */
+        void forget(const GameObject* object);
+
+        /**
+         * \brief Gets the index of \p object in the list.
+         * \param object A GameObject of the tree.
+         * \return The index of \p object.
+         */
+        [[nodiscard]] std::size_t indexOf(const GameObject* object) const;
+
+    private:
+        GameObject* m_root = nullptr;
+        bool m_dirty = true;
+
+        /// \brief `true` while the function of \ref forEach is called.
+        bool m_visiting = false;
+
+        /// \brief The index in the list of the GameObject visited by \ref forEach, or of the last visited one still in the tree once it is rebuilt.
+        std::size_t m_visitedIndex = 0;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::core::details::TraversalOrder'
+
+        std::vector<GameObject*> m_objects;
+        SPARK_WARNING_POP
+    };
+}
+
+#include "spark/core/impl/TraversalOrder.h"
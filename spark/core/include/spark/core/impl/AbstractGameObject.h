@@ -1,13 +1,20 @@
 #pragma once
 
 #include <algorithm>
-#include <ranges>
+#include <utility>
 
 namespace spark::core::details
 {
     template <typename Impl>
     AbstractGameObject<Impl>::AbstractGameObject(GameObject* parent)
-        : Composite(parent) {}
+        : Composite(parent)
+    {
+        // Children share the components storage of their root
+        if (parent)
+            m_storage = static_cast<AbstractGameObject*>(parent)->m_storage;
+        else
+            m_storage = std::make_shared<ComponentStorage>();
+    }
 
     template <typename Impl>
     AbstractGameObject<Impl>::~AbstractGameObject()
@@ -15,9 +22,22 @@ namespace spark::core::details
         // Ensure onDestroyed() was called
         SPARK_CORE_ASSERT(!m_initialized)
 
-        for (const auto& [component, managed] : m_components | std::views::values)
-            if (managed)
-                delete component;
+        if (m_destroyed)
+            *m_destroyed = true;
+
+        // The tree may be iterating over this object, its traversal order must not access it anymore
+        auto* root = static_cast<AbstractGameObject*>(this->root());
+        if (root != this && root->m_traversalOrder)
+            root->m_traversalOrder->onRemoved(static_cast<GameObject*>(this));
+
+        for (const auto& entry : m_components)
+        {
+            if (!entry.removed)
+                entry.pool->erase(entry.component);
+            destroyComponent(entry);
+        }
+        if (m_hasRemovedComponents)
+            std::erase(s_objectsWithRemovedComponents, this);
     }
 
     template <typename Impl>
@@ -26,24 +46,44 @@ namespace spark::core::details
         if (m_initialized)
             return;
 
+        const DestructionGuard guard(*this);
         static_cast<Impl*>(this)->onSpawn();
-        std::ranges::for_each(m_components | std::views::values | std::views::keys,
-                              [](Component* component)
-                              {
-                                  component->onAttach();
-                              });
-        m_initialized = true;
+        for (std::size_t i = 0; !guard.destroyed() && i < m_components.size(); ++i)
+            if (!m_components[i].removed)
+                m_components[i].component->onAttach();
+        if (!guard.destroyed())
+            m_initialized = true;
     }
 
     template <typename Impl>
     void AbstractGameObject<Impl>::onUpdate(float dt)
     {
+        const DestructionGuard guard(*this);
         static_cast<Impl*>(this)->onUpdate(dt);
-        std::ranges::for_each(m_components | std::views::values | std::views::keys,
-                              [&dt](Component* component)
-                              {
-                                  component->onUpdate(dt);
-                              });
+        for (std::size_t i = 0; !guard.destroyed() && i < m_components.size(); ++i)
+            if (!m_components[i].removed)
+                m_components[i].component->onUpdate(dt);
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::onParallelUpdate(float dt)
+    {
+        if (static_cast<Impl*>(this)->hasThreadSafeUpdate())
+            static_cast<Impl*>(this)->onUpdate(dt);
+        for (std::size_t i = 0; i < m_components.size(); ++i)
+            if (m_components[i].threadSafeUpdate && !m_components[i].removed)
+                m_components[i].component->onUpdate(dt);
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::onSerialUpdate(float dt)
+    {
+        const DestructionGuard guard(*this);
+        if (!static_cast<Impl*>(this)->hasThreadSafeUpdate())
+            static_cast<Impl*>(this)->onUpdate(dt);
+        for (std::size_t i = 0; !guard.destroyed() && i < m_components.size(); ++i)
+            if (!m_components[i].threadSafeUpdate && !m_components[i].removed)
+                m_components[i].component->onUpdate(dt);
     }
 
     template <typename Impl>
@@ -52,12 +92,134 @@ namespace spark::core::details
         if (!m_initialized)
             return;
 
-        std::ranges::for_each(m_components | std::views::values | std::views::keys,
-                              [](Component* component)
-                              {
-                                  component->onDetach();
-                              });
+        for (std::size_t i = 0; i < m_components.size(); ++i)
+            if (!m_components[i].removed)
+                m_components[i].component->onDetach();
         static_cast<Impl*>(this)->onDestroyed();
         m_initialized = false;
     }
+
+    template <typename Impl>
+    bool AbstractGameObject<Impl>::hasParallelUpdate() const
+    {
+        return static_cast<const Impl*>(this)->hasThreadSafeUpdate()
+            || std::ranges::any_of(m_components, [](const ComponentEntry& entry) { return entry.threadSafeUpdate && !entry.removed; });
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::DestroyRemovedComponents()
+    {
+        for (AbstractGameObject* object : s_objectsWithRemovedComponents)
+        {
+            std::erase_if(object->m_components, [](const ComponentEntry& entry)
+            {
+                if (entry.removed)
+                    destroyComponent(entry);
+                return entry.removed;
+            });
+            object->m_hasRemovedComponents = false;
+        }
+        s_objectsWithRemovedComponents.clear();
+    }
+
+    template <typename Impl>
+    const ComponentStorage& AbstractGameObject<Impl>::componentStorage() const
+    {
+        return *m_storage;
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::onChildrenChanged()
+    {
+        auto* root = static_cast<AbstractGameObject*>(this->root());
+        if (root->m_traversalOrder)
+            root->m_traversalOrder->invalidate();
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::onParentChanged(GameObject* old_parent)
+    {
+        auto* root = static_cast<AbstractGameObject*>(this->root());
+        if (old_parent)
+        {
+            // The old tree may be iterating over this GameObject
+            auto* old_root = static_cast<AbstractGameObject*>(static_cast<AbstractGameObject*>(old_parent)->root());
+            if (old_root != root && old_root->m_traversalOrder)
+                old_root->m_traversalOrder->onRemoved(static_cast<GameObject*>(this));
+        }
+
+        if (root == this)
+        {
+            // The traversal order of a GameObject is not updated while it is not a root
+            if (m_traversalOrder)
+                m_traversalOrder->invalidate();
+
+            // A GameObject becoming a root gets its own storage, so the Scene it was in does not see its components anymore
+            moveComponents(std::make_shared<ComponentStorage>());
+        } else if (root->m_storage != m_storage)
+            moveComponents(root->m_storage);
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::destroyComponent(const ComponentEntry& entry)
+    {
+        if (entry.allocator)
+            entry.allocator->destroy(entry.component);
+        else if (entry.managed)
+            delete entry.component;
+    }
+
+    template <typename Impl>
+    void AbstractGameObject<Impl>::moveComponents(const std::shared_ptr<ComponentStorage>& storage)
+    {
+        bool has_allocated_components = false;
+        for (auto& entry : m_components)
+        {
+            // The memory of the components stays in their pool, only the pools used to iterate over them change
+            has_allocated_components |= entry.allocator != nullptr;
+            if (entry.removed)
+                continue;
+
+            ComponentPool& pool = storage->pool(*entry.type);
+            entry.pool->erase(entry.component);
+            pool.insert(entry.component);
+            entry.pool = &pool;
+        }
+
+        if (has_allocated_components && std::ranges::find(m_previousStorages, m_storage) == m_previousStorages.end())
+            m_previousStorages.push_back(m_storage);
+        m_storage = storage;
+
+        for (std::size_t i = 0; i < this->childCount(); ++i)
+            static_cast<AbstractGameObject*>(this->child(i))->moveComponents(storage);
+    }
+
+    template <typename Impl>
+    AbstractGameObject<Impl>::DestructionGuard::DestructionGuard(AbstractGameObject& object)
+        : m_object(&object), m_previous(std::exchange(object.m_destroyed, &m_isDestroyed)) {}
+
+    template <typename Impl>
+    AbstractGameObject<Impl>::DestructionGuard::~DestructionGuard()
+    {
+        // Forward the destruction to the enclosing guard, if any
+        if (!m_isDestroyed)
+            m_object->m_destroyed = m_previous;
+        else if (m_previous)
+            *m_previous = true;
+    }
+
+    template <typename Impl>
+    bool AbstractGameObject<Impl>::DestructionGuard::destroyed() const
+    {
+        return m_isDestroyed;
+    }
+
+    template <typename Impl>
+    TraversalOrder& AbstractGameObject<Impl>::traversalOrder()
+    {
+        auto* root = static_cast<AbstractGameObject*>(this->root());
+        if (!root->m_traversalOrder)
+            root->m_traversalOrder = std::make_unique<TraversalOrder>(static_cast<GameObject*>(root));
+        return *root->m_traversalOrder;
+    }
 }
@@ -44,6 +44,27 @@ namespace spark::core
         return ApplicationBuilder<details::application_tags::set_resize_policy, Tags...>(std::move(m_settings));
     }
 
+    template <typename... Tags>
+    ApplicationBuilder<details::application_tags::set_frames_in_flight_called, Tags...> ApplicationBuilder<Tags...>::setFramesInFlight(const unsigned frames_in_flight)
+    {
+        static_assert(!spark::mpl::typelist<Tags...>::template contains<details::application_tags::set_frames_in_flight_called>, "Cannot set frames in flight twice.");
+
+        if (frames_in_flight == 0)
+            throw spark::base::BadArgumentException("An application must have at least one frame in flight.");
+
+        m_settings.framesInFlight = frames_in_flight;
+        return ApplicationBuilder<details::application_tags::set_frames_in_flight_called, Tags...>(std::move(m_settings));
+    }
+
+    template <typename... Tags>
+    ApplicationBuilder<details::application_tags::set_instance_format_called, Tags...> ApplicationBuilder<Tags...>::setInstanceFormat(const InstanceFormat instance_format)
+    {
+        static_assert(!spark::mpl::typelist<Tags...>::template contains<details::application_tags::set_instance_format_called>, "Cannot set instance format twice.");
+
+        m_settings.instanceFormat = instance_format;
+        return ApplicationBuilder<details::application_tags::set_instance_format_called, Tags...>(std::move(m_settings));
+    }
+
     template <typename... Tags>
     std::unique_ptr<Application> ApplicationBuilder<Tags...>::build()
     {
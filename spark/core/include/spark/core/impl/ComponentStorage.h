@@ -0,0 +1,21 @@
+#pragma once
+
+#include <new>
+#include <utility>
+
+namespace spark::core::details
+{
+    template <typename T, typename... Args>
+    T* ComponentPool::create(Args&&... args)
+    {
+        void* slot = allocate(sizeof(T), alignof(T));
+        try
+        {
+            return ::new(slot) T(std::forward<Args>(args)...);
+        } catch (...)
+        {
+            deallocate(slot);
+            throw;
+        }
+    }
+}
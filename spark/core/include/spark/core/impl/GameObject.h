@@ -17,7 +17,8 @@ namespace spark::core
     template <typename T, typename... Args> requires std::is_base_of_v<Component, T>
     void GameObject::addComponent(Args&&... args)
     {
-        addComponent(new T(this, std::forward<Args>(args)...), true);
+        auto& pool = m_storage->pool(T::classRtti());
+        attachComponent(pool.template create<T>(this, std::forward<Args>(args)...), pool, true, true);
     }
 
     template <typename T> requires std::is_base_of_v<Component, T>
@@ -53,10 +54,12 @@ namespace spark::core
     template <typename T> requires std::is_base_of_v<Component, T>
     T* GameObject::component() const
     {
-        const auto it = m_components.find(&T::classRtti());
-        if (it == m_components.cend())
-            return nullptr;
-        return static_cast<T*>(it->second.first);
+        // A GameObject only holds a few components, a linear search is faster than any lookup table here
+        const rtti::RttiBase* type = &T::classRtti();
+        for (const auto& entry : m_components)
+            if (entry.type == type && !entry.removed)
+                return static_cast<T*>(entry.component);
+        return nullptr;
     }
 
     template <typename T> requires std::is_base_of_v<Component, T>
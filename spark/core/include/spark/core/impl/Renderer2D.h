@@ -2,6 +2,7 @@
 
 #include "spark/base/Exception.h"
 #include "spark/imgui/ImGui.h"
+#include "spark/jobs/JobSystem.h"
 #include "spark/lib/Pointers.h"
 #include "spark/log/Logger.h"
 #include "spark/path/Paths.h"
@@ -13,44 +14,66 @@
 #include "spark/render/InputAssembler.h"
 #include "spark/render/Rasterizer.h"
 #include "spark/render/RenderTarget.h"
+#include "spark/render/Sampler.h"
 #include "spark/render/ShaderStages.h"
 
+#include "glm/common.hpp"
 #include "glm/matrix.hpp"
+#include "glm/vector_relational.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <new>
+#include <utility>
+
 namespace spark::core
 {
     template <typename Backend>
     Renderer2D<Backend>::Renderer2D(const math::Vector2<unsigned>& render_area,
                                     std::function<typename surface_type::handle_type(const typename backend_type::handle_type&)> surface_factory,
-                                    std::span<std::string> required_extensions)
+                                    std::span<std::string> required_extensions,
+                                    const unsigned frames_in_flight,
+                                    const InstanceFormat instance_format)
+        : m_framesInFlight(frames_in_flight), m_instanceFormat(instance_format)
     {
+        if (frames_in_flight == 0)
+            throw base::BadArgumentException("A 2D renderer needs at least one frame in flight.");
+
         // Setup validation layers if needed
         std::vector<std::string> layers;
 #ifndef NDEBUG
         layers.emplace_back("VK_LAYER_KHRONOS_validation");
 #endif
 
-        log::info("Creating 2D renderer with a render area of {}x{}", render_area.x, render_area.y);
+        log::info("Creating 2D renderer with a render area of {}x{} and {} frames in flight", render_area.x, render_area.y, frames_in_flight);
 
         // Configure the render backend
         m_renderBackend = std::make_unique<backend_type>(required_extensions, layers);
         m_viewport = std::make_unique<render::Viewport>(math::Rectangle {{}, render_area.castTo<float>()});
         m_scissor = std::make_unique<render::Scissor>(math::Rectangle {{}, render_area.castTo<float>()});
+        m_visibleArea = glm::vec2(m_viewport->rectangle().extent.x, m_viewport->rectangle().extent.y);
 
         // Query the available graphics adapters and find a suitable one
         const adapter_type* selected_adapter = m_renderBackend->findAdapter(std::nullopt);
         if (!selected_adapter)
             throw base::NullPointerException("No suitable graphics adapter found");
 
-        // Create the surface and the device
+        // Create the surface and the device, with one more back buffer than frames in flight so that the presentation engine never stalls a frame
         auto surface = m_renderBackend->createSurface(surface_factory);
         m_device = m_renderBackend->template createDevice<backend_type>("Default",
                                                                         *selected_adapter,
                                                                         std::move(surface),
                                                                         render::Format::B8G8R8A8_UNORM,
                                                                         m_viewport->rectangle().extent.castTo<unsigned>(),
-                                                                        3);
+                                                                        m_framesInFlight + 1);
+
+        // Load the pipelines compiled by the previous runs before creating the pipelines of the renderer
+        m_device->loadPipelineCache(PipelineCacheDirectory());
+
+        // The uploads are submitted on the transfer queue, and the frames reading them wait for it on the GPU
+        m_uploads = std::make_unique<render::UploadManager>(dynamic_cast<const render::IGraphicsFactory&>(m_device->factory()), m_device->transferQueue());
 
         // Vertex and index buffer layouts
         auto vertex_buffer_layout = std::make_unique<vertex_buffer_layout_type>(sizeof(glm::vec3), 0);
@@ -83,11 +106,29 @@ namespace spark::core
                                     false,
                                     false);
 
-        auto render_pass = std::make_unique<render_pass_type>(*m_device, "Opaque", render_targets);
-
-        // Create the shader program
+        // Declare the passes drawing to the targets, ImGui is drawn over the geometry since both write the color target
+        m_renderGraph.addAttachment({.name = "Color Target", .type = render::RenderTargetType::Present, .format = render::Format::B8G8R8A8_UNORM, .size = render_area});
+        m_renderGraph.addAttachment({.name = "Depth/Stencil Target", .type = render::RenderTargetType::DepthStencil, .format = render::Format::D32_SFLOAT, .size = render_area});
+        m_renderGraph.addPass("Geometry", s_geometryParts, [this](const render::ICommandBuffer& command_buffer, const std::size_t part) { recordGeometry(command_buffer, part); })
+                .write("Color Target")
+                .write("Depth/Stencil Target");
+        m_renderGraph.addPass("ImGui",
+                              [](const render::ICommandBuffer& command_buffer)
+                              {
+                                  if (imgui::context())
+                                      imgui::render(command_buffer);
+                              })
+                .write("Color Target");
+        m_renderGraph.setOutput("Color Target");
+        m_renderGraph.compile();
+
+        // Each part of the passes of the graph records into its own command buffer, executed by the render pass in the order of the graph
+        auto render_pass = std::make_unique<render_pass_type>(*m_device, "Opaque", render_targets, static_cast<unsigned>(m_renderGraph.commandBufferCount()));
+
+        // Create the shader program, the vertex shader depends on the layout of the instances
+        const auto vertex_shader = m_instanceFormat == InstanceFormat::Compact ? "2d_compact_vert.spv" : "2d_vert.spv";
         std::vector<std::unique_ptr<shader_module_type>> modules;
-        modules.push_back(std::make_unique<shader_module_type>(*m_device, render::ShaderStage::Vertex, spark::path::engine_assets_path() / "shaders" / "2d_vert.spv"));
+        modules.push_back(std::make_unique<shader_module_type>(*m_device, render::ShaderStage::Vertex, spark::path::engine_assets_path() / "shaders" / vertex_shader));
         modules.push_back(std::make_unique<shader_module_type>(*m_device, render::ShaderStage::Fragment, spark::path::engine_assets_path() / "shaders" / "2d_frag.spv"));
 
         auto shader_program = std::make_shared<shader_program_type>(*m_device, std::move(modules));
@@ -111,16 +152,59 @@ namespace spark::core
         m_device->state().add(std::move(render_pass));
         m_device->state().add(std::move(render_pipeline));
 
+        // Create the compute pipeline culling the static instances, which are drawn unculled when the graphics queue cannot run compute shaders
+        const auto culling_shader = spark::path::engine_assets_path() / "shaders" / (m_instanceFormat == InstanceFormat::Compact ? "2d_compact_cull_comp.spv" : "2d_cull_comp.spv");
+        if ((m_device->graphicsQueue().type() & render::QueueType::Compute) != render::QueueType::None)
+        {
+            std::vector<std::unique_ptr<shader_module_type>> culling_modules;
+            culling_modules.push_back(std::make_unique<shader_module_type>(*m_device, render::ShaderStage::Compute, culling_shader));
+            auto culling_program = std::make_shared<shader_program_type>(*m_device, std::move(culling_modules));
+            m_device->state().add(std::make_unique<compute_pipeline_type>(*m_device,
+                                                                          culling_program,
+                                                                          std::static_pointer_cast<pipeline_layout_type>(culling_program->reflectPipelineLayout()),
+                                                                          "Culling"));
+            m_hasStaticCulling = true;
+        }
+        else
+            log::warning("The graphics queue does not support compute shaders, the static instances will not be culled.");
+
         // Init the render graph
         initRenderGraph();
     }
 
+    template <typename Backend>
+    Renderer2D<Backend>::Renderer2D(const math::Vector2<unsigned>& render_area,
+                                    std::span<std::string> required_extensions,
+                                    const unsigned frames_in_flight,
+                                    const InstanceFormat instance_format)
+        : Renderer2D(render_area,
+                     [](const typename backend_type::handle_type&) { return typename surface_type::handle_type {}; },
+                     required_extensions,
+                     frames_in_flight,
+                     instance_format) {}
+
     template <typename Backend>
     Renderer2D<Backend>::~Renderer2D()
     {
+        // The resources of the frames must be released before their device
+        m_device->wait();
+        m_frames.clear();
+        m_statics = {};
+        m_batches.clear();
+        m_atlasBinding.reset();
+        m_samplerBinding.reset();
+        m_atlasPages.clear();
+        m_atlasSampler.reset();
+
         m_renderBackend->releaseDevice("Default");
     }
 
+    template <typename Backend>
+    std::filesystem::path Renderer2D<Backend>::PipelineCacheDirectory()
+    {
+        return path::executable_path() / "cache";
+    }
+
     template <typename Backend>
     void Renderer2D<Backend>::recreateSwapChain(const math::Vector2<unsigned>& new_size)
     {
@@ -129,7 +213,7 @@ namespace spark::core
 
         // Recreate the swap chain
         const auto surface_format = m_device->swapChain().surfaceFormat();
-        m_device->swapChain().reset(surface_format, new_size, 3);
+        m_device->swapChain().reset(surface_format, new_size, m_framesInFlight + 1);
 
         // Resize the frame buffers for the render passes. It should be done in order to avoid since dependencies
         // (i.e. input attachments) are re-created and might be mapped to images that do no longer exist.
@@ -138,68 +222,106 @@ namespace spark::core
         // Resize viewport and scissor.
         m_viewport->setRectangle(math::Rectangle({0.f, 0.f}, new_size.castTo<float>()));
         m_scissor->setRectangle(math::Rectangle({0.f, 0.f}, new_size.castTo<float>()));
+        m_visibleArea = glm::vec2(m_viewport->rectangle().extent.x, m_viewport->rectangle().extent.y);
     }
 
     template <typename Backend>
     void Renderer2D<Backend>::initRenderGraph()
     {
-        auto& render_pipeline = m_device->state().pipeline("Geometry");
-        auto command_buffer = m_device->transferQueue().createCommandBuffer(true, false);
-
-        // Create the vertex buffer
-        auto staged_vertex_buffer = m_device->factory().createVertexBuffer(m_inputAssembler->vertexBufferLayout(0),
-                                                                           render::BufferUsage::Staging,
-                                                                           static_cast<unsigned>(s_rectangleVertices.size()));
-
+        // Create the vertex and index buffers, uploaded with the first frame
         auto vertex_buffer = m_device->factory().createVertexBuffer("Vertex Buffer",
                                                                     m_inputAssembler->vertexBufferLayout(0),
                                                                     render::BufferUsage::Resource,
                                                                     static_cast<unsigned>(s_rectangleVertices.size()));
 
-        staged_vertex_buffer->map(s_rectangleVertices.data(), s_rectangleVertices.size() * sizeof(glm::vec3), 0);
-        command_buffer->transfer(std::move(staged_vertex_buffer), *vertex_buffer, 0, 0, static_cast<unsigned>(s_rectangleVertices.size()));
-
-        // Create the index buffer
-        auto staged_indices_buffer = m_device->factory().createIndexBuffer(m_inputAssembler->indexBufferLayout(),
-                                                                           render::BufferUsage::Staging,
-                                                                           static_cast<unsigned>(s_rectangleIndices.size()));
-
         auto index_buffer = m_device->factory().createIndexBuffer("Index Buffer",
                                                                   m_inputAssembler->indexBufferLayout(),
                                                                   render::BufferUsage::Resource,
                                                                   static_cast<unsigned>(s_rectangleIndices.size()));
 
-        staged_indices_buffer->map(s_rectangleIndices.data(), s_rectangleIndices.size() * sizeof(uint16_t), 0);
-        command_buffer->transfer(std::move(staged_indices_buffer), *index_buffer, 0, 0, static_cast<unsigned>(s_rectangleIndices.size()));
+        m_uploads->upload(s_rectangleVertices.data(), s_rectangleVertices.size() * sizeof(glm::vec3), *vertex_buffer);
+        m_uploads->upload(s_rectangleIndices.data(), s_rectangleIndices.size() * sizeof(uint16_t), *index_buffer);
+
+        // Create the resources of each frame in flight
+        m_frames.resize(m_framesInFlight);
+        for (FrameResources& frame : m_frames)
+            resizeInstances(frame.instances, s_initialInstances);
+        m_statics.streams.resize(m_frames.size());
+        m_statics.dirty.resize(m_frames.size());
+
+        // Bind the texture atlas before it has any page, the instances only sample it when they are textured. The backend factories override the
+        // functions of the interface without its default arguments, so all of them are passed
+        const auto& pipeline_layout = *m_device->state().pipeline("Geometry").layout();
+        m_atlasSampler = m_device->factory().createSampler(render::FilterMode::Linear,
+                                                           render::FilterMode::Linear,
+                                                           render::BorderMode::ClampToEdge,
+                                                           render::BorderMode::ClampToEdge,
+                                                           render::BorderMode::ClampToEdge,
+                                                           render::MipMapMode::Nearest,
+                                                           0.f,
+                                                           std::numeric_limits<float>::max(),
+                                                           0.f,
+                                                           0.f);
+        m_samplerBinding = pipeline_layout.descriptorSet(3).allocate();
+        m_samplerBinding->update(0, *m_atlasSampler);
+        m_atlasBinding = pipeline_layout.descriptorSet(2).allocate(1);
 
-        // Create the transform bindings and buffer
-        auto& instance_binding_layout = render_pipeline.layout()->descriptorSet(0);
+        m_device->state().add(lib::static_unique_pointer_cast<render::IVertexBuffer>(std::move(vertex_buffer)));
+        m_device->state().add(lib::static_unique_pointer_cast<render::IIndexBuffer>(std::move(index_buffer)));
+    }
 
-        // Since we are using an unstructured storage buffer, we need to specify the element size manually.
-        auto staged_instance_buffer = lib::dynamic_unique_pointer_cast<buffer_type>(dynamic_cast<const render::IGraphicsFactory&>(m_device->factory()).
-                                                                                    createBuffer("Instance Staging Buffer",
-                                                                                                 instance_binding_layout,
-                                                                                                 0,
-                                                                                                 render::BufferUsage::Staging,
-                                                                                                 sizeof(InstanceBuffer),
-                                                                                                 s_maxInstances));
+    template <typename Backend>
+    void Renderer2D<Backend>::recordGeometry(const render::ICommandBuffer& command_buffer, const std::size_t part)
+    {
+        // Share the instances evenly between the parts, the parts past the last one needed for the instances of the frame stay empty
+        std::size_t total_instances = 0;
+        for (const InstanceStream* stream : m_frameStreams)
+            total_instances += stream->count;
+        const std::size_t parts = std::clamp<std::size_t>(total_instances / s_minInstancesPerPart, 1, s_geometryParts);
+        const bool draws_statics = part == 0 && m_hasStaticCulling && m_statics.streams[m_currentFrame].count > 0;
+        const bool draws_instances = part < parts && total_instances > 0;
+        if (!draws_statics && !draws_instances)
+            return;
+        const std::size_t first_instance = total_instances * part / parts, last_instance = total_instances * (part + 1) / parts;
 
-        auto instance_buffer = lib::dynamic_unique_pointer_cast<buffer_type>(dynamic_cast<const render::IGraphicsFactory&>(m_device->factory()).createBuffer("Instance Buffer",
-                                                                                      instance_binding_layout,
-                                                                                      0,
-                                                                                      render::BufferUsage::Resource,
-                                                                                      sizeof(InstanceBuffer),
-                                                                                      s_maxInstances));
+        const auto& geometry_pipeline = m_device->state().pipeline("Geometry");
+        const auto& vertex_buffer = m_device->state().vertexBuffer("Vertex Buffer");
+        const auto& index_buffer = m_device->state().indexBuffer("Index Buffer");
 
-        auto instance_binding = instance_binding_layout.allocate(s_maxInstances, {{0, *instance_buffer}});
+        command_buffer.use(geometry_pipeline);
+        command_buffer.setViewport(m_viewport.get());
+        command_buffer.setScissor(m_scissor.get());
 
-        m_transferFences.push_back(m_device->transferQueue().submit(command_buffer));
+        // Set up the camera
+        updateCamera(command_buffer);
+
+        // Bind the textures, vertex and index buffers, and draw the part of the static instances, the batches, then the instances of the frame
+        command_buffer.bind(*m_atlasBinding);
+        command_buffer.bind(*m_samplerBinding);
+        command_buffer.bind(vertex_buffer);
+        command_buffer.bind(index_buffer);
+
+        // The visible static instances are counted by the culling of the frame, which writes the arguments of the draw
+        if (draws_statics)
+        {
+            const FrameResources& frame = m_frames[m_currentFrame];
+            command_buffer.bind(*frame.culling.visibleBinding);
+            command_buffer.drawIndexedIndirect(*frame.culling.arguments);
+        }
+        if (!draws_instances)
+            return;
 
-        m_device->state().add(lib::static_unique_pointer_cast<render::IVertexBuffer>(std::move(vertex_buffer)));
-        m_device->state().add(lib::static_unique_pointer_cast<render::IIndexBuffer>(std::move(index_buffer)));
-        m_device->state().add(std::move(staged_instance_buffer));
-        m_device->state().add(std::move(instance_buffer));
-        m_device->state().add("Instance Binding", std::move(instance_binding));
+        std::size_t stream_offset = 0;
+        for (const InstanceStream* stream : m_frameStreams)
+        {
+            const std::size_t first = std::max(first_instance, stream_offset), last = std::min(last_instance, stream_offset + stream->count);
+            if (first < last)
+            {
+                command_buffer.bind(*stream->binding);
+                command_buffer.drawIndexed(index_buffer.elements(), static_cast<unsigned>(last - first), 0, 0, static_cast<unsigned>(first - stream_offset));
+            }
+            stream_offset += stream->count;
+        }
     }
 
     template <typename Backend>
@@ -213,26 +335,73 @@ namespace spark::core
     }
 
     template <typename Backend>
-    void Renderer2D<Backend>::upload()
+    void Renderer2D<Backend>::uploadTextureAtlas()
     {
-        if (m_instanceData.empty()) // Nothing to upload
+        const auto dirty_pages = m_textureAtlas.dirtyPages();
+        if (dirty_pages.empty())
             return;
 
-        // Create a command buffer
-        auto command_buffer = m_device->transferQueue().createCommandBuffer(true, false);
+        // The frames in flight may still sample the modified pages, so they are written into new textures instead of waiting for the frames. The
+        // replaced textures are released with the resources of this frame, once the GPU finished it and therefore all the frames before it.
+        FrameResources& frame = acquireFrame();
+        const std::size_t page_count = m_textureAtlas.pageCount();
+        const unsigned page_size = m_textureAtlas.pageSize();
+        m_atlasPages.resize(page_count);
+
+        // Queue the upload of the modified pages, submitted with the other uploads before the next frame is drawn
+        for (const std::size_t page : dirty_pages)
+        {
+            if (m_atlasPages[page])
+                frame.retiredPages.push_back(std::move(m_atlasPages[page]));
+            m_atlasPages[page] = m_device->factory().createTexture(render::Format::R8G8B8A8_UNORM,
+                                                                   {page_size, page_size, 1},
+                                                                   render::ImageDimensions::DIM_2,
+                                                                   1,
+                                                                   1,
+                                                                   render::MultiSamplingLevel::X1,
+                                                                   false);
+
+            const auto pixels = m_textureAtlas.pixels(page);
+            m_uploads->upload(pixels.data(), pixels.size(), *m_atlasPages[page]);
+        }
+        m_textureAtlas.clearDirtyPages();
+
+        // Bind the new textures with a new binding, the previous one being retired as well since the frames in flight may still use it
+        if (m_atlasBinding)
+            frame.retiredAtlasBindings.push_back(std::move(m_atlasBinding));
+        m_atlasBinding = m_device->state().pipeline("Geometry").layout()->descriptorSet(2).allocate(static_cast<unsigned>(page_count));
+        for (unsigned page = 0; page < page_count; ++page)
+            m_atlasBinding->update(0, *m_atlasPages[page], page);
+    }
 
-        // Transfer frame data to the instance buffer
-        auto& staged_instance_buffer = dynamic_cast<buffer_type&>(m_device->state().buffer("Instance Staging Buffer"));
-        staged_instance_buffer.map(static_cast<const void*>(m_instanceData.data()), m_instanceData.size() * sizeof(InstanceBuffer), 0);
+    template <typename Backend>
+    unsigned Renderer2D<Backend>::framesInFlight() const noexcept
+    {
+        return m_framesInFlight;
+    }
 
-        command_buffer->transfer(staged_instance_buffer,
-                                 dynamic_cast<buffer_type&>(m_device->state().buffer("Instance Buffer")),
-                                 0,
-                                 0,
-                                 static_cast<unsigned>(m_instanceData.size()));
+    template <typename Backend>
+    InstanceFormat Renderer2D<Backend>::instanceFormat() const noexcept
+    {
+        return m_instanceFormat;
+    }
+
+    template <typename Backend>
+    std::size_t Renderer2D<Backend>::instanceSize() const noexcept
+    {
+        return m_frames[m_currentFrame].instances.stride;
+    }
 
-        // Submit the command buffer
-        m_transferFences.push_back(m_device->transferQueue().submit(command_buffer));
+    template <typename Backend>
+    const RenderStatistics& Renderer2D<Backend>::statistics() const noexcept
+    {
+        return m_lastStatistics;
+    }
+
+    template <typename Backend>
+    const render::IGpuProfiler& Renderer2D<Backend>::profiler() const noexcept
+    {
+        return m_device->profiler();
     }
 
     template <typename Backend>
@@ -240,64 +409,585 @@ namespace spark::core
     {
         // Swap the back buffers for the next frame
         const auto back_buffer = m_device->swapChain().swapBackBuffer();
+        m_lastBackBuffer = back_buffer;
 
-        // TODO: Cache this instead of looking them up every frame
-        auto& render_pass = m_device->state().renderPass("Opaque");
-        const auto& geometry_pipeline = m_device->state().pipeline("Geometry");
-        const auto& instance_binding = m_device->state().descriptorSet("Instance Binding");
-        const auto& vertex_buffer = m_device->state().vertexBuffer("Vertex Buffer");
-        const auto& index_buffer = m_device->state().indexBuffer("Index Buffer");
+        // Read the GPU measures of an older frame, and start measuring the passes of this one
+        m_device->profiler().beginFrame();
 
-        // Upload the new instance data for the current frame
-        upload();
+        auto& render_pass = m_device->state().renderPass("Opaque");
 
-        // Begin rendering on the render pass and use the only pipeline created for it
+        // The culling, the uploads and the frame are handed to the GPU at once when the frame is submitted
+        m_device->graphicsQueue().beginBatch();
+
+        // The instances of the frame are already in the mapped memory of its resources, only the retained instances which changed are written
+        FrameResources& frame = acquireFrame();
+        const InstanceStream& statics = uploadRetained(m_statics);
+        m_statistics.statics = statics.count;
+
+        // The static instances are culled on the GPU when possible, otherwise they are all drawn with the other instances
+        m_frameStreams.clear();
+        if (m_hasStaticCulling)
+            cullStatics(frame, statics);
+        else
+            m_frameStreams.push_back(&statics);
+        for (const InstanceBatch batch : m_drawnBatches)
+            if (m_batches[batch])
+                m_frameStreams.push_back(&uploadRetained(*m_batches[batch]));
+        m_frameStreams.push_back(&frame.instances);
+
+        // Upload the textures loaded since the last frame, then submit all the uploads of the frame at once. The frame waits for them on the GPU,
+        // so that they run alongside the previous frames instead of stalling this thread.
+        uploadTextureAtlas();
+        if (m_uploads->pendingUploads() > 0)
+            m_device->graphicsQueue().waitForQueue(m_device->transferQueue(), m_uploads->flush());
+
+        // Begin rendering on the render pass, which begins the command buffers of the passes
         render_pass.begin(back_buffer);
 
-        // Wait for all transfers to finish
-        for (const auto& fence : m_transferFences)
-            m_device->transferQueue().waitFor(fence);
-        m_transferFences.clear();
+        // Record the passes of the graph, the parts of the independent ones in parallel since each command buffer has its own command pool
+        const auto& frame_buffer = render_pass.activeFrameBuffer();
+        m_renderGraph.execute([&frame_buffer](const std::size_t pass) -> const render::ICommandBuffer& { return *frame_buffer.commandBuffer(static_cast<unsigned>(pass)); },
+                              [this](const std::size_t count, const std::function<void(std::size_t)>& record)
+                              {
+                                  if (m_jobSystem && count > 1)
+                                      jobs::parallel_for(*m_jobSystem, 0, count, record, 1);
+                                  else
+                                      for (std::size_t pass = 0; pass < count; ++pass)
+                                          record(pass);
+                              });
+
+        // Present the frame by ending the render pass
+        render_pass.end();
+        m_device->graphicsQueue().endBatch();
+
+        // The resources can be written again once the GPU finished this frame, prepare the next frames with the other ones meanwhile
+        frame.fence = m_device->graphicsQueue().currentFence();
+        frame.instances.count = 0;
+        m_frameStreams.clear();
+        m_drawnBatches.clear();
+        const std::size_t command_buffer_allocations = m_device->graphicsQueue().commandBufferAllocations();
+        m_statistics.commandBufferAllocations = static_cast<unsigned>(command_buffer_allocations - std::exchange(m_commandBufferAllocations, command_buffer_allocations));
+        m_lastStatistics = std::exchange(m_statistics, {});
+        m_currentFrame = (m_currentFrame + 1) % m_frames.size();
+        m_isFrameAcquired = false;
+    }
 
-        const auto command_buffer = render_pass.activeFrameBuffer().commandBuffer(0);
-        command_buffer->use(geometry_pipeline);
-        command_buffer->setViewport(m_viewport.get());
-        command_buffer->setScissor(m_scissor.get());
+    template <typename Backend>
+    std::vector<std::byte> Renderer2D<Backend>::readBack() const
+    {
+        if (!m_device->swapChain().isOffscreen())
+            throw base::BadArgumentException("Only the frames of a headless renderer can be read back.");
+        return m_device->swapChain().readBack(m_lastBackBuffer);
+    }
 
-        // Set up the camera
-        updateCamera(*command_buffer);
+    template <typename Backend>
+    void Renderer2D<Backend>::setJobSystem(jobs::JobSystem* job_system) noexcept
+    {
+        m_jobSystem = job_system;
+    }
 
-        // Bind the vertex and index buffers
-        command_buffer->bind(instance_binding);
-        command_buffer->bind(vertex_buffer);
-        command_buffer->bind(index_buffer);
+    template <typename Backend>
+    void Renderer2D<Backend>::drawQuad(const glm::mat4& transform_matrix, const spark::math::Vector4<float>& color)
+    {
+        drawInstance(transform_matrix, color, 0.f, nullptr);
+    }
 
-        // Draw the object and present the frame by ending the render pass
-        command_buffer->drawIndexed(index_buffer.elements(), static_cast<unsigned>(m_instanceData.size()));
-        // TODO: Render ImGui on another render pass (so this can be ordered as we want)
-        imgui::render(*command_buffer);
-        render_pass.end();
+    template <typename Backend>
+    void Renderer2D<Backend>::drawCircle(const glm::mat4& transform_matrix, const float radius, const spark::math::Vector4<float>& color)
+    {
+        drawInstance(transform_matrix, color, radius, nullptr);
+    }
 
-        // Clean up the instance data for the next frame
-        m_instanceData.clear();
+    template <typename Backend>
+    void Renderer2D<Backend>::drawSprite(const glm::mat4& transform_matrix, const AtlasRegion& texture, const spark::math::Vector4<float>& color)
+    {
+        drawInstance(transform_matrix, color, 0.f, &texture);
     }
 
     template <typename Backend>
-    void Renderer2D<Backend>::drawQuad(const glm::mat4& transform_matrix, const spark::math::Vector4<float>& color)
+    void Renderer2D<Backend>::drawQuad(const glm::mat3x2& transform_matrix, const spark::math::Vector4<float>& color)
     {
-        m_instanceData.emplace_back(InstanceBuffer {
-                                        .transform = transform_matrix,
-                                        .color = glm::vec4(color.x, color.y, color.z, color.w),
-                                    });
+        drawInstance(transform_matrix, color, 0.f, nullptr);
     }
 
     template <typename Backend>
-    void Renderer2D<Backend>::drawCircle(const glm::mat4& transform_matrix, const float radius, const spark::math::Vector4<float>& color)
+    void Renderer2D<Backend>::drawCircle(const glm::mat3x2& transform_matrix, const float radius, const spark::math::Vector4<float>& color)
+    {
+        drawInstance(transform_matrix, color, radius, nullptr);
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::drawSprite(const glm::mat3x2& transform_matrix, const AtlasRegion& texture, const spark::math::Vector4<float>& color)
+    {
+        drawInstance(transform_matrix, color, 0.f, &texture);
+    }
+
+    template <typename Backend>
+    StaticInstance Renderer2D<Backend>::addStatic(const glm::mat3x2& transform_matrix,
+                                                  const spark::math::Vector4<float>& color,
+                                                  const float radius,
+                                                  const AtlasRegion* texture,
+                                                  const bool visible)
+    {
+        StaticInstance instance = 0;
+        if (!m_freeStatics.empty())
+        {
+            instance = m_freeStatics.back();
+            m_freeStatics.pop_back();
+            m_isStaticAlive[instance] = true;
+        } else
+        {
+            if (m_statics.instances.size() == s_maxInstances)
+                throw base::ArgumentOutOfRangeException(std::format("Unable to keep more than {} static instances.", s_maxInstances));
+            instance = static_cast<StaticInstance>(m_statics.instances.size());
+            m_statics.instances.emplace_back();
+            m_isStaticAlive.push_back(true);
+        }
+
+        setRetained(m_statics, instance, {.transform = transform_matrix, .color = color, .radius = radius, .texture = texture, .isVisible = visible});
+        return instance;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::updateStatic(const StaticInstance instance,
+                                           const glm::mat3x2& transform_matrix,
+                                           const spark::math::Vector4<float>& color,
+                                           const float radius,
+                                           const AtlasRegion* texture,
+                                           const bool visible)
+    {
+        if (instance >= m_isStaticAlive.size() || !m_isStaticAlive[instance])
+            throw base::ArgumentOutOfRangeException(std::format("The static instance {} does not exist.", instance));
+        setRetained(m_statics, instance, {.transform = transform_matrix, .color = color, .radius = radius, .texture = texture, .isVisible = visible});
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::removeStatic(const StaticInstance instance)
+    {
+        // Removing an instance twice would list its identifier twice as free, and give it to two instances
+        if (instance >= m_isStaticAlive.size() || !m_isStaticAlive[instance])
+            throw base::ArgumentOutOfRangeException(std::format("The static instance {} does not exist.", instance));
+
+        setRetained(m_statics, instance, {});
+        m_isStaticAlive[instance] = false;
+        m_freeStatics.push_back(instance);
+    }
+
+    template <typename Backend>
+    InstanceBatch Renderer2D<Backend>::createBatch(const unsigned capacity)
+    {
+        if (capacity == 0 || capacity > s_maxInstances)
+            throw base::BadArgumentException(std::format("An instance batch holds between 1 and {} instances, but {} were requested.", s_maxInstances, capacity));
+
+        auto batch = std::make_unique<RetainedBatch>();
+        batch->instances.resize(capacity);
+        batch->streams.resize(m_frames.size());
+        batch->dirty.resize(m_frames.size());
+
+        if (!m_freeBatches.empty())
+        {
+            const InstanceBatch id = m_freeBatches.back();
+            m_freeBatches.pop_back();
+            m_batches[id] = std::move(batch);
+            return id;
+        }
+        m_batches.push_back(std::move(batch));
+        return static_cast<InstanceBatch>(m_batches.size() - 1);
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::updateBatch(const InstanceBatch batch,
+                                          const unsigned instance,
+                                          const glm::mat3x2& transform_matrix,
+                                          const spark::math::Vector4<float>& color,
+                                          const float radius,
+                                          const AtlasRegion* texture,
+                                          const bool visible)
+    {
+        RetainedBatch& retained = retainedBatch(batch);
+        if (instance >= retained.instances.size())
+            throw base::ArgumentOutOfRangeException(std::format("The instance {} does not exist in a batch of {} instances.", instance, retained.instances.size()));
+        setRetained(retained, instance, {.transform = transform_matrix, .color = color, .radius = radius, .texture = texture, .isVisible = visible});
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::drawBatch(const InstanceBatch batch, const glm::mat3x2& bounds)
+    {
+        const auto count = static_cast<unsigned>(retainedBatch(batch).instances.size());
+        if (!isVisible(bounds[0], bounds[1], bounds[2]))
+        {
+            m_statistics.culled += count;
+            return;
+        }
+
+        m_drawnBatches.push_back(batch);
+        m_statistics.submitted += count;
+        ++m_statistics.batches;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::destroyBatch(const InstanceBatch batch)
+    {
+        // Each frame may still be reading its copy of the batch, which is released with the other resources of the frame once it is finished
+        RetainedBatch& retained = retainedBatch(batch);
+        for (std::size_t i = 0; i < m_frames.size(); ++i)
+            if (retained.streams[i].buffer)
+                m_frames[i].retired.push_back(std::move(retained.streams[i]));
+
+        m_batches[batch].reset();
+        m_freeBatches.push_back(batch);
+    }
+
+    template <typename Backend>
+    const AtlasRegion& Renderer2D<Backend>::loadTexture(const std::filesystem::path& path)
+    {
+        return m_textureAtlas.load(path);
+    }
+
+    template <typename Backend>
+    TextureAtlas& Renderer2D<Backend>::textureAtlas() noexcept
+    {
+        return m_textureAtlas;
+    }
+
+    template <typename Backend>
+    const Font& Renderer2D<Backend>::loadFont(const std::filesystem::path& path)
+    {
+        auto& font = m_fonts[path.generic_string()];
+        if (!font)
+            font = std::make_unique<Font>(path, m_textureAtlas);
+        return *font;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::drawText(const glm::mat3x2& transform_matrix, const TextLayout& layout, const spark::math::Vector4<float>& color)
+    {
+        for (const TextLayout::Glyph& glyph : layout.glyphs)
+        {
+            // Scale the centered 1x1 quad to the size of the glyph and move it to the center of the glyph, in the space of the text
+            const glm::vec2 x_axis = transform_matrix[0] * glyph.size.x, y_axis = transform_matrix[1] * glyph.size.y;
+            const glm::vec2 center = transform_matrix[2] + transform_matrix[0] * (glyph.position.x + glyph.size.x / 2)
+                + transform_matrix[1] * (glyph.position.y + glyph.size.y / 2);
+            drawInstance(glm::mat3x2(x_axis, y_axis, center), color, 0.f, glyph.texture, true);
+        }
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::drawInstance(const glm::mat4& transform_matrix, const spark::math::Vector4<float>& color, const float radius, const AtlasRegion* texture, const bool is_distance_field)
+    {
+        if (!isVisible(glm::vec2(transform_matrix[0]), glm::vec2(transform_matrix[1]), glm::vec2(transform_matrix[3])))
+        {
+            ++m_statistics.culled;
+            return;
+        }
+
+        void* instance = nextInstance();
+        if (!instance)
+            return;
+        ++m_statistics.submitted;
+        writeInstance(instance, transform_matrix, color, radius, texture, is_distance_field);
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::drawInstance(const glm::mat3x2& transform_matrix, const spark::math::Vector4<float>& color, const float radius, const AtlasRegion* texture, const bool is_distance_field)
+    {
+        if (!isVisible(transform_matrix[0], transform_matrix[1], transform_matrix[2]))
+        {
+            ++m_statistics.culled;
+            return;
+        }
+
+        void* instance = nextInstance();
+        if (!instance)
+            return;
+        ++m_statistics.submitted;
+        writeInstance(instance, transform_matrix, color, radius, texture, is_distance_field);
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::writeInstance(void* memory,
+                                            const glm::mat4& transform_matrix,
+                                            const spark::math::Vector4<float>& color,
+                                            const float radius,
+                                            const AtlasRegion* texture,
+                                            const bool is_distance_field) const
+    {
+        if (m_instanceFormat == InstanceFormat::Full)
+            new(memory) InstanceBuffer {
+                .transform = transform_matrix,
+                .color = glm::vec4(color.x, color.y, color.z, color.w),
+                .uv = texture ? glm::vec4(texture->uv.x, texture->uv.y, texture->uv.z, texture->uv.w) : glm::vec4(0.f),
+                .radius = radius,
+                .texture = texture ? texture->page | (is_distance_field ? s_distanceField : 0) : s_noTexture
+            };
+        else
+            new(memory) CompactInstanceBuffer {
+                .xAxis = glm::vec2(transform_matrix[0]),
+                .yAxis = glm::vec2(transform_matrix[1]),
+                .translation = glm::vec2(transform_matrix[3]),
+                .color = PackColor(color),
+                .radius = radius,
+                .uvMin = texture ? PackUv(texture->uv.x, texture->uv.y) : 0,
+                .uvMax = texture ? PackUv(texture->uv.z, texture->uv.w) : 0,
+                .texture = texture ? texture->page | (is_distance_field ? s_distanceField : 0) : s_noTexture
+            };
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::writeInstance(void* memory,
+                                            const glm::mat3x2& transform_matrix,
+                                            const spark::math::Vector4<float>& color,
+                                            const float radius,
+                                            const AtlasRegion* texture,
+                                            const bool is_distance_field) const
+    {
+        if (m_instanceFormat == InstanceFormat::Full)
+            new(memory) InstanceBuffer {
+                .transform = glm::mat4(glm::vec4(transform_matrix[0], 0.f, 0.f),
+                                       glm::vec4(transform_matrix[1], 0.f, 0.f),
+                                       glm::vec4(0.f, 0.f, 1.f, 0.f),
+                                       glm::vec4(transform_matrix[2], 0.f, 1.f)),
+                .color = glm::vec4(color.x, color.y, color.z, color.w),
+                .uv = texture ? glm::vec4(texture->uv.x, texture->uv.y, texture->uv.z, texture->uv.w) : glm::vec4(0.f),
+                .radius = radius,
+                .texture = texture ? texture->page | (is_distance_field ? s_distanceField : 0) : s_noTexture
+            };
+        else
+            new(memory) CompactInstanceBuffer {
+                .xAxis = transform_matrix[0],
+                .yAxis = transform_matrix[1],
+                .translation = transform_matrix[2],
+                .color = PackColor(color),
+                .radius = radius,
+                .uvMin = texture ? PackUv(texture->uv.x, texture->uv.y) : 0,
+                .uvMax = texture ? PackUv(texture->uv.z, texture->uv.w) : 0,
+                .texture = texture ? texture->page | (is_distance_field ? s_distanceField : 0) : s_noTexture
+            };
+    }
+
+    template <typename Backend>
+    std::uint32_t Renderer2D<Backend>::PackColor(const spark::math::Vector4<float>& color) noexcept
+    {
+        const auto channel = [](const float value)
+        {
+            return static_cast<std::uint32_t>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+        };
+        return channel(color.x) | channel(color.y) << 8 | channel(color.z) << 16 | channel(color.w) << 24;
+    }
+
+    template <typename Backend>
+    std::uint32_t Renderer2D<Backend>::PackUv(const float u, const float v) noexcept
+    {
+        const auto coordinate = [](const float value)
+        {
+            return static_cast<std::uint32_t>(std::clamp(value, 0.f, 1.f) * 65535.f + 0.5f);
+        };
+        return coordinate(u) | coordinate(v) << 16;
+    }
+
+    template <typename Backend>
+    bool Renderer2D<Backend>::isVisible(const glm::vec2& x_axis, const glm::vec2& y_axis, const glm::vec2& center) const noexcept
+    {
+        // The bounds of the quad are the extents of its axes around its center, compared with the area seen by the camera without branching per axis
+        const glm::vec2 half_extent = (glm::abs(x_axis) + glm::abs(y_axis)) * 0.5f;
+        return glm::all(glm::greaterThanEqual(center + half_extent, glm::vec2(0.f))) && glm::all(glm::lessThanEqual(center - half_extent, m_visibleArea));
+    }
+
+    template <typename Backend>
+    typename Renderer2D<Backend>::FrameResources& Renderer2D<Backend>::acquireFrame()
+    {
+        FrameResources& frame = m_frames[m_currentFrame];
+
+        // Wait for the GPU to finish the last frame which used the resources. This only blocks when the CPU is more than `m_framesInFlight` frames ahead.
+        if (!m_isFrameAcquired)
+        {
+            m_device->graphicsQueue().waitFor(frame.fence);
+            frame.retired.clear();
+            frame.retiredPages.clear();
+            frame.retiredAtlasBindings.clear();
+            m_isFrameAcquired = true;
+        }
+        return frame;
+    }
+
+    template <typename Backend>
+    void* Renderer2D<Backend>::nextInstance()
+    {
+        InstanceStream& instances = acquireFrame().instances;
+        if (instances.count == instances.capacity)
+        {
+            if (instances.capacity == s_maxInstances)
+            {
+                if (!m_isFullWarningLogged)
+                    log::warning("Unable to draw more than {} instances in a frame, the next ones are ignored.", s_maxInstances);
+                m_isFullWarningLogged = true;
+                return nullptr;
+            }
+            resizeInstances(instances, std::min(instances.capacity * 2, s_maxInstances));
+        }
+
+        return instances.memory + instances.stride * instances.count++;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::resizeInstances(InstanceStream& stream, const unsigned capacity)
+    {
+        const auto& instance_binding_layout = m_device->state().pipeline("Geometry").layout()->descriptorSet(0);
+
+        // Since we are using an unstructured storage buffer, we need to specify the element size manually.
+        const std::size_t instance_size = m_instanceFormat == InstanceFormat::Compact ? sizeof(CompactInstanceBuffer) : sizeof(InstanceBuffer);
+        auto buffer = lib::dynamic_unique_pointer_cast<buffer_type>(dynamic_cast<const render::IGraphicsFactory&>(m_device->factory()).createBuffer(instance_binding_layout,
+                                                                                                                                             0,
+                                                                                                                                             render::BufferUsage::Dynamic,
+                                                                                                                                             instance_size,
+                                                                                                                                             capacity));
+        auto* memory = static_cast<std::byte*>(buffer->mappedMemory());
+        if (!memory)
+            throw base::NullPointerException("The instance buffer is not persistently mapped.");
+
+        // Keep the instances already written
+        if (stream.count > 0)
+            std::memcpy(memory, stream.memory, stream.stride * stream.count);
+
+        // Release the previous binding before allocating the new one, since bindings of unbounded arrays are not cached
+        stream.binding.reset();
+        stream.binding = instance_binding_layout.allocate(capacity, {{0, *buffer}});
+        stream.buffer = std::move(buffer);
+        stream.memory = memory;
+        stream.stride = stream.buffer->alignedElementSize();
+        stream.capacity = capacity;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::setRetained(RetainedBatch& batch, const unsigned instance, const RetainedInstanceData& data)
+    {
+        // Only write the instances which changed, the others stay as they are on the GPU
+        if (batch.instances[instance] == data)
+            return;
+
+        batch.instances[instance] = data;
+        for (std::vector<unsigned>& dirty : batch.dirty)
+            dirty.push_back(instance);
+    }
+
+    template <typename Backend>
+    typename Renderer2D<Backend>::InstanceStream& Renderer2D<Backend>::uploadRetained(RetainedBatch& batch)
+    {
+        InstanceStream& stream = batch.streams[m_currentFrame];
+        std::vector<unsigned>& dirty = batch.dirty[m_currentFrame];
+        const auto count = static_cast<unsigned>(batch.instances.size());
+
+        // Grow the copy of the batch when instances were added, which writes all of them again
+        unsigned first_added = stream.count;
+        if (stream.capacity < count)
+        {
+            stream.count = 0;
+            resizeInstances(stream, std::max(count, std::min(stream.capacity * 2, s_maxInstances)));
+            first_added = 0;
+        }
+
+        const auto write = [&](const unsigned instance)
+        {
+            // Hidden instances are written as a quad of no size, which covers no pixel
+            const RetainedInstanceData& data = batch.instances[instance];
+            if (data.isVisible)
+                writeInstance(stream.memory + stream.stride * instance, data.transform, data.color, data.radius, data.texture, false);
+            else
+                writeInstance(stream.memory + stream.stride * instance, glm::mat3x2(0.f), data.color, 0.f, nullptr, false);
+            ++m_statistics.staticUpdates;
+        };
+
+        // The instances added since the frame last drew the batch were never written in its copy
+        for (const unsigned instance : dirty)
+            if (instance < first_added)
+                write(instance);
+        for (unsigned instance = first_added; instance < count; ++instance)
+            write(instance);
+
+        dirty.clear();
+        stream.count = count;
+        return stream;
+    }
+
+    template <typename Backend>
+    void Renderer2D<Backend>::cullStatics(FrameResources& frame, const InstanceStream& statics)
+    {
+        const auto& culling_pipeline = dynamic_cast<const compute_pipeline_type&>(m_device->state().pipeline("Culling"));
+        const auto& culling_layout = *culling_pipeline.layout();
+        StaticCulling& culling = frame.culling;
+
+        // The arguments of the indirect draw are written by the CPU each frame, then the culling counts the visible instances in them
+        if (!culling.arguments)
+            culling.arguments = m_device->factory().createBuffer(render::BufferType::Indirect, render::BufferUsage::Dynamic, sizeof(DrawArguments), 1, true);
+        const DrawArguments arguments {.indexCount = static_cast<std::uint32_t>(s_rectangleIndices.size())};
+        culling.arguments->map(&arguments, sizeof(DrawArguments), 0);
+        if (statics.count == 0)
+            return;
+
+        // Bind the copy of the static batch of the frame again when it was grown, and grow the visible instances and the group counts with it
+        const auto thread_groups = culling_pipeline.threadGroupSize();
+        if (culling.source != statics.buffer.get())
+        {
+            culling.input.reset();
+            culling.input = culling_layout.descriptorSet(0).allocate(statics.capacity, {{0, *statics.buffer}});
+            culling.source = statics.buffer.get();
+        }
+        if (culling.capacity < statics.capacity)
+        {
+            const auto& instance_binding_layout = m_device->state().pipeline("Geometry").layout()->descriptorSet(0);
+            const std::size_t instance_size = m_instanceFormat == InstanceFormat::Compact ? sizeof(CompactInstanceBuffer) : sizeof(InstanceBuffer);
+            const auto& factory = dynamic_cast<const render::IGraphicsFactory&>(m_device->factory());
+
+            // Release the previous bindings before allocating the new ones, since bindings of unbounded arrays are not cached
+            culling.visibleBinding.reset();
+            culling.output.reset();
+            culling.argumentsBinding.reset();
+            culling.visible = lib::dynamic_unique_pointer_cast<buffer_type>(factory.createBuffer(instance_binding_layout,
+                                                                                                 0,
+                                                                                                 render::BufferUsage::Resource,
+                                                                                                 instance_size,
+                                                                                                 statics.capacity,
+                                                                                                 true));
+            culling.groupCounts = lib::dynamic_unique_pointer_cast<buffer_type>(factory.createBuffer(culling_layout.descriptorSet(2),
+                                                                                                     1,
+                                                                                                     render::BufferUsage::Resource,
+                                                                                                     sizeof(std::uint32_t) * ((statics.capacity + thread_groups.x - 1) / thread_groups.x),
+                                                                                                     1,
+                                                                                                     true));
+            culling.visibleBinding = instance_binding_layout.allocate(statics.capacity, {{0, *culling.visible}});
+            culling.output = culling_layout.descriptorSet(1).allocate(statics.capacity, {{0, *culling.visible}});
+            culling.argumentsBinding = culling_layout.descriptorSet(2).allocate({{0, *culling.arguments}, {1, *culling.groupCounts}});
+            culling.capacity = statics.capacity;
+        }
+
+        // Dispatches cannot be recorded in a render pass, the culling is submitted on its own before the geometry which waits for its results
+        const math::Vector3<unsigned> groups = {(statics.count + thread_groups.x - 1) / thread_groups.x, 1, 1};
+        CullingData culling_data {.visibleArea = m_visibleArea, .instances = statics.count, .pass = s_countPass};
+        auto command_buffer = m_device->graphicsQueue().createCommandBuffer(true, false);
+        const render::ICommandBuffer& commands = *command_buffer;
+        commands.beginProfileScope("Culling");
+        commands.use(culling_pipeline);
+        commands.bind(*culling.input);
+        commands.bind(*culling.output);
+        commands.bind(*culling.argumentsBinding);
+        commands.pushConstants(*culling_layout.pushConstants(), &culling_data);
+        commands.dispatch(groups);
+
+        // The compaction reads the counts of all the groups, which must all be written first
+        commands.dispatchBarrier();
+        culling_data.pass = s_compactPass;
+        commands.pushConstants(*culling_layout.pushConstants(), &culling_data);
+        commands.dispatch(groups);
+        commands.endProfileScope();
+        commands.dispatchBarrier();
+        m_device->graphicsQueue().submit(command_buffer);
+    }
+
+    template <typename Backend>
+    typename Renderer2D<Backend>::RetainedBatch& Renderer2D<Backend>::retainedBatch(const InstanceBatch batch)
     {
-        m_instanceData.emplace_back(InstanceBuffer {
-                                        .transform = transform_matrix,
-                                        .color = glm::vec4(color.x, color.y, color.z, color.w),
-                                        .radius = radius
-                                    });
+        if (batch >= m_batches.size() || !m_batches[batch])
+            throw base::ArgumentOutOfRangeException(std::format("The instance batch {} does not exist.", batch));
+        return *m_batches[batch];
     }
 }
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace spark::core
+{
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    View<T, Others...> Scene::view() const
+    {
+        return View<T, Others...>(*static_cast<const details::AbstractGameObject<GameObject>*>(m_root)->m_storage);
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace spark::core::details
+{
+    template <typename Fn>
+    void TraversalOrder::forEach(Fn&& fn)
+    {
+        update();
+
+        // The root is the first object of the list and is not visited
+        for (std::size_t i = 1; i < m_objects.size(); ++i)
+        {
+            m_visiting = true;
+            m_visitedIndex = i;
+            try
+            {
+                fn(m_objects[i]);
+            } catch (...)
+            {
+                m_visiting = false;
+                throw;
+            }
+
+            // The removed objects may have been destroyed, so the iteration continues after the last visited object still in the tree
+            update();
+            i = m_visitedIndex;
+            m_visiting = false;
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+
+namespace spark::core
+{
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    View<T, Others...>::Iterator::Iterator(const std::vector<Component*>* components, const std::size_t index)
+        : m_components(components), m_index(index)
+    {
+        settle();
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    typename View<T, Others...>::Iterator::value_type View<T, Others...>::Iterator::operator*() const
+    {
+        return std::apply([](auto*... components) { return value_type(*components...); }, m_current);
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    typename View<T, Others...>::Iterator& View<T, Others...>::Iterator::operator++()
+    {
+        ++m_index;
+        settle();
+        return *this;
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    typename View<T, Others...>::Iterator View<T, Others...>::Iterator::operator++(int)
+    {
+        Iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    void View<T, Others...>::Iterator::settle()
+    {
+        for (; m_index < m_components->size(); ++m_index)
+        {
+            auto* component = static_cast<T*>((*m_components)[m_index]);
+            const GameObject* object = component->gameObject();
+            m_current = {component, object->template component<Others>()...};
+
+            // Only stop on objects having all the other components
+            if (std::apply([](const auto*... components) { return ((components != nullptr) && ...); }, m_current))
+                return;
+        }
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    View<T, Others...>::View(const details::ComponentStorage& storage)
+    {
+        if (const auto* pool = storage.find(T::classRtti()))
+            m_components = &pool->components();
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    typename View<T, Others...>::Iterator View<T, Others...>::begin() const
+    {
+        return Iterator(m_components, 0);
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    typename View<T, Others...>::Iterator View<T, Others...>::end() const
+    {
+        return Iterator(m_components, m_components->size());
+    }
+
+    template <typename T, typename... Others> requires std::is_base_of_v<Component, T> && (std::is_base_of_v<Component, Others> && ...)
+    template <typename Fn>
+    void View<T, Others...>::each(Fn&& fn) const
+    {
+        for (auto it = begin(); it != end(); ++it)
+            std::apply(fn, *it);
+    }
+}
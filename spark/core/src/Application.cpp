@@ -9,6 +9,7 @@
 #include "spark/events/WindowEvents.h"
 #include "spark/lib/Clock.h"
 #include "spark/log/Logger.h"
+#include "spark/render/GpuProfiler.h"
 
 #include "imgui.h"
 
@@ -44,6 +45,49 @@ namespace
         ImGui::PlotLines("##FPS", fps_values.data(), static_cast<int>(fps_values.size()), 0, nullptr, 0.0f, 3000.f, ImVec2(0, 80));
         ImGui::End();
     }
+
+    /**
+     * \brief Draws the GPU time and pipeline statistics of each render pass using ImGui
+     * \param profiler The profiler of the device drawing the frames
+     */
+    void draw_gpu_profile(const spark::render::IGpuProfiler& profiler)
+    {
+        ImGui::Begin("GPU Profile");
+        if (!profiler.isEnabled())
+        {
+            ImGui::Text("The device does not support GPU timestamps.");
+            ImGui::End();
+            return;
+        }
+
+        ImGui::Text("Profiled frames: %zu, skipped frames: %zu", profiler.resolvedFrames(), profiler.skippedFrames());
+        if (ImGui::BeginTable("##Passes", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Pass");
+            ImGui::TableSetupColumn("GPU (ms)");
+            ImGui::TableSetupColumn("Primitives");
+            ImGui::TableSetupColumn("Vertices");
+            ImGui::TableSetupColumn("Fragments");
+            ImGui::TableHeadersRow();
+
+            for (const spark::render::GpuProfileScope& scope : profiler.results())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(scope.name.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.milliseconds);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(scope.statistics.inputPrimitives));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(scope.statistics.vertexShaderInvocations));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(scope.statistics.fragmentShaderInvocations));
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
 }
 
 namespace spark::core
@@ -56,16 +100,20 @@ namespace spark::core
     }
 
     Application::Application(const Settings& settings)
+        : m_jobSystem(std::make_unique<jobs::JobSystem>())
     {
         const Window::Settings window_settings =
         {
             .title = settings.name,
             .size = settings.size,
             .eventCallback = [this](events::Event& event) { onEvent(event); },
-            .resizable = settings.resizable
+            .resizable = settings.resizable,
+            .framesInFlight = settings.framesInFlight,
+            .instanceFormat = settings.instanceFormat
         };
 
         m_window = std::make_unique<Window>(window_settings);
+        m_window->renderer().setJobSystem(m_jobSystem.get());
     }
 
     // ReSharper disable once CppMemberFunctionMayBeConst
@@ -92,7 +140,10 @@ namespace spark::core
 
             // Render
             if (should_draw_fps_graph)
+            {
                 draw_fps_graph(dt);
+                draw_gpu_profile(m_window->renderer().profiler());
+            }
             m_scene->onRender();
             m_window->renderer().render();
 
@@ -133,13 +184,22 @@ namespace spark::core
         return m_registries;
     }
 
+    // ReSharper disable once CppMemberFunctionMayBeConst
+    jobs::JobSystem& Application::jobSystem()
+    {
+        return *m_jobSystem;
+    }
+
     void Application::setScene(std::shared_ptr<core::Scene> scene)
     {
         if (m_scene)
             m_scene->onUnload();
         m_scene = std::move(scene);
         if (m_scene)
+        {
+            m_scene->setJobSystem(m_jobSystem.get());
             m_scene->onLoad();
+        }
     }
 
     void Application::onEvent(events::Event& event)
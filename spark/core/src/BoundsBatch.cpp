@@ -0,0 +1,188 @@
+#include "spark/core/details/BoundsBatch.h"
+
+#include "spark/base/Exception.h"
+#include "spark/base/Platforms.h"
+
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#   define SPARK_BOUNDS_BATCH_X86 1
+#   if defined(SPARK_COMPILER_MSVC)
+#       include <intrin.h>
+#   endif
+#   include <immintrin.h>
+#endif
+
+// MSVC allows AVX intrinsics in any function, GCC and Clang need the target to be enabled on the function using them
+#if defined(SPARK_COMPILER_MSVC)
+#   define SPARK_TARGET_AVX
+#else
+#   define SPARK_TARGET_AVX __attribute__((target("avx")))
+#endif
+
+namespace
+{
+    using spark::core::details::SimdLevel;
+
+    SimdLevel detect_simd_level()
+    {
+#if defined(SPARK_BOUNDS_BATCH_X86)
+#   if defined(SPARK_COMPILER_MSVC)
+        int info[4];
+        __cpuid(info, 1);
+
+        // AVX must be supported by the CPU, and its registers saved by the OS
+        const bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+#   else
+        __builtin_cpu_init();
+        const bool avx = __builtin_cpu_supports("avx");
+#   endif
+        return avx ? SimdLevel::Avx : SimdLevel::Sse;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    /**
+     * \brief Appends to \p result the offset of each bit set in \p mask, added to \p index.
+     */
+    void append_hits(unsigned mask, const std::size_t index, std::vector<std::uint32_t>& result)
+    {
+        while (mask != 0)
+        {
+            result.push_back(static_cast<std::uint32_t>(index + std::countr_zero(mask)));
+            mask &= mask - 1;
+        }
+    }
+
+    /**
+     * \brief Tests the bounds of [\p begin, \p end) one at a time.
+     * \return The index past the last bounds tested.
+     */
+    std::size_t overlaps_scalar(const spark::math::Vector4<float>& bounds,
+                                const float* x,
+                                const float* y,
+                                const float* z,
+                                const float* w,
+                                std::size_t begin,
+                                const std::size_t end,
+                                std::vector<std::uint32_t>& result)
+    {
+        for (; begin < end; ++begin)
+            if (bounds.x <= z[begin] && bounds.z >= x[begin] && bounds.y <= w[begin] && bounds.w >= y[begin])
+                result.push_back(static_cast<std::uint32_t>(begin));
+        return begin;
+    }
+
+#if defined(SPARK_BOUNDS_BATCH_X86)
+    /**
+     * \brief Tests the bounds of [\p begin, \p end) 4 at a time, stopping before the last incomplete group.
+     * \return The index past the last bounds tested.
+     */
+    std::size_t overlaps_sse(const spark::math::Vector4<float>& bounds,
+                             const float* x,
+                             const float* y,
+                             const float* z,
+                             const float* w,
+                             std::size_t begin,
+                             const std::size_t end,
+                             std::vector<std::uint32_t>& result)
+    {
+        const __m128 min_x = _mm_set1_ps(bounds.x), min_y = _mm_set1_ps(bounds.y);
+        const __m128 max_x = _mm_set1_ps(bounds.z), max_y = _mm_set1_ps(bounds.w);
+        for (; begin + 4 <= end; begin += 4)
+        {
+            const __m128 overlap_x = _mm_and_ps(_mm_cmple_ps(min_x, _mm_loadu_ps(z + begin)), _mm_cmpge_ps(max_x, _mm_loadu_ps(x + begin)));
+            const __m128 overlap_y = _mm_and_ps(_mm_cmple_ps(min_y, _mm_loadu_ps(w + begin)), _mm_cmpge_ps(max_y, _mm_loadu_ps(y + begin)));
+            append_hits(static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y))), begin, result);
+        }
+        return begin;
+    }
+
+    /**
+     * \brief Tests the bounds of [\p begin, \p end) 8 at a time, stopping before the last incomplete group.
+     * \return The index past the last bounds tested.
+     */
+    SPARK_TARGET_AVX std::size_t overlaps_avx(const spark::math::Vector4<float>& bounds,
+                                              const float* x,
+                                              const float* y,
+                                              const float* z,
+                                              const float* w,
+                                              std::size_t begin,
+                                              const std::size_t end,
+                                              std::vector<std::uint32_t>& result)
+    {
+        const __m256 min_x = _mm256_set1_ps(bounds.x), min_y = _mm256_set1_ps(bounds.y);
+        const __m256 max_x = _mm256_set1_ps(bounds.z), max_y = _mm256_set1_ps(bounds.w);
+        for (; begin + 8 <= end; begin += 8)
+        {
+            // Ordered comparisons, to return false with NaN like the scalar version
+            const __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(min_x, _mm256_loadu_ps(z + begin), _CMP_LE_OQ),
+                                                   _mm256_cmp_ps(max_x, _mm256_loadu_ps(x + begin), _CMP_GE_OQ));
+            const __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(min_y, _mm256_loadu_ps(w + begin), _CMP_LE_OQ),
+                                                   _mm256_cmp_ps(max_y, _mm256_loadu_ps(y + begin), _CMP_GE_OQ));
+            append_hits(static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y))), begin, result);
+        }
+        return begin;
+    }
+#endif
+}
+
+namespace spark::core::details
+{
+    SimdLevel BoundsBatch::SupportedSimdLevel()
+    {
+        static const SimdLevel level = detect_simd_level();
+        return level;
+    }
+
+    void BoundsBatch::clear()
+    {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        m_w.clear();
+    }
+
+    void BoundsBatch::reserve(const std::size_t count)
+    {
+        m_x.reserve(count);
+        m_y.reserve(count);
+        m_z.reserve(count);
+        m_w.reserve(count);
+    }
+
+    void BoundsBatch::push(const math::Vector4<float>& bounds)
+    {
+        m_x.push_back(bounds.x);
+        m_y.push_back(bounds.y);
+        m_z.push_back(bounds.z);
+        m_w.push_back(bounds.w);
+    }
+
+    std::size_t BoundsBatch::size() const
+    {
+        return m_x.size();
+    }
+
+    void BoundsBatch::overlaps(const math::Vector4<float>& bounds,
+                               std::size_t begin,
+                               const std::size_t end,
+                               std::vector<std::uint32_t>& result,
+                               const SimdLevel level) const
+    {
+        if (begin > end || end > size())
+            throw base::BadArgumentException("Unable to test bounds outside of the batch.");
+        if (level > SupportedSimdLevel())
+            throw base::BadArgumentException("Unable to test bounds with an instruction set not supported by the CPU.");
+
+        const float *x = m_x.data(), *y = m_y.data(), *z = m_z.data(), *w = m_w.data();
+#if defined(SPARK_BOUNDS_BATCH_X86)
+        if (level == SimdLevel::Avx)
+            begin = overlaps_avx(bounds, x, y, z, w, begin, end, result);
+        if (level >= SimdLevel::Sse)
+            begin = overlaps_sse(bounds, x, y, z, w, begin, end, result);
+#endif
+        overlaps_scalar(bounds, x, y, z, w, begin, end, result);
+    }
+}
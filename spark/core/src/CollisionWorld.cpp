@@ -0,0 +1,263 @@
+#include "spark/core/CollisionWorld.h"
+#include "spark/core/components/Collider.h"
+
+#include "spark/base/Exception.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /**
+     * \brief Packs the coordinates of a grid cell into a single sortable key.
+     */
+    std::uint64_t cell_key(const std::int32_t x, const std::int32_t y)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 | static_cast<std::uint32_t>(y);
+    }
+
+    /**
+     * \brief Gets the coordinate of the grid cell containing a finite value, clamped to the range of the cell keys.
+     */
+    std::int32_t cell_coordinate(const float value, const float cell_size)
+    {
+        const double cell = std::floor(static_cast<double>(value) / cell_size);
+        return static_cast<std::int32_t>(std::clamp(cell, static_cast<double>(std::numeric_limits<std::int32_t>::min()),
+                                                    static_cast<double>(std::numeric_limits<std::int32_t>::max())));
+    }
+
+    /**
+     * \brief Checks that all the coordinates of a box are finite. The other boxes never collide.
+     */
+    bool is_finite(const spark::math::Vector4<float>& box)
+    {
+        return std::isfinite(box.x) && std::isfinite(box.y) && std::isfinite(box.z) && std::isfinite(box.w);
+    }
+}
+
+namespace spark::core
+{
+    CollisionWorld::CollisionWorld(const Broadphase broadphase, const float cell_size)
+        : m_broadphase(broadphase), m_cellSize(1.f)
+    {
+        setCellSize(cell_size);
+    }
+
+    CollisionWorld::~CollisionWorld()
+    {
+        for (components::Collider* collider : m_colliders)
+            if (collider)
+                collider->m_collisionWorld = nullptr;
+    }
+
+    Broadphase CollisionWorld::broadphase() const
+    {
+        return m_broadphase;
+    }
+
+    void CollisionWorld::setBroadphase(const Broadphase broadphase)
+    {
+        m_broadphase = broadphase;
+    }
+
+    float CollisionWorld::cellSize() const
+    {
+        return m_cellSize;
+    }
+
+    void CollisionWorld::setCellSize(const float cell_size)
+    {
+        if (!(cell_size > 0.f))
+            throw base::BadArgumentException("The cell size of a collision world must be greater than zero.");
+        m_cellSize = cell_size;
+    }
+
+    void CollisionWorld::add(components::Collider* collider)
+    {
+        if (collider->m_collisionWorld)
+            throw base::BadArgumentException("Unable to register a collider already registered in a collision world.");
+
+        collider->m_collisionWorld = this;
+        collider->m_collisionIndex = static_cast<std::uint32_t>(m_colliders.size());
+        m_colliders.push_back(collider);
+        m_dynamic.push_back(&collider->rttiInstance() == &components::DynamicCollider::classRtti());
+    }
+
+    void CollisionWorld::remove(components::Collider* collider)
+    {
+        if (collider->m_collisionWorld != this)
+            throw base::BadArgumentException("Unable to unregister a collider from a collision world it is not registered in.");
+
+        // The slot is only released on the next update, so that indices stay valid while collisions are emitted
+        m_colliders[collider->m_collisionIndex] = nullptr;
+        collider->m_collisionWorld = nullptr;
+        ++m_removedCount;
+    }
+
+    std::size_t CollisionWorld::colliderCount() const
+    {
+        return m_colliders.size() - m_removedCount;
+    }
+
+    void CollisionWorld::update()
+    {
+        compact();
+
+        // Cache the bounds once, and their normalized box for the broadphase (a transform can flip the bounds)
+        const std::size_t count = m_colliders.size();
+        m_bounds.resize(count);
+        m_boxes.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const math::Vector4<float> bounds = m_colliders[i]->bounds();
+            m_bounds[i] = bounds;
+            m_boxes[i] = {std::min(bounds.x, bounds.z), std::min(bounds.y, bounds.w), std::max(bounds.x, bounds.z), std::max(bounds.y, bounds.w)};
+        }
+
+        m_contacts.clear();
+        switch (m_broadphase)
+        {
+        case Broadphase::SweepAndPrune:
+            sweepAndPrune();
+            break;
+        case Broadphase::UniformGrid:
+            uniformGrid();
+            break;
+        }
+
+        // Sort the contacts so that the signals are emitted in the same order whatever the broadphase
+        std::ranges::sort(m_contacts, [](const Contact& lhs, const Contact& rhs)
+        {
+            return lhs.source != rhs.source ? lhs.source < rhs.source : lhs.target < rhs.target;
+        });
+
+        // Colliders may be unregistered by a collision callback, and are skipped from this point
+        for (const Contact& contact : m_contacts)
+        {
+            auto* source = static_cast<components::DynamicCollider*>(m_colliders[contact.source]);
+            const components::Collider* target = m_colliders[contact.target];
+            if (source && target)
+                source->onCollision.emit(*target);
+        }
+    }
+
+    void CollisionWorld::compact()
+    {
+        if (m_removedCount == 0)
+            return;
+
+        std::size_t next = 0;
+        for (std::size_t i = 0; i < m_colliders.size(); ++i)
+        {
+            if (!m_colliders[i])
+                continue;
+
+            m_colliders[next] = m_colliders[i];
+            m_dynamic[next] = m_dynamic[i];
+            m_colliders[next]->m_collisionIndex = static_cast<std::uint32_t>(next);
+            ++next;
+        }
+        m_colliders.resize(next);
+        m_dynamic.resize(next);
+        m_removedCount = 0;
+    }
+
+    void CollisionWorld::sweepAndPrune()
+    {
+        m_order.clear();
+        for (std::uint32_t i = 0; i < m_boxes.size(); ++i)
+            if (is_finite(m_boxes[i]))
+                m_order.push_back(i);
+        std::ranges::sort(m_order, [this](const std::uint32_t lhs, const std::uint32_t rhs)
+        {
+            return m_boxes[lhs].x != m_boxes[rhs].x ? m_boxes[lhs].x < m_boxes[rhs].x : lhs < rhs;
+        });
+
+        m_batch.clear();
+        m_sortedMinX.clear();
+        for (const std::uint32_t index : m_order)
+        {
+            m_batch.push(m_bounds[index]);
+            m_sortedMinX.push_back(m_boxes[index].x);
+        }
+
+        // Only the colliders starting before the end of the current one on the X axis can overlap it
+        for (std::size_t i = 0; i < m_order.size(); ++i)
+        {
+            const std::uint32_t current = m_order[i];
+            const float end = m_boxes[current].z;
+
+            std::size_t last = i + 1;
+            while (last < m_sortedMinX.size() && m_sortedMinX[last] <= end)
+                ++last;
+
+            m_hits.clear();
+            m_batch.overlaps(m_bounds[current], i + 1, last, m_hits);
+            for (const std::uint32_t hit : m_hits)
+                addContacts(current, m_order[hit]);
+        }
+    }
+
+    void CollisionWorld::uniformGrid()
+    {
+        m_gridEntries.clear();
+        for (std::uint32_t i = 0; i < m_boxes.size(); ++i)
+        {
+            const math::Vector4<float>& box = m_boxes[i];
+            if (!is_finite(box))
+                continue;
+
+            // The coordinates are iterated on 64 bits, so that a box reaching the last cell does not overflow
+            const std::int64_t min_x = cell_coordinate(box.x, m_cellSize), min_y = cell_coordinate(box.y, m_cellSize);
+            const std::int64_t max_x = cell_coordinate(box.z, m_cellSize), max_y = cell_coordinate(box.w, m_cellSize);
+            for (std::int64_t x = min_x; x <= max_x; ++x)
+                for (std::int64_t y = min_y; y <= max_y; ++y)
+                    m_gridEntries.push_back({.cell = cell_key(static_cast<std::int32_t>(x), static_cast<std::int32_t>(y)), .collider = i});
+        }
+
+        // Group the entries by cell, then test every pair of colliders sharing a cell
+        std::ranges::sort(m_gridEntries, [](const GridEntry& lhs, const GridEntry& rhs)
+        {
+            return lhs.cell != rhs.cell ? lhs.cell < rhs.cell : lhs.collider < rhs.collider;
+        });
+
+        m_batch.clear();
+        for (const GridEntry& entry : m_gridEntries)
+            m_batch.push(m_bounds[entry.collider]);
+
+        for (std::size_t begin = 0; begin < m_gridEntries.size();)
+        {
+            const std::uint64_t cell = m_gridEntries[begin].cell;
+            std::size_t end = begin + 1;
+            while (end < m_gridEntries.size() && m_gridEntries[end].cell == cell)
+                ++end;
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const std::uint32_t current = m_gridEntries[i].collider;
+                m_hits.clear();
+                m_batch.overlaps(m_bounds[current], i + 1, end, m_hits);
+                for (const std::uint32_t hit : m_hits)
+                {
+                    const std::uint32_t other = m_gridEntries[hit].collider;
+
+                    // Colliders sharing several cells are only reported in the cell containing the top-left corner of their intersection
+                    const std::int32_t corner_x = cell_coordinate(std::max(m_boxes[current].x, m_boxes[other].x), m_cellSize);
+                    const std::int32_t corner_y = cell_coordinate(std::max(m_boxes[current].y, m_boxes[other].y), m_cellSize);
+                    if (cell_key(corner_x, corner_y) == cell)
+                        addContacts(current, other);
+                }
+            }
+            begin = end;
+        }
+    }
+
+    void CollisionWorld::addContacts(const std::uint32_t lhs, const std::uint32_t rhs)
+    {
+        if (m_dynamic[lhs])
+            m_contacts.push_back({.source = lhs, .target = rhs});
+        if (m_dynamic[rhs])
+            m_contacts.push_back({.source = rhs, .target = lhs});
+    }
+}
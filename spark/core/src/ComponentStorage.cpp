@@ -0,0 +1,98 @@
+#include "spark/core/Component.h"
+#include "spark/core/details/ComponentStorage.h"
+
+#include "spark/base/Exception.h"
+
+#include <algorithm>
+
+namespace spark::core::details
+{
+    ComponentPool::~ComponentPool()
+    {
+        SPARK_CORE_ASSERT(m_components.empty())
+
+        for (std::byte* page : m_pages)
+            ::operator delete(page, std::align_val_t(m_elementAlignment));
+    }
+
+    void ComponentPool::destroy(Component* component)
+    {
+        // Get the address of the most derived object, which is the one returned by allocate()
+        void* slot = dynamic_cast<void*>(component);
+        component->~Component();
+        deallocate(slot);
+    }
+
+    void ComponentPool::insert(Component* component)
+    {
+        component->m_poolIndex = m_components.size();
+        m_components.push_back(component);
+    }
+
+    void ComponentPool::erase(Component* component)
+    {
+        const std::size_t index = component->m_poolIndex;
+        if (index >= m_components.size() || m_components[index] != component)
+            throw base::BadArgumentException("Unable to erase a component which is not in the pool!");
+
+        // Move the last component in the freed place to keep the array dense
+        Component* last = m_components.back();
+        m_components[index] = last;
+        last->m_poolIndex = index;
+        m_components.pop_back();
+    }
+
+    const std::vector<Component*>& ComponentPool::components() const
+    {
+        return m_components;
+    }
+
+    void* ComponentPool::allocate(const std::size_t size, const std::size_t alignment)
+    {
+        // The first allocation defines the layout of the pages
+        if (m_elementSize == 0)
+        {
+            m_elementSize = size;
+            m_elementAlignment = alignment;
+            m_pageCapacity = std::max<std::size_t>(1, s_pageSize / size);
+        }
+
+        if (size != m_elementSize || alignment != m_elementAlignment)
+            throw base::BadArgumentException("All the components of a pool must have the same type! Did you forget to declare the RTTI of a component?");
+
+        if (!m_freeSlots.empty())
+        {
+            void* slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return slot;
+        }
+
+        if (m_pages.empty() || m_usedInLastPage == m_pageCapacity)
+        {
+            m_pages.push_back(static_cast<std::byte*>(::operator new(m_pageCapacity * m_elementSize, std::align_val_t(m_elementAlignment))));
+            m_usedInLastPage = 0;
+        }
+        return m_pages.back() + m_usedInLastPage++ * m_elementSize;
+    }
+
+    void ComponentPool::deallocate(void* ptr)
+    {
+        m_freeSlots.push_back(ptr);
+    }
+
+    ComponentPool& ComponentStorage::pool(const rtti::RttiBase& type)
+    {
+        auto& pool = m_pools[&type];
+        if (!pool)
+            pool = std::make_unique<ComponentPool>();
+        return *pool;
+    }
+
+    const ComponentPool* ComponentStorage::find(const rtti::RttiBase& type) const
+    {
+        const auto it = m_pools.find(&type);
+        if (it == m_pools.cend())
+            return nullptr;
+        return it->second.get();
+    }
+}
@@ -0,0 +1,211 @@
+#include "spark/core/Font.h"
+
+#include "spark/base/Exception.h"
+
+// The implementation of stb_truetype shipped with ImGui is internal to ImGui, keep our own copy private to this file
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imstb_truetype.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    /**
+     * \brief Decodes the next code point of an UTF-8 string.
+     * \param text The UTF-8 string.
+     * \param index The index of the first byte of the code point, moved to the first byte of the next one.
+     * \return The decoded code point, or U+FFFD if the sequence is invalid.
+     */
+    char32_t next_code_point(const std::string_view text, std::size_t& index)
+    {
+        const auto lead = static_cast<unsigned char>(text[index++]);
+        if (lead < 0x80)
+            return lead;
+
+        const std::size_t length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+        if (length == 0 || index + length > text.size())
+            return U'\uFFFD';
+
+        char32_t code_point = lead & (0x3F >> length);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            const auto continuation = static_cast<unsigned char>(text[index++]);
+            if ((continuation & 0xC0) != 0x80)
+                return U'\uFFFD';
+            code_point = code_point << 6 | (continuation & 0x3F);
+        }
+        return code_point;
+    }
+}
+
+namespace spark::core
+{
+    struct Font::Impl
+    {
+        friend Font;
+
+    public:
+        /**
+         * \brief The metrics of a glyph, in units of the font size.
+         */
+        struct Glyph
+        {
+            const AtlasRegion* texture = nullptr;
+            math::Vector2<float> offset;
+            math::Vector2<float> size;
+            float advance = 0.f;
+        };
+
+        explicit Impl(const std::filesystem::path& path)
+        {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            if (!file.is_open())
+                throw base::CouldNotOpenFileException(std::format("Failed to open font file: {}", path.generic_string()));
+            m_data.assign(std::istreambuf_iterator(file), std::istreambuf_iterator<char>());
+
+            const auto* data = reinterpret_cast<const unsigned char*>(m_data.data());
+            const int offset = stbtt_GetFontOffsetForIndex(data, 0);
+            if (offset < 0 || !stbtt_InitFont(&m_info, data, offset))
+                throw base::BadArgumentException(std::format("The file {} is not a valid font.", path.generic_string()));
+        }
+
+        void renderGlyphs(const std::string& name, TextureAtlas& atlas, const unsigned glyph_size, const unsigned spread)
+        {
+            const float em = static_cast<float>(glyph_size);
+            m_scale = stbtt_ScaleForPixelHeight(&m_info, em);
+
+            int ascent = 0, descent = 0, line_gap = 0;
+            stbtt_GetFontVMetrics(&m_info, &ascent, &descent, &line_gap);
+            m_ascent = static_cast<float>(ascent) * m_scale / em;
+            m_lineHeight = static_cast<float>(ascent - descent + line_gap) * m_scale / em;
+            m_em = em;
+
+            const auto render = [&](const char32_t code_point)
+            {
+                if (stbtt_FindGlyphIndex(&m_info, static_cast<int>(code_point)) == 0)
+                    return;
+
+                int advance = 0, left_side_bearing = 0;
+                stbtt_GetCodepointHMetrics(&m_info, static_cast<int>(code_point), &advance, &left_side_bearing);
+                Glyph& glyph = m_glyphs[code_point];
+                glyph.advance = static_cast<float>(advance) * m_scale / em;
+
+                // The distance is 0.5 on the outline and decreases by 0.5 over `spread` pixels outside of it
+                int width = 0, height = 0, x_offset = 0, y_offset = 0;
+                unsigned char* distances = stbtt_GetCodepointSDF(&m_info,
+                                                                 m_scale,
+                                                                 static_cast<int>(code_point),
+                                                                 static_cast<int>(spread),
+                                                                 128,
+                                                                 128.f / static_cast<float>(spread),
+                                                                 &width,
+                                                                 &height,
+                                                                 &x_offset,
+                                                                 &y_offset);
+                if (!distances)
+                    return;
+
+                // Store the distance in the alpha channel, so that the glyphs can be tinted like any other texture
+                std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4, 255);
+                for (std::size_t i = 0; i < static_cast<std::size_t>(width) * height; ++i)
+                    pixels[i * 4 + 3] = distances[i];
+                stbtt_FreeSDF(distances, nullptr);
+
+                const math::Vector2<unsigned> size = {static_cast<unsigned>(width), static_cast<unsigned>(height)};
+                glyph.texture = &atlas.add(std::format("{}#{}", name, static_cast<std::uint32_t>(code_point)), size, pixels);
+                glyph.offset = {static_cast<float>(x_offset) / em, static_cast<float>(y_offset) / em};
+                glyph.size = {static_cast<float>(width) / em, static_cast<float>(height) / em};
+            };
+
+            for (char32_t code_point = 0x20; code_point < 0x7F; ++code_point)
+                render(code_point);
+            for (char32_t code_point = 0xA0; code_point <= 0xFF; ++code_point)
+                render(code_point);
+        }
+
+        [[nodiscard]] const Glyph* glyph(const char32_t code_point) const
+        {
+            if (const auto it = m_glyphs.find(code_point); it != m_glyphs.end())
+                return &it->second;
+            if (const auto it = m_glyphs.find(U'?'); it != m_glyphs.end())
+                return &it->second;
+            return nullptr;
+        }
+
+        [[nodiscard]] float kerning(const char32_t previous, const char32_t current) const
+        {
+            return static_cast<float>(stbtt_GetCodepointKernAdvance(&m_info, static_cast<int>(previous), static_cast<int>(current))) * m_scale / m_em;
+        }
+
+    private:
+        std::string m_data;
+        stbtt_fontinfo m_info = {};
+        std::unordered_map<char32_t, Glyph> m_glyphs;
+        float m_scale = 1.f;
+        float m_em = 1.f;
+        float m_ascent = 0.f;
+        float m_lineHeight = 0.f;
+    };
+
+    Font::Font(const std::filesystem::path& path, TextureAtlas& atlas, const unsigned glyph_size, const unsigned spread)
+        : m_impl(std::make_unique<Impl>(path))
+    {
+        if (glyph_size == 0 || spread == 0)
+            throw base::BadArgumentException(std::format("The glyphs of a font need a size and a spread of at least one pixel, but {} and {} were given.", glyph_size, spread));
+        m_impl->renderGlyphs(path.generic_string(), atlas, glyph_size, spread);
+    }
+
+    Font::~Font() = default;
+
+    TextLayout Font::layout(const std::string_view text) const
+    {
+        TextLayout layout;
+        layout.glyphs.reserve(text.size());
+
+        float x = 0.f, width = 0.f, line_top = 0.f;
+        char32_t previous = 0;
+        for (std::size_t index = 0; index < text.size();)
+        {
+            const char32_t code_point = next_code_point(text, index);
+            if (code_point == U'\n')
+            {
+                width = std::max(width, x);
+                x = 0.f;
+                line_top += m_impl->m_lineHeight;
+                previous = 0;
+                continue;
+            }
+
+            const Impl::Glyph* glyph = m_impl->glyph(code_point);
+            if (!glyph)
+                continue;
+
+            if (previous != 0)
+                x += m_impl->kerning(previous, code_point);
+            if (glyph->texture)
+                layout.glyphs.push_back({
+                    .texture = glyph->texture,
+                    .position = {x + glyph->offset.x, line_top + m_impl->m_ascent + glyph->offset.y},
+                    .size = glyph->size
+                });
+
+            x += glyph->advance;
+            previous = code_point;
+        }
+
+        layout.size = {std::max(width, x), line_top + m_impl->m_lineHeight};
+        return layout;
+    }
+
+    float Font::lineHeight() const noexcept
+    {
+        return m_impl->m_lineHeight;
+    }
+}
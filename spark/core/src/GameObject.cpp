@@ -1,21 +1,28 @@
 #include "spark/core/GameObject.h"
 #include "spark/core/components/Transform.h"
 
-#include "spark/patterns/Traverser.h"
+#include "spark/patterns/DeferredCalls.h"
 
-#include <ranges>
+#include <algorithm>
 
 namespace spark::core
 {
     void GameObject::Destroy(GameObject* object, const bool immediate)
     {
+        // In the parallel update phase, the destruction is applied at the synchronization point, on the thread updating the scene
+        if (patterns::DeferredCalls* deferred_calls = patterns::DeferredCalls::Current())
+        {
+            deferred_calls->push([object, immediate] { Destroy(object, immediate); });
+            return;
+        }
+
         details::GameObjectDeleter<GameObject>()(object, immediate);
     }
 
     GameObject* GameObject::FindById(GameObject* root, const lib::Uuid& uuid)
     {
         GameObject* found = nullptr;
-        auto traverser = patterns::make_traverser<GameObject>([&uuid, &found](GameObject* obj)
+        for (GameObject* obj : static_cast<AbstractGameObject*>(root)->traversalOrder().descendants(root))
         {
             if (obj->uuid() == uuid)
             {
@@ -23,15 +30,14 @@ namespace spark::core
                     throw base::UnknownException("Found multiple GameObjects with the same UUID!");
                 found = obj;
             }
-        });
-        patterns::traverse_tree(root, traverser);
+        }
         return found;
     }
 
     GameObject* GameObject::FindByName(GameObject* root, const std::string& name)
     {
         GameObject* found = nullptr;
-        auto traverser = patterns::make_traverser<GameObject>([&name, &found](GameObject* obj)
+        for (GameObject* obj : static_cast<AbstractGameObject*>(root)->traversalOrder().descendants(root))
         {
             if (obj->name() == name)
             {
@@ -39,8 +45,7 @@ namespace spark::core
                     throw base::UnknownException("Found multiple GameObjects with the same name!");
                 found = obj;
             }
-        });
-        patterns::traverse_tree(root, traverser);
+        }
         return found;
     }
 
@@ -48,6 +53,7 @@ namespace spark::core
         : AbstractGameObject(parent), m_name(std::move(name))
     {
         addComponent<components::Transform>();
+        m_transform = component<components::Transform>();
     }
 
     const lib::Uuid& GameObject::uuid() const
@@ -62,33 +68,83 @@ namespace spark::core
 
     components::Transform* GameObject::transform() const
     {
-        return component<components::Transform>();
+        return m_transform;
     }
 
-    void GameObject::addComponent(Component* component, bool managed)
+    Scene* GameObject::scene() const
     {
-        if (m_components.contains(&component->rttiInstance()))
-            throw base::BadArgumentException("Unable to add the same component twice!");
+        return static_cast<const AbstractGameObject*>(root())->m_scene;
+    }
 
-        m_components.insert({&component->rttiInstance(), {component, managed}});
-        if (m_initialized)
-            component->onAttach();
+    void GameObject::addComponent(Component* component, const bool managed)
+    {
+        attachComponent(component, m_storage->pool(component->rttiInstance()), managed, false);
     }
 
     void GameObject::removeComponent(Component* component)
     {
-        if (!m_components.contains(&component->rttiInstance()))
+        SPARK_CORE_ASSERT(patterns::DeferredCalls::Current() == nullptr && "Components cannot be removed in the parallel update phase")
+
+        const auto it = std::ranges::find_if(m_components, [component](const details::ComponentEntry& entry)
+        {
+            return entry.component == component && !entry.removed;
+        });
+        if (it == m_components.end())
             throw base::BadArgumentException("Unable to remove a non-existing component!");
 
-        m_components.erase(&component->rttiInstance());
+        // The entry is kept until the end of the frame, since the components of this GameObject may be iterated over
+        it->removed = true;
+        it->pool->erase(component);
+        if (component == m_transform)
+            m_transform = nullptr;
+        if (!m_hasRemovedComponents)
+        {
+            m_hasRemovedComponents = true;
+            s_objectsWithRemovedComponents.push_back(this);
+        }
+
         component->onDetach();
     }
 
     std::vector<Component*> GameObject::components() const
     {
         std::vector<Component*> components;
-        for (const auto& component : m_components | std::views::values | std::views::keys)
-            components.push_back(component);
+        components.reserve(m_components.size());
+        for (const auto& entry : m_components)
+            if (!entry.removed)
+                components.push_back(entry.component);
         return components;
     }
+
+    void GameObject::onParentChanged(GameObject* old_parent)
+    {
+        AbstractGameObject::onParentChanged(old_parent);
+        if (m_transform)
+            m_transform->invalidate();
+    }
+
+    void GameObject::attachComponent(Component* component, details::ComponentPool& pool, const bool managed, const bool pooled)
+    {
+        SPARK_CORE_ASSERT(patterns::DeferredCalls::Current() == nullptr && "GameObjects and components cannot be created in the parallel update phase")
+
+        const rtti::RttiBase* type = &component->rttiInstance();
+        if (std::ranges::any_of(m_components, [type](const details::ComponentEntry& entry) { return entry.type == type && !entry.removed; }))
+        {
+            if (pooled)
+                pool.destroy(component);
+            throw base::BadArgumentException("Unable to add the same component twice!");
+        }
+
+        pool.insert(component);
+        m_components.push_back({
+            .type = type,
+            .component = component,
+            .pool = &pool,
+            .allocator = pooled ? &pool : nullptr,
+            .managed = managed,
+            .threadSafeUpdate = component->hasThreadSafeUpdate()
+        });
+        if (m_initialized)
+            component->onAttach();
+    }
 }
@@ -19,6 +19,7 @@ namespace spark::core
         registerType<core::components::Image>();
         registerType<core::components::Rectangle>();
         registerType<core::components::Text>();
+        registerType<core::components::Tilemap>();
         registerType<core::components::Transform>();
     }
 }
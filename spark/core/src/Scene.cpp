@@ -1,12 +1,16 @@
 #include "spark/core/Scene.h"
+#include "spark/core/components/Transform.h"
 
+#include "spark/jobs/JobSystem.h"
 #include "spark/log/Logger.h"
-#include "spark/patterns/Traverser.h"
 
 namespace spark::core
 {
     Scene::Scene(GameObject* scene_root)
-        : m_root(scene_root) {}
+        : m_root(scene_root), m_deferredCalls(std::make_unique<patterns::DeferredCalls>()), m_collisionWorld(std::make_unique<CollisionWorld>())
+    {
+        static_cast<details::AbstractGameObject<GameObject>*>(m_root)->m_scene = this;
+    }
 
     Scene::~Scene()
     {
@@ -24,6 +28,16 @@ namespace spark::core
         return m_root;
     }
 
+    CollisionWorld& Scene::collisionWorld()
+    {
+        return *m_collisionWorld;
+    }
+
+    void Scene::setJobSystem(jobs::JobSystem* job_system)
+    {
+        m_jobSystem = job_system;
+    }
+
     void Scene::onLoad()
     {
         if (m_isLoaded)
@@ -31,32 +45,68 @@ namespace spark::core
 
         log::info("Loading scene {}", uuid().str());
 
-        auto traverser = spark::patterns::make_traverser<GameObject>([](auto* object)
+        traversalOrder().forEach([](GameObject* object)
         {
             static_cast<details::AbstractGameObject<GameObject>*>(object)->onSpawn();
         });
-        spark::patterns::traverse_tree(m_root, traverser);
 
         m_isLoaded = true;
     }
 
     void Scene::onUpdate(float dt)
     {
-        auto traverser = spark::patterns::make_traverser<GameObject>([&dt](auto* object)
+        if (m_jobSystem)
+            parallelUpdate(dt);
+        else
+        {
+            traversalOrder().forEach([dt](GameObject* object)
+            {
+                static_cast<details::AbstractGameObject<GameObject>*>(object)->onUpdate(dt);
+            });
+        }
+
+        m_collisionWorld->update();
+    }
+
+    void Scene::parallelUpdate(const float dt)
+    {
+        // The outdated matrices are computed before the parallel phase, so that reading a matrix there does not write its cache
+        m_parallelObjects.clear();
+        traversalOrder().forEach([this](GameObject* object)
+        {
+            if (const components::Transform* transform = object->transform())
+                transform->matrix();
+            if (static_cast<details::AbstractGameObject<GameObject>*>(object)->hasParallelUpdate())
+                m_parallelObjects.push_back(object);
+        });
+
+        jobs::parallel_for(*m_jobSystem, 0, m_parallelObjects.size(), [this, dt](const std::size_t i)
+        {
+            auto* object = static_cast<details::AbstractGameObject<GameObject>*>(m_parallelObjects[i]);
+
+            // Deferred calls are ordered by the position of their GameObject in the tree, so that the result does not depend on the threads
+            patterns::DeferredCalls::Scope scope(*m_deferredCalls, object->m_traversalIndex);
+            object->onParallelUpdate(dt);
+        });
+
+        // Synchronization point: apply the signal emissions and destructions requested by the parallel phase
+        m_deferredCalls->flush();
+
+        traversalOrder().forEach([dt](GameObject* object)
         {
-            static_cast<details::AbstractGameObject<GameObject>*>(object)->onUpdate(dt);
+            static_cast<details::AbstractGameObject<GameObject>*>(object)->onSerialUpdate(dt);
         });
-        spark::patterns::traverse_tree(m_root, traverser);
     }
 
     void Scene::onRender()
     {
-        auto traverser = spark::patterns::make_traverser<GameObject>([](const GameObject* object)
+        traversalOrder().forEach([](GameObject* object)
         {
-            for (const auto* component : object->components())
-                component->render();
+            const auto& components = static_cast<const details::AbstractGameObject<GameObject>*>(object)->m_components;
+            for (std::size_t i = 0; i < components.size(); ++i)
+                if (!components[i].removed)
+                    components[i].component->render();
         });
-        spark::patterns::traverse_tree(m_root, traverser);
     }
 
     void Scene::onUnload()
@@ -66,13 +116,17 @@ namespace spark::core
 
         log::info("Unloading scene {}", uuid().str());
 
-        auto traverser = spark::patterns::make_traverser<GameObject>([](auto* object)
+        traversalOrder().forEach([](GameObject* object)
         {
             static_cast<details::AbstractGameObject<GameObject>*>(object)->onDestroyed();
         });
-        spark::patterns::traverse_tree(m_root, traverser);
 
         m_isLoaded = false;
         log::info("Scene {} unloaded", uuid().str());
     }
+
+    details::TraversalOrder& Scene::traversalOrder()
+    {
+        return static_cast<details::AbstractGameObject<GameObject>*>(m_root)->traversalOrder();
+    }
 }
@@ -0,0 +1,153 @@
+#include "spark/core/TextureAtlas.h"
+
+#include "spark/base/Exception.h"
+
+#include "SFML/Graphics/Image.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+
+namespace spark::core
+{
+    TextureAtlas::TextureAtlas(const unsigned page_size, const unsigned padding)
+        : m_pageSize(page_size), m_padding(padding)
+    {
+        if (page_size <= padding * 2)
+            throw base::BadArgumentException(std::format("The pages of a texture atlas must be larger than twice the padding ({}), but {} was given.", padding * 2, page_size));
+    }
+
+    const AtlasRegion& TextureAtlas::load(const std::filesystem::path& path)
+    {
+        const std::string name = path.generic_string();
+        if (const AtlasRegion* region = find(name))
+            return *region;
+
+        sf::Image image;
+        if (!image.loadFromFile(name))
+            throw base::CouldNotOpenFileException(std::format("Could not load the image {}", name));
+
+        const auto size = image.getSize();
+        const auto* pixels = reinterpret_cast<const std::uint8_t*>(image.getPixelsPtr());
+        return add(name, {size.x, size.y}, {pixels, static_cast<std::size_t>(size.x) * size.y * 4});
+    }
+
+    const AtlasRegion& TextureAtlas::add(const std::string& name, const math::Vector2<unsigned>& size, const std::span<const std::uint8_t> pixels)
+    {
+        if (m_regions.contains(name))
+            throw base::BadArgumentException(std::format("A texture named {} is already in the atlas.", name));
+        if (size.x == 0 || size.y == 0)
+            throw base::BadArgumentException(std::format("Unable to add the empty texture {} to the atlas.", name));
+        if (pixels.size() != static_cast<std::size_t>(size.x) * size.y * 4)
+            throw base::BadArgumentException(std::format("The texture {} of {}x{} pixels needs {} bytes, but {} were given.", name, size.x, size.y, size.x * size.y * 4, pixels.size()));
+        if (size.x > m_pageSize - m_padding * 2 || size.y > m_pageSize - m_padding * 2)
+            throw base::BadArgumentException(std::format("The texture {} of {}x{} pixels does not fit in a page of {}x{} pixels.", name, size.x, size.y, m_pageSize, m_pageSize));
+
+        std::size_t page_index = 0;
+        const math::Vector2<unsigned> corner = allocate(size.x + m_padding * 2, size.y + m_padding * 2, page_index);
+        Page& page = m_pages[page_index];
+        page.isDirty = true;
+
+        // Copy the rows of the texture, repeating its border pixels in the padding
+        const std::size_t row_size = static_cast<std::size_t>(size.x) * 4;
+        for (unsigned y = 0; y < size.y + m_padding * 2; ++y)
+        {
+            const unsigned source_y = std::clamp(static_cast<int>(y) - static_cast<int>(m_padding), 0, static_cast<int>(size.y) - 1);
+            const std::uint8_t* source = pixels.data() + source_y * row_size;
+            std::uint8_t* target = page.pixels.data() + (static_cast<std::size_t>(corner.y + y) * m_pageSize + corner.x) * 4;
+
+            for (unsigned x = 0; x < m_padding; ++x)
+            {
+                std::memcpy(target + x * 4, source, 4);
+                std::memcpy(target + (m_padding + size.x + x) * 4, source + row_size - 4, 4);
+            }
+            std::memcpy(target + m_padding * 4, source, row_size);
+        }
+
+        const auto page_size = static_cast<float>(m_pageSize);
+        const AtlasRegion region = {
+            .page = static_cast<unsigned>(page_index),
+            .uv = {
+                static_cast<float>(corner.x + m_padding) / page_size,
+                static_cast<float>(corner.y + m_padding) / page_size,
+                static_cast<float>(corner.x + m_padding + size.x) / page_size,
+                static_cast<float>(corner.y + m_padding + size.y) / page_size
+            },
+            .size = size
+        };
+        return m_regions.emplace(name, region).first->second;
+    }
+
+    const AtlasRegion* TextureAtlas::find(const std::string& name) const
+    {
+        const auto it = m_regions.find(name);
+        return it != m_regions.end() ? &it->second : nullptr;
+    }
+
+    unsigned TextureAtlas::pageSize() const noexcept
+    {
+        return m_pageSize;
+    }
+
+    std::size_t TextureAtlas::pageCount() const noexcept
+    {
+        return m_pages.size();
+    }
+
+    std::span<const std::uint8_t> TextureAtlas::pixels(const std::size_t page) const
+    {
+        if (page >= m_pages.size())
+            throw base::ArgumentOutOfRangeException(std::format("The texture atlas has {} pages, unable to get page {}.", m_pages.size(), page));
+        return m_pages[page].pixels;
+    }
+
+    std::vector<std::size_t> TextureAtlas::dirtyPages() const
+    {
+        std::vector<std::size_t> pages;
+        for (std::size_t i = 0; i < m_pages.size(); ++i)
+            if (m_pages[i].isDirty)
+                pages.push_back(i);
+        return pages;
+    }
+
+    void TextureAtlas::clearDirtyPages() noexcept
+    {
+        for (Page& page : m_pages)
+            page.isDirty = false;
+    }
+
+    math::Vector2<unsigned> TextureAtlas::allocate(const unsigned width, const unsigned height, std::size_t& page)
+    {
+        for (page = 0; page < m_pages.size(); ++page)
+        {
+            Page& current = m_pages[page];
+
+            // Use the shelf wasting the least height
+            Shelf* best = nullptr;
+            for (Shelf& shelf : current.shelves)
+                if (shelf.height >= height && m_pageSize - shelf.width >= width && (!best || shelf.height < best->height))
+                    best = &shelf;
+
+            // Or open a new shelf below the others
+            if (!best && m_pageSize - current.height >= height)
+            {
+                best = &current.shelves.emplace_back(Shelf {.y = current.height, .height = height, .width = 0});
+                current.height += height;
+            }
+
+            if (best)
+            {
+                const math::Vector2<unsigned> corner = {best->width, best->y};
+                best->width += width;
+                return corner;
+            }
+        }
+
+        // No page has enough space left, start a new one
+        Page& new_page = m_pages.emplace_back();
+        new_page.pixels.resize(static_cast<std::size_t>(m_pageSize) * m_pageSize * 4);
+        new_page.shelves.push_back({.y = 0, .height = height, .width = width});
+        new_page.height = height;
+        return {0, 0};
+    }
+}
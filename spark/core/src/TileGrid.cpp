@@ -0,0 +1,107 @@
+#include "spark/core/TileGrid.h"
+
+#include "spark/base/Exception.h"
+
+#include <algorithm>
+#include <format>
+
+namespace spark::core
+{
+    TileGrid::TileGrid(const math::Vector2<unsigned>& size, const unsigned chunk_size)
+        : m_size(size), m_chunkSize(chunk_size)
+    {
+        if (chunk_size == 0)
+            throw base::BadArgumentException("The chunks of a tile grid must hold at least one tile.");
+
+        m_chunkCount = {(size.x + chunk_size - 1) / chunk_size, (size.y + chunk_size - 1) / chunk_size};
+        m_tiles.resize(static_cast<std::size_t>(size.x) * size.y, 0);
+        m_isTileDirty.resize(m_tiles.size(), false);
+        m_dirtyTiles.resize(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y);
+
+        // The tiles were never written anywhere, so all of them are modified
+        for (unsigned y = 0; y < size.y; ++y)
+            for (unsigned x = 0; x < size.x; ++x)
+                markDirty({x, y});
+    }
+
+    const math::Vector2<unsigned>& TileGrid::size() const noexcept
+    {
+        return m_size;
+    }
+
+    TileId TileGrid::at(const math::Vector2<unsigned>& position) const
+    {
+        if (position.x >= m_size.x || position.y >= m_size.y)
+            throw base::ArgumentOutOfRangeException(std::format("The tile ({}, {}) is outside of a grid of {}x{} tiles.", position.x, position.y, m_size.x, m_size.y));
+        return m_tiles[static_cast<std::size_t>(position.y) * m_size.x + position.x];
+    }
+
+    void TileGrid::set(const math::Vector2<unsigned>& position, const TileId tile)
+    {
+        if (position.x >= m_size.x || position.y >= m_size.y)
+            throw base::ArgumentOutOfRangeException(std::format("The tile ({}, {}) is outside of a grid of {}x{} tiles.", position.x, position.y, m_size.x, m_size.y));
+
+        TileId& current = m_tiles[static_cast<std::size_t>(position.y) * m_size.x + position.x];
+        if (current == tile)
+            return;
+        current = tile;
+        markDirty(position);
+    }
+
+    void TileGrid::fill(const TileId tile)
+    {
+        for (unsigned y = 0; y < m_size.y; ++y)
+            for (unsigned x = 0; x < m_size.x; ++x)
+                set({x, y}, tile);
+    }
+
+    unsigned TileGrid::chunkSize() const noexcept
+    {
+        return m_chunkSize;
+    }
+
+    std::size_t TileGrid::chunkCount() const noexcept
+    {
+        return m_dirtyTiles.size();
+    }
+
+    math::Rectangle<unsigned> TileGrid::chunkTiles(const std::size_t chunk) const
+    {
+        if (chunk >= m_dirtyTiles.size())
+            throw base::ArgumentOutOfRangeException(std::format("The tile grid has {} chunks, unable to get chunk {}.", m_dirtyTiles.size(), chunk));
+
+        const math::Vector2<unsigned> position = {static_cast<unsigned>(chunk % m_chunkCount.x) * m_chunkSize, static_cast<unsigned>(chunk / m_chunkCount.x) * m_chunkSize};
+        return math::Rectangle<unsigned>(position, {std::min(m_chunkSize, m_size.x - position.x), std::min(m_chunkSize, m_size.y - position.y)});
+    }
+
+    std::span<const math::Vector2<unsigned>> TileGrid::dirtyTiles(const std::size_t chunk) const
+    {
+        if (chunk >= m_dirtyTiles.size())
+            throw base::ArgumentOutOfRangeException(std::format("The tile grid has {} chunks, unable to get chunk {}.", m_dirtyTiles.size(), chunk));
+        return m_dirtyTiles[chunk];
+    }
+
+    void TileGrid::clearDirtyTiles(const std::size_t chunk)
+    {
+        if (chunk >= m_dirtyTiles.size())
+            throw base::ArgumentOutOfRangeException(std::format("The tile grid has {} chunks, unable to get chunk {}.", m_dirtyTiles.size(), chunk));
+
+        for (const math::Vector2<unsigned>& position : m_dirtyTiles[chunk])
+            m_isTileDirty[static_cast<std::size_t>(position.y) * m_size.x + position.x] = false;
+        m_dirtyTiles[chunk].clear();
+    }
+
+    std::size_t TileGrid::chunkOf(const math::Vector2<unsigned>& position) const noexcept
+    {
+        return static_cast<std::size_t>(position.y / m_chunkSize) * m_chunkCount.x + position.x / m_chunkSize;
+    }
+
+    void TileGrid::markDirty(const math::Vector2<unsigned>& position)
+    {
+        const std::size_t index = static_cast<std::size_t>(position.y) * m_size.x + position.x;
+        if (m_isTileDirty[index])
+            return;
+        m_isTileDirty[index] = true;
+        m_dirtyTiles[chunkOf(position)].push_back(position);
+    }
+}
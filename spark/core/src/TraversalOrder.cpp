@@ -0,0 +1,82 @@
+#include "spark/core/GameObject.h"
+#include "spark/core/details/TraversalOrder.h"
+
+#include <algorithm>
+
+namespace spark::core::details
+{
+    TraversalOrder::TraversalOrder(GameObject* root)
+        : m_root(root) {}
+
+    void TraversalOrder::invalidate()
+    {
+        m_dirty = true;
+    }
+
+    void TraversalOrder::onRemoved(const GameObject* object)
+    {
+        m_dirty = true;
+        if (m_visiting)
+            forget(object);
+    }
+
+    std::span<GameObject* const> TraversalOrder::descendants(const GameObject* object)
+    {
+        update();
+
+        const auto* node = static_cast<const AbstractGameObject<GameObject>*>(object);
+        return std::span(m_objects).subspan(node->m_traversalIndex + 1, node->m_subtreeSize - 1);
+    }
+
+    void TraversalOrder::update()
+    {
+        if (!m_dirty)
+            return;
+
+        // During forEach, the entries of the removed objects are cleared, so the last visited object still in the tree is the last entry left before the
+        // visited one. The root is never removed from its own tree.
+        const GameObject* last_visited = nullptr;
+        if (m_visiting)
+        {
+            std::size_t index = std::min(m_visitedIndex, m_objects.size() - 1);
+            while (m_objects[index] == nullptr)
+                --index;
+            last_visited = m_objects[index];
+        }
+
+        // The list keeps its capacity, so rebuilding it does not allocate unless the tree grew
+        m_objects.clear();
+        append(m_root);
+        m_dirty = false;
+
+        if (last_visited)
+            m_visitedIndex = indexOf(last_visited);
+    }
+
+    void TraversalOrder::append(GameObject* object)
+    {
+        auto* node = static_cast<AbstractGameObject<GameObject>*>(object);
+        node->m_traversalIndex = m_objects.size();
+        m_objects.push_back(object);
+
+        for (std::size_t i = 0; i < object->childCount(); ++i)
+            append(object->child(i));
+        node->m_subtreeSize = m_objects.size() - node->m_traversalIndex;
+    }
+
+    void TraversalOrder::forget(const GameObject* object)
+    {
+        // Objects added since the list was built are not in it, but their children may be
+        const std::size_t index = indexOf(object);
+        if (index < m_objects.size() && m_objects[index] == object)
+            m_objects[index] = nullptr;
+
+        for (std::size_t i = 0; i < object->childCount(); ++i)
+            forget(object->child(i));
+    }
+
+    std::size_t TraversalOrder::indexOf(const GameObject* object) const
+    {
+        return static_cast<const AbstractGameObject<GameObject>*>(object)->m_traversalIndex;
+    }
+}
@@ -425,7 +425,9 @@ namespace spark::core
                                                          glfwCreateWindowSurface(instance, PRIVATE_TO_WINDOW(m_window), nullptr, &vk_surface);
                                                          return vk_surface;
                                                      },
-                                                     required_extensions);
+                                                     required_extensions,
+                                                     m_settings.framesInFlight,
+                                                     m_settings.instanceFormat);
 
         // Init ImGui
         imgui::init(PRIVATE_TO_WINDOW(m_window), *m_renderer->m_renderBackend, *m_renderer->m_device, m_renderer->m_device->state().renderPass("Opaque"));
@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/GameObject.h"
+#include "spark/core/components/Collider.h"
+#include "spark/core/components/Transform.h"
+#include "spark/core/details/BoundsBatch.h"
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace spark::core::testing
+{
+    namespace
+    {
+        /**
+         * \brief Gets all the instruction sets supported by the CPU running the tests.
+         */
+        std::vector<details::SimdLevel> supported_levels()
+        {
+            std::vector<details::SimdLevel> levels = {details::SimdLevel::Scalar};
+            if (details::BoundsBatch::SupportedSimdLevel() >= details::SimdLevel::Sse)
+                levels.push_back(details::SimdLevel::Sse);
+            if (details::BoundsBatch::SupportedSimdLevel() >= details::SimdLevel::Avx)
+                levels.push_back(details::SimdLevel::Avx);
+            return levels;
+        }
+    }
+
+    TEST(BoundsBatchShould, findTheSameCollisionsAsCollidesWith)
+    {
+        // Given colliders of random positions, sizes and scales (including negative ones flipping the bounds)
+        std::mt19937 generator(1234);
+        std::uniform_real_distribution<float> position(-100.f, 100.f), size(0.f, 40.f), scale(-2.f, 2.f);
+
+        auto* root = GameObject::Instantiate("Root", nullptr);
+        std::vector<const components::Collider*> colliders;
+        details::BoundsBatch batch;
+        for (std::size_t i = 0; i < 301; ++i)
+        {
+            auto* object = GameObject::Instantiate(std::to_string(i), root);
+            object->transform()->setPosition({position(generator), position(generator)});
+            object->transform()->setScale({scale(generator), scale(generator)});
+            object->addComponent<components::StaticCollider>(math::Rectangle<float> {{0, 0}, {size(generator), size(generator)}});
+
+            colliders.push_back(object->component<components::StaticCollider>());
+            batch.push(colliders.back()->bounds());
+        }
+
+        // When testing each collider against the whole batch with every instruction set
+        for (const details::SimdLevel level : supported_levels())
+        {
+            for (std::size_t i = 0; i < colliders.size(); ++i)
+            {
+                std::vector<std::uint32_t> result;
+                batch.overlaps(colliders[i]->bounds(), 0, batch.size(), result, level);
+
+                // Then, the overlapping bounds are the colliders colliding with it, in order
+                std::vector<std::uint32_t> expected;
+                for (std::size_t j = 0; j < colliders.size(); ++j)
+                    if (colliders[i]->collidesWith(*colliders[j]))
+                        expected.push_back(static_cast<std::uint32_t>(j));
+                EXPECT_EQ(result, expected) << "with collider " << i << " and SIMD level " << static_cast<int>(level);
+            }
+        }
+
+        GameObject::Destroy(root, true);
+    }
+
+    TEST(BoundsBatchShould, onlyTestTheGivenRange)
+    {
+        // Given a batch of identical bounds
+        details::BoundsBatch batch;
+        for (std::size_t i = 0; i < 37; ++i)
+            batch.push({0, 0, 10, 10});
+
+        for (const details::SimdLevel level : supported_levels())
+        {
+            // When testing a sub range not aligned on the SIMD width
+            std::vector<std::uint32_t> result;
+            batch.overlaps({5, 5, 6, 6}, 3, 30, result, level);
+
+            // Then, only the indices of the range are returned
+            ASSERT_EQ(result.size(), 27);
+            for (std::size_t i = 0; i < result.size(); ++i)
+                EXPECT_EQ(result[i], i + 3);
+        }
+    }
+
+    TEST(BoundsBatchShould, considerTouchingBoundsAsOverlappingAndIgnoreNaN)
+    {
+        // Given bounds touching the tested one on an edge, and bounds containing a NaN
+        constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+        const std::vector<math::Vector4<float>> bounds = {
+            {10, 0, 20, 10},
+            {0, 10, 10, 20},
+            {nan, 0, 10, 10},
+            {11, 11, 20, 20},
+            {0, 0, 10, nan},
+            {-10, -10, 0, 0},
+            {2, 2, 3, 3},
+            {-5, 5, -1, 6},
+            {5, -5, 6, -1}
+        };
+
+        details::BoundsBatch batch;
+        for (const auto& b : bounds)
+            batch.push(b);
+
+        for (const details::SimdLevel level : supported_levels())
+        {
+            // When testing them
+            std::vector<std::uint32_t> result;
+            batch.overlaps({0, 0, 10, 10}, 0, batch.size(), result, level);
+
+            // Then, the result is the same as the scalar test
+            std::vector<std::uint32_t> expected;
+            for (std::size_t i = 0; i < bounds.size(); ++i)
+                if (components::Collider::Overlaps({0, 0, 10, 10}, bounds[i]))
+                    expected.push_back(static_cast<std::uint32_t>(i));
+            EXPECT_EQ(result, expected);
+            EXPECT_EQ(result, (std::vector<std::uint32_t> {0, 1, 5, 6}));
+        }
+    }
+
+    TEST(BoundsBatchShould, throwWhenTheRangeIsOutsideOfTheBatch)
+    {
+        // Given a batch of 4 bounds
+        details::BoundsBatch batch;
+        for (std::size_t i = 0; i < 4; ++i)
+            batch.push({0, 0, 1, 1});
+
+        // When testing outside of it, then it throws
+        std::vector<std::uint32_t> result;
+        EXPECT_THROW(batch.overlaps({0, 0, 1, 1}, 0, 5, result), base::BadArgumentException);
+        EXPECT_THROW(batch.overlaps({0, 0, 1, 1}, 3, 2, result), base::BadArgumentException);
+    }
+}
@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/CollisionWorld.h"
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+#include "spark/core/components/Collider.h"
+#include "spark/core/components/Transform.h"
+
+#include "spark/math/Vector2.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace spark::core::testing
+{
+    namespace
+    {
+        /**
+         * \brief A pair of colliders reported by a collision: the dynamic collider, then the one it collides with.
+         */
+        using Contact = std::pair<const components::Collider*, const components::Collider*>;
+
+        /**
+         * \brief A scene recording the collisions reported by its \ref CollisionWorld on each frame.
+         */
+        class RecordingScene
+        {
+        public:
+            explicit RecordingScene(const Broadphase broadphase)
+                : m_scene(GameObject::Instantiate("Root", nullptr))
+            {
+                m_scene.collisionWorld().setBroadphase(broadphase);
+                m_scene.collisionWorld().setCellSize(16.f);
+            }
+
+            /**
+             * \brief Adds a collider to the scene.
+             * \param position The position of the top-left corner of the collider.
+             * \param size The size of the collider.
+             * \param is_dynamic Whether the collider is dynamic, or static.
+             * \return The transform of the GameObject of the collider, to move it.
+             */
+            components::Transform* add(const math::Vector2<float>& position, const math::Vector2<float>& size, const bool is_dynamic)
+            {
+                auto* object = GameObject::Instantiate(std::to_string(m_colliders.size()), m_scene.root());
+                object->transform()->setPosition(position);
+                if (is_dynamic)
+                {
+                    object->addComponent<components::DynamicCollider>(math::Rectangle<float> {{0, 0}, size});
+                    auto* collider = object->component<components::DynamicCollider>();
+                    collider->onCollision.connect([this, collider](const components::Collider& other) { m_contacts.insert({collider, &other}); });
+                    m_colliders.push_back(collider);
+                } else
+                {
+                    object->addComponent<components::StaticCollider>(math::Rectangle<float> {{0, 0}, size});
+                    m_colliders.push_back(object->component<components::StaticCollider>());
+                }
+                return object->transform();
+            }
+
+            /**
+             * \brief Updates the scene.
+             * \return The contacts reported by the collision world during the update.
+             */
+            std::set<Contact> frame()
+            {
+                if (!m_isLoaded)
+                {
+                    m_scene.onLoad();
+                    m_isLoaded = true;
+                }
+
+                m_contacts.clear();
+                m_scene.onUpdate(1.f / 60.f);
+                return m_contacts;
+            }
+
+            /**
+             * \brief Finds the contacts by testing every dynamic collider against every other collider, with the bounds of the last frame.
+             * \return The contacts the collision world should report.
+             */
+            [[nodiscard]] std::set<Contact> bruteForce() const
+            {
+                const auto is_finite = [](const math::Vector4<float>& bounds)
+                {
+                    return std::isfinite(bounds.x) && std::isfinite(bounds.y) && std::isfinite(bounds.z) && std::isfinite(bounds.w);
+                };
+
+                std::set<Contact> contacts;
+                for (const components::Collider* source : m_colliders)
+                    for (const components::Collider* target : m_colliders)
+                        if (source != target && &source->rttiInstance() == &components::DynamicCollider::classRtti() && is_finite(source->bounds())
+                            && is_finite(target->bounds()) && source->collidesWith(*target))
+                            contacts.insert({source, target});
+                return contacts;
+            }
+
+        private:
+            Scene m_scene;
+            bool m_isLoaded = false;
+            std::vector<const components::Collider*> m_colliders;
+            std::set<Contact> m_contacts;
+        };
+    }
+
+    TEST(CollisionWorldShould, reportTheSameContactsAsABruteForceSearch)
+    {
+        for (const Broadphase broadphase : {Broadphase::SweepAndPrune, Broadphase::UniformGrid})
+        {
+            // Given colliders around the origin, spanning one to several cells of 16 units, which move on each frame
+            RecordingScene scene(broadphase);
+            std::mt19937 generator(7);
+            std::uniform_real_distribution<float> position(-100.f, 100.f), size(1.f, 40.f), velocity(-6.f, 6.f);
+            std::vector<std::pair<components::Transform*, math::Vector2<float>>> moving;
+            for (std::size_t i = 0; i < 60; ++i)
+            {
+                auto* transform = scene.add({position(generator), position(generator)}, {size(generator), size(generator)}, i % 4 != 0);
+                moving.push_back({transform, {velocity(generator), velocity(generator)}});
+            }
+
+            // When updating the scene on several frames
+            std::size_t begun = 0, ended = 0;
+            std::set<Contact> previous;
+            for (int frame = 0; frame < 20; ++frame)
+            {
+                for (auto& [transform, step] : moving)
+                    transform->setPosition(transform->position() + step);
+                const std::set<Contact> contacts = scene.frame();
+
+                // Then, each frame reports exactly the overlapping pairs, including the ones which just began or ended
+                EXPECT_EQ(contacts, scene.bruteForce()) << "Broadphase " << static_cast<int>(broadphase) << ", frame " << frame;
+                for (const Contact& contact : contacts)
+                    begun += !previous.contains(contact);
+                for (const Contact& contact : previous)
+                    ended += !contacts.contains(contact);
+                previous = contacts;
+            }
+            EXPECT_GT(begun, 0);
+            EXPECT_GT(ended, 0);
+        }
+    }
+
+    TEST(CollisionWorldShould, ignoreTheCollidersWhoseBoundsAreNotFinite)
+    {
+        for (const Broadphase broadphase : {Broadphase::SweepAndPrune, Broadphase::UniformGrid})
+        {
+            // Given colliders far outside of the range of the cells, and colliders whose position is not a number or infinite
+            RecordingScene scene(broadphase);
+            scene.add({1e30f, -1e30f}, {10.f, 10.f}, true);
+            scene.add({1e30f, -1e30f}, {10.f, 10.f}, false);
+            scene.add({-1e9f, 1e9f}, {300.f, 300.f}, true);
+            scene.add({-1e9f, 1e9f}, {10.f, 10.f}, false);
+            scene.add({std::numeric_limits<float>::quiet_NaN(), 0.f}, {10.f, 10.f}, true);
+            scene.add({std::numeric_limits<float>::infinity(), 0.f}, {10.f, 10.f}, true);
+            scene.add({0.f, 0.f}, {10.f, 10.f}, false);
+
+            // When updating the scene
+            const std::set<Contact> contacts = scene.frame();
+
+            // Then, the far colliders collide as expected, and the ones which are not finite do not collide
+            EXPECT_EQ(contacts, scene.bruteForce()) << "Broadphase " << static_cast<int>(broadphase);
+            EXPECT_EQ(contacts.size(), 2);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/Renderer2D.h"
+
+#include "spark/base/Exception.h"
+#include "spark/render/vk/VulkanBackend.h"
+
+#include <exception>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace spark::core::testing
+{
+    namespace
+    {
+        using Renderer = Renderer2D<render::vk::VulkanBackend>;
+
+        /**
+         * \brief Creates a small headless renderer, which needs a device but neither a window nor presentation support.
+         * \param error Set to the reason of the failure if the renderer cannot be created.
+         * \return The renderer, or `nullptr` if it cannot be created, for example on a machine without any Vulkan implementation.
+         */
+        std::unique_ptr<Renderer> make_headless_renderer(std::string& error)
+        {
+            try
+            {
+                return std::make_unique<Renderer>(math::Vector2<unsigned> {64, 64}, std::span<std::string> {});
+            }
+            catch (const std::exception& exception)
+            {
+                error = exception.what();
+                return nullptr;
+            }
+        }
+    }
+
+    TEST(Renderer2DShould, rejectTheStaticInstancesAlreadyRemoved)
+    {
+        std::string error;
+        const auto renderer = make_headless_renderer(error);
+        if (!renderer)
+            GTEST_SKIP() << "Unable to create a headless renderer: " << error;
+
+        // Given a removed static instance
+        const glm::mat3x2 transform({8.f, 0.f}, {0.f, 8.f}, {16.f, 16.f});
+        const StaticInstance removed = renderer->addStatic(transform, {1.f, 0.f, 0.f, 1.f});
+        renderer->removeStatic(removed);
+
+        // When removing or updating it again
+        // Then, it is rejected, and its identifier is only given once to a new instance
+        EXPECT_THROW(renderer->removeStatic(removed), base::ArgumentOutOfRangeException);
+        EXPECT_THROW(renderer->updateStatic(removed, transform, {0.f, 1.f, 0.f, 1.f}), base::ArgumentOutOfRangeException);
+        const StaticInstance reused = renderer->addStatic(transform, {0.f, 0.f, 1.f, 1.f});
+        const StaticInstance other = renderer->addStatic(transform, {0.f, 0.f, 1.f, 1.f});
+        EXPECT_EQ(reused, removed);
+        EXPECT_NE(other, reused);
+        EXPECT_NO_THROW(renderer->updateStatic(reused, transform, {1.f, 1.f, 1.f, 1.f}));
+    }
+}
@@ -0,0 +1,259 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+#include "spark/core/components/Transform.h"
+#include "spark/jobs/JobSystem.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace spark::core::testing
+{
+    /**
+     * \brief A GameObject recording its updates, which can destroy other objects and itself when updated.
+     */
+    class RecordingObject final : public GameObject
+    {
+        DECLARE_SPARK_RTTI(RecordingObject, GameObject)
+
+    public:
+        explicit RecordingObject(std::string name, GameObject* parent, std::vector<std::string>& updates, const bool destroy_on_update = false)
+            : GameObject(std::move(name), parent), m_updates(updates), m_destroyOnUpdate(destroy_on_update) {}
+
+        void onUpdate(float /*dt*/) override
+        {
+            m_updates.push_back(name());
+            for (GameObject* other : othersToDestroy)
+                Destroy(other, true);
+            if (m_destroyOnUpdate)
+                Destroy(this, true);
+        }
+
+        /// \brief The objects destroyed immediately when this one is updated.
+        std::vector<GameObject*> othersToDestroy;
+
+    private:
+        std::vector<std::string>& m_updates;
+        bool m_destroyOnUpdate;
+    };
+
+    /**
+     * \brief A GameObject reading the world position of its transform during the parallel update phase.
+     */
+    class MatrixReader final : public GameObject
+    {
+        DECLARE_SPARK_RTTI(MatrixReader, GameObject)
+        SPARK_THREAD_SAFE_UPDATE
+
+        explicit MatrixReader(std::string name, GameObject* parent)
+            : GameObject(std::move(name), parent) {}
+
+        void onUpdate(float /*dt*/) override
+        {
+            const glm::mat4& matrix = transform()->matrix();
+            worldPosition = {matrix[3].x, matrix[3].y};
+        }
+
+        math::Vector2<float> worldPosition;
+    };
+
+    /**
+     * \brief A component recording its updates and its destruction.
+     */
+    class RecordingComponent : public Component
+    {
+        DECLARE_SPARK_RTTI(RecordingComponent, Component)
+
+    public:
+        explicit RecordingComponent(GameObject* parent, std::vector<std::string>& events, std::string name = "RecordingComponent")
+            : Component(parent), m_events(events), m_name(std::move(name)) {}
+
+        ~RecordingComponent() override { m_events.push_back(m_name + " destroyed"); }
+
+        void onUpdate(float /*dt*/) override { m_events.push_back(m_name + " updated"); }
+
+    protected:
+        std::vector<std::string>& m_events;
+        std::string m_name;
+    };
+
+    /**
+     * \brief A component removing itself and the \ref RecordingComponent of its GameObject when updated.
+     */
+    class RemovingComponent final : public RecordingComponent
+    {
+        DECLARE_SPARK_RTTI(RemovingComponent, RecordingComponent)
+
+    public:
+        explicit RemovingComponent(GameObject* parent, std::vector<std::string>& events)
+            : RecordingComponent(parent, events, "RemovingComponent") {}
+
+        void onUpdate(float dt) override
+        {
+            RecordingComponent::onUpdate(dt);
+            gameObject()->removeComponent<RecordingComponent>();
+            gameObject()->removeComponent(this);
+            m_events.push_back(m_name + " still alive");
+        }
+    };
+}
+
+IMPLEMENT_SPARK_RTTI(spark::core::testing::RecordingObject)
+IMPLEMENT_SPARK_RTTI(spark::core::testing::MatrixReader)
+IMPLEMENT_SPARK_RTTI(spark::core::testing::RecordingComponent)
+IMPLEMENT_SPARK_RTTI(spark::core::testing::RemovingComponent)
+
+namespace spark::core::testing
+{
+    /**
+     * \brief Gets the names of the GameObjects having a transform in a scene, through its view.
+     * \param scene The scene to look into.
+     * \return The sorted names of the GameObjects found.
+     */
+    std::vector<std::string> transformNames(const Scene& scene)
+    {
+        std::vector<std::string> names;
+        scene.view<components::Transform>().each([&names](const components::Transform& transform)
+        {
+            names.push_back(transform.gameObject()->name());
+        });
+        std::ranges::sort(names);
+        return names;
+    }
+
+    TEST(SceneShould, updateTheNextObjectsWhenAnObjectDestroysItself)
+    {
+        // Given a scene where an object with a child destroys itself immediately when updated
+        std::vector<std::string> updates;
+        auto* root = new GameObject("root");
+        new RecordingObject("first", root, updates);
+        auto* destroyed = new RecordingObject("destroyed", root, updates, true);
+        new RecordingObject("child", destroyed, updates);
+        new RecordingObject("second", root, updates);
+        new RecordingObject("third", root, updates);
+
+        Scene scene(root);
+        scene.onLoad();
+
+        // When updating the scene
+        scene.onUpdate(0.f);
+
+        // Then, the destroyed object and its child are removed, and all the objects after them are updated once
+        EXPECT_EQ(updates, (std::vector<std::string> {"first", "destroyed", "second", "third"}));
+        EXPECT_EQ(root->childCount(), 3);
+
+        // And the next update only visits the remaining objects
+        updates.clear();
+        scene.onUpdate(0.f);
+        EXPECT_EQ(updates, (std::vector<std::string> {"first", "second", "third"}));
+    }
+
+    TEST(SceneShould, updateTheNextObjectsWhenAnObjectDestroysItselfAndPreviousOnes)
+    {
+        // Given a scene where an object destroys two objects updated before it, then itself
+        std::vector<std::string> updates;
+        auto* root = new GameObject("root");
+        auto* first = new RecordingObject("first", root, updates);
+        new RecordingObject("child", first, updates);
+        auto* second = new RecordingObject("second", root, updates);
+        auto* destroying = new RecordingObject("destroying", root, updates, true);
+        destroying->othersToDestroy = {first, second};
+        new RecordingObject("third", root, updates);
+        new RecordingObject("fourth", root, updates);
+
+        Scene scene(root);
+        scene.onLoad();
+
+        // When updating the scene
+        scene.onUpdate(0.f);
+
+        // Then, all the objects after the destroyed ones are still updated once
+        EXPECT_EQ(updates, (std::vector<std::string> {"first", "child", "second", "destroying", "third", "fourth"}));
+        EXPECT_EQ(root->childCount(), 2);
+    }
+
+    TEST(SceneShould, onlyViewTheComponentsOfObjectsMovedIntoIt)
+    {
+        // Given two scenes, the first one holding an object with a child
+        auto* moved = new GameObject("moved", new GameObject("first"));
+        auto* child = new GameObject("child", moved);
+        auto first = std::make_unique<Scene>(moved->parent());
+        Scene second(new GameObject("second"));
+
+        // When moving the object to the second scene
+        moved->setParent(second.root());
+
+        // Then, the components of the object and its child are only viewed by the second scene
+        EXPECT_EQ(transformNames(*first), (std::vector<std::string> {"first"}));
+        EXPECT_EQ(transformNames(second), (std::vector<std::string> {"child", "moved", "second"}));
+        EXPECT_EQ(moved->scene(), &second);
+
+        // And the moved components are still valid once the first scene is destroyed
+        first.reset();
+        child->transform()->setPosition({1.f, 2.f});
+        child->removeComponent<components::Transform>();
+        EXPECT_EQ(transformNames(second), (std::vector<std::string> {"moved", "second"}));
+    }
+
+    TEST(SceneShould, computeTheOutdatedMatricesBeforeTheParallelPhase)
+    {
+        // Given a scene updated on a job system, whose root moved after the matrices of its children were computed
+        auto* root = new GameObject("root");
+        std::vector<MatrixReader*> readers;
+        for (int i = 0; i < 256; ++i)
+        {
+            readers.push_back(new MatrixReader(std::to_string(i), root));
+            readers.back()->transform()->setPosition({static_cast<float>(i), 0.f});
+            readers.back()->transform()->matrix();
+        }
+        root->transform()->setPosition({1000.f, 10.f});
+
+        jobs::JobSystem job_system(4);
+        Scene scene(root);
+        scene.setJobSystem(&job_system);
+        scene.onLoad();
+
+        // When the children read their matrix concurrently in the parallel phase
+        scene.onUpdate(0.f);
+
+        // Then, they all see the new position of the root
+        for (int i = 0; i < 256; ++i)
+            EXPECT_EQ(readers[static_cast<std::size_t>(i)]->worldPosition, (math::Vector2<float> {1000.f + static_cast<float>(i), 10.f}));
+    }
+
+    TEST(SceneShould, destroyTheComponentsRemovedDuringTheUpdateAtTheEndOfTheFrame)
+    {
+        // Given a scene where a component removes itself and another component of its object when updated
+        std::vector<std::string> events;
+        auto* root = new GameObject("root");
+        auto* object = new GameObject("object", root);
+        object->addComponent<RemovingComponent>(events);
+        object->addComponent<RecordingComponent>(events);
+
+        Scene scene(root);
+        scene.onLoad();
+
+        // When updating the scene
+        scene.onUpdate(0.f);
+
+        // Then, the removed components are not updated nor found anymore, but are only destroyed at the end of the frame
+        EXPECT_EQ(events, (std::vector<std::string> {"RemovingComponent updated", "RemovingComponent still alive"}));
+        EXPECT_FALSE(object->hasComponent<RemovingComponent>());
+        EXPECT_FALSE(object->hasComponent<RecordingComponent>());
+        EXPECT_EQ(object->components().size(), 1);
+        scene.onRender();
+
+        events.clear();
+        details::GameObjectDeleter<GameObject>::DeleteMarkedObjects();
+        EXPECT_EQ(events, (std::vector<std::string> {"RemovingComponent destroyed", "RecordingComponent destroyed"}));
+
+        // And a component of the same type can be added again
+        object->addComponent<RecordingComponent>(events);
+        events.clear();
+        scene.onUpdate(0.f);
+        EXPECT_EQ(events, (std::vector<std::string> {"RecordingComponent updated"}));
+    }
+}
@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/TextureAtlas.h"
+
+#include "spark/base/Exception.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spark::core::testing
+{
+    namespace
+    {
+        /**
+         * \brief Creates the RGBA8 pixels of a texture where every pixel stores its coordinates and \p id.
+         */
+        std::vector<std::uint8_t> make_pixels(const math::Vector2<unsigned>& size, const std::uint8_t id)
+        {
+            std::vector<std::uint8_t> pixels;
+            for (unsigned y = 0; y < size.y; ++y)
+                for (unsigned x = 0; x < size.x; ++x)
+                    pixels.insert(pixels.end(), {static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), id, 255});
+            return pixels;
+        }
+
+        /**
+         * \brief Gets the pixel of a page at the given coordinates.
+         */
+        std::vector<std::uint8_t> pixel_at(const TextureAtlas& atlas, const AtlasRegion& region, const unsigned x, const unsigned y)
+        {
+            const auto pixels = atlas.pixels(region.page);
+            const std::size_t offset = (static_cast<std::size_t>(y) * atlas.pageSize() + x) * 4;
+            return {pixels.begin() + static_cast<std::ptrdiff_t>(offset), pixels.begin() + static_cast<std::ptrdiff_t>(offset) + 4};
+        }
+    }
+
+    TEST(TextureAtlasShould, packTexturesWithoutOverlapping)
+    {
+        // Given an atlas of 64x64 pixels pages
+        TextureAtlas atlas(64, 1);
+
+        // When adding textures of various sizes
+        std::vector<const AtlasRegion*> regions;
+        for (std::uint8_t i = 0; i < 12; ++i)
+        {
+            const math::Vector2<unsigned> size = {4u + i % 5 * 3, 3u + i % 4 * 5};
+            regions.push_back(&atlas.add(std::to_string(i), size, make_pixels(size, i)));
+        }
+
+        // Then, every texture is copied in its region, and the regions (including their padding) do not overlap
+        for (std::size_t i = 0; i < regions.size(); ++i)
+        {
+            const AtlasRegion& region = *regions[i];
+            const auto left = static_cast<unsigned>(region.uv.x * 64.f), top = static_cast<unsigned>(region.uv.y * 64.f);
+            EXPECT_EQ(static_cast<unsigned>(region.uv.z * 64.f) - left, region.size.x);
+            EXPECT_EQ(static_cast<unsigned>(region.uv.w * 64.f) - top, region.size.y);
+
+            for (unsigned y = 0; y < region.size.y; ++y)
+                for (unsigned x = 0; x < region.size.x; ++x)
+                    ASSERT_EQ(pixel_at(atlas, region, left + x, top + y),
+                              (std::vector<std::uint8_t> {static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), static_cast<std::uint8_t>(i), 255}));
+
+            for (std::size_t j = i + 1; j < regions.size(); ++j)
+            {
+                const AtlasRegion& other = *regions[j];
+                if (other.page != region.page)
+                    continue;
+
+                const float padding = 1.f / 64.f;
+                const bool overlaps = region.uv.x - padding < other.uv.z + padding && other.uv.x - padding < region.uv.z + padding
+                    && region.uv.y - padding < other.uv.w + padding && other.uv.y - padding < region.uv.w + padding;
+                EXPECT_FALSE(overlaps) << "textures " << i << " and " << j;
+            }
+        }
+    }
+
+    TEST(TextureAtlasShould, repeatTheBorderPixelsInThePadding)
+    {
+        // Given an atlas with a padding of 2 pixels
+        TextureAtlas atlas(32, 2);
+
+        // When adding a texture
+        const AtlasRegion& region = atlas.add("texture", {3, 2}, make_pixels({3, 2}, 7));
+
+        // Then, the pixels around it are copies of its closest border pixel
+        const auto left = static_cast<unsigned>(region.uv.x * 32.f), top = static_cast<unsigned>(region.uv.y * 32.f);
+        EXPECT_EQ(pixel_at(atlas, region, left - 2, top - 2), (std::vector<std::uint8_t> {0, 0, 7, 255}));
+        EXPECT_EQ(pixel_at(atlas, region, left + 4, top - 1), (std::vector<std::uint8_t> {2, 0, 7, 255}));
+        EXPECT_EQ(pixel_at(atlas, region, left - 1, top + 3), (std::vector<std::uint8_t> {0, 1, 7, 255}));
+        EXPECT_EQ(pixel_at(atlas, region, left + 1, top + 2), (std::vector<std::uint8_t> {1, 1, 7, 255}));
+    }
+
+    TEST(TextureAtlasShould, startANewPageWhenFullAndTrackTheModifiedPages)
+    {
+        // Given an atlas of 16x16 pixels pages, filled with a texture
+        TextureAtlas atlas(16, 1);
+        atlas.add("first", {14, 14}, make_pixels({14, 14}, 0));
+        EXPECT_EQ(atlas.dirtyPages(), std::vector<std::size_t> {0});
+        atlas.clearDirtyPages();
+
+        // When adding another texture
+        const AtlasRegion& region = atlas.add("second", {4, 4}, make_pixels({4, 4}, 1));
+
+        // Then, it goes on a new page, which is the only one modified
+        EXPECT_EQ(region.page, 1);
+        EXPECT_EQ(atlas.pageCount(), 2);
+        EXPECT_EQ(atlas.dirtyPages(), std::vector<std::size_t> {1});
+        EXPECT_EQ(atlas.find("second"), &region);
+        EXPECT_EQ(atlas.find("third"), nullptr);
+    }
+
+    TEST(TextureAtlasShould, rejectInvalidTextures)
+    {
+        TextureAtlas atlas(16, 1);
+        atlas.add("texture", {2, 2}, make_pixels({2, 2}, 0));
+
+        EXPECT_THROW(atlas.add("texture", {2, 2}, make_pixels({2, 2}, 0)), base::BadArgumentException);
+        EXPECT_THROW(atlas.add("too large", {15, 2}, make_pixels({15, 2}, 0)), base::BadArgumentException);
+        EXPECT_THROW(atlas.add("wrong size", {2, 2}, make_pixels({2, 1}, 0)), base::BadArgumentException);
+        EXPECT_THROW(atlas.add("empty", {0, 2}, {}), base::BadArgumentException);
+        EXPECT_THROW(atlas.load("missing.png"), base::CouldNotOpenFileException);
+        EXPECT_THROW(TextureAtlas(4, 2), base::BadArgumentException);
+    }
+}
@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/TileGrid.h"
+
+#include "spark/base/Exception.h"
+
+#include <tuple>
+
+namespace spark::core::testing
+{
+    TEST(TileGridShould, splitTheTilesInChunks)
+    {
+        // Given a grid of 10x5 tiles with chunks of 4x4 tiles
+        const TileGrid grid({10, 5}, 4);
+
+        // When getting its chunks
+        // Then, they cover the grid row by row, and the chunks on the borders are smaller
+        EXPECT_EQ(grid.chunkCount(), 6);
+        EXPECT_EQ(grid.chunkTiles(0).position, (math::Vector2<unsigned> {0, 0}));
+        EXPECT_EQ(grid.chunkTiles(0).extent, (math::Vector2<unsigned> {4, 4}));
+        EXPECT_EQ(grid.chunkTiles(2).position, (math::Vector2<unsigned> {8, 0}));
+        EXPECT_EQ(grid.chunkTiles(2).extent, (math::Vector2<unsigned> {2, 4}));
+        EXPECT_EQ(grid.chunkTiles(5).position, (math::Vector2<unsigned> {8, 4}));
+        EXPECT_EQ(grid.chunkTiles(5).extent, (math::Vector2<unsigned> {2, 1}));
+    }
+
+    TEST(TileGridShould, onlyListTheModifiedTilesOfEachChunk)
+    {
+        // Given a grid whose initial tiles were written
+        TileGrid grid({8, 8}, 4);
+        EXPECT_EQ(grid.dirtyTiles(0).size(), 16);
+        for (std::size_t chunk = 0; chunk < grid.chunkCount(); ++chunk)
+            grid.clearDirtyTiles(chunk);
+
+        // When changing tiles, one of them twice and one of them to its current value
+        grid.set({5, 1}, 2);
+        grid.set({5, 1}, 3);
+        grid.set({0, 6}, 0);
+        grid.set({6, 7}, 1);
+
+        // Then, only the tiles which changed are listed once, in their chunk
+        EXPECT_EQ(grid.at({5, 1}), 3);
+        ASSERT_EQ(grid.dirtyTiles(1).size(), 1);
+        EXPECT_EQ(grid.dirtyTiles(1)[0], (math::Vector2<unsigned> {5, 1}));
+        EXPECT_TRUE(grid.dirtyTiles(0).empty());
+        EXPECT_TRUE(grid.dirtyTiles(2).empty());
+        ASSERT_EQ(grid.dirtyTiles(3).size(), 1);
+        EXPECT_EQ(grid.dirtyTiles(3)[0], (math::Vector2<unsigned> {6, 7}));
+
+        // And a cleared tile is listed again when it changes
+        grid.clearDirtyTiles(1);
+        grid.set({5, 1}, 0);
+        EXPECT_EQ(grid.dirtyTiles(1).size(), 1);
+    }
+
+    TEST(TileGridShould, rejectTilesOutsideOfTheGrid)
+    {
+        TileGrid grid({3, 2}, 2);
+
+        EXPECT_THROW(grid.set({3, 0}, 1), base::ArgumentOutOfRangeException);
+        EXPECT_THROW(std::ignore = grid.at({0, 2}), base::ArgumentOutOfRangeException);
+        EXPECT_THROW(std::ignore = grid.chunkTiles(2), base::ArgumentOutOfRangeException);
+        EXPECT_THROW(TileGrid({3, 2}, 0), base::BadArgumentException);
+    }
+}
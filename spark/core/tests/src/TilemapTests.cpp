@@ -0,0 +1,42 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/GameObject.h"
+#include "spark/core/components/Tilemap.h"
+#include "spark/core/details/SerializationSchemes.h"
+
+#include "experimental/ser/MemorySerializer.h"
+
+namespace spark::core::testing
+{
+    TEST(TilemapShould, keepItsPaletteAndItsTilesWhenSerialized)
+    {
+        // Given a tilemap of 3x2 tiles with a custom palette and some modified tiles
+        auto* saved = new GameObject("saved");
+        saved->addComponent<components::Tilemap>(math::Vector2<unsigned> {3, 2}, math::Vector2<float> {16.f, 8.f}, 2.f);
+        auto* tilemap = saved->component<components::Tilemap>();
+        tilemap->palette = {{1.f, 0.f, 0.f, 1.f}, {0.f, 1.f, 0.f, 0.5f}};
+        tilemap->setTile({2, 0}, 1);
+        tilemap->setTile({0, 1}, 5);
+
+        // When serializing it, then deserializing it into the default tilemap of another object
+        experimental::ser::MemorySerializer serializer;
+        serializer << *tilemap;
+        experimental::ser::MemorySerializer deserializer(serializer.content());
+        auto* loaded = new GameObject("loaded");
+        loaded->addComponent<components::Tilemap>();
+        auto* copy = loaded->component<components::Tilemap>();
+        deserializer >> *copy;
+
+        // Then, the copy has the same tiles, palette and layout
+        EXPECT_EQ(copy->tileSize, tilemap->tileSize);
+        EXPECT_EQ(copy->spacing, tilemap->spacing);
+        EXPECT_EQ(copy->palette, tilemap->palette);
+        ASSERT_EQ(copy->size(), (math::Vector2<unsigned> {3, 2}));
+        for (unsigned y = 0; y < 2; ++y)
+            for (unsigned x = 0; x < 3; ++x)
+                EXPECT_EQ(copy->tile({x, y}), tilemap->tile({x, y})) << "Tile (" << x << ", " << y << ")";
+
+        GameObject::Destroy(saved, true);
+        GameObject::Destroy(loaded, true);
+    }
+}
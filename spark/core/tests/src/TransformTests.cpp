@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/GameObject.h"
+#include "spark/core/components/Transform.h"
+
+namespace spark::core::testing
+{
+    /**
+     * \brief Gets the world position of a transform, from its matrix.
+     * \param transform The transform to get the position of.
+     * \return The translation of the local-to-world matrix of \p transform.
+     */
+    math::Vector2<float> worldPosition(const components::Transform& transform)
+    {
+        const glm::mat4& matrix = transform.matrix();
+        return {matrix[3].x, matrix[3].y};
+    }
+
+    TEST(TransformShould, updateTheMatricesOfTheChildrenWhenItMoves)
+    {
+        // Given an object with a child and a grandchild, whose matrices were computed
+        auto* root = new GameObject("root");
+        auto* child = new GameObject("child", root);
+        auto* grandchild = new GameObject("grandchild", child);
+        root->transform()->setPosition({10.f, 0.f});
+        grandchild->transform()->setPosition({1.f, 2.f});
+        EXPECT_EQ(worldPosition(*grandchild->transform()), (math::Vector2<float> {11.f, 2.f}));
+
+        // When moving the root
+        root->transform()->setPosition({20.f, 5.f});
+
+        // Then, the matrices of its descendants follow it
+        EXPECT_EQ(worldPosition(*child->transform()), (math::Vector2<float> {20.f, 5.f}));
+        EXPECT_EQ(worldPosition(*grandchild->transform()), (math::Vector2<float> {21.f, 7.f}));
+
+        GameObject::Destroy(root, true);
+    }
+
+    TEST(TransformShould, followItsNewParentWhenItsGameObjectIsMoved)
+    {
+        // Given an object whose matrix was computed under a first parent
+        auto* root = new GameObject("root");
+        auto* first = new GameObject("first", root);
+        auto* second = new GameObject("second", root);
+        auto* object = new GameObject("object", first);
+        first->transform()->setPosition({10.f, 0.f});
+        second->transform()->setPosition({0.f, 100.f});
+        object->transform()->setPosition({1.f, 2.f});
+        EXPECT_EQ(worldPosition(*object->transform()), (math::Vector2<float> {11.f, 2.f}));
+
+        // When moving it under the second parent, which then moves
+        object->setParent(second);
+        EXPECT_EQ(worldPosition(*object->transform()), (math::Vector2<float> {1.f, 102.f}));
+        second->transform()->setPosition({0.f, 50.f});
+
+        // Then, its matrix only depends on the second parent
+        first->transform()->setPosition({30.f, 0.f});
+        EXPECT_EQ(worldPosition(*object->transform()), (math::Vector2<float> {1.f, 52.f}));
+
+        GameObject::Destroy(root, true);
+    }
+}
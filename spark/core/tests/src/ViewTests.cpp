@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+
+#include "spark/core/GameObject.h"
+#include "spark/core/Scene.h"
+#include "spark/core/View.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace spark::core::testing
+{
+    /**
+     * \brief A component holding a value, used to check which components a view yields.
+     */
+    class Health : public Component
+    {
+        DECLARE_SPARK_RTTI(Health, Component)
+
+    public:
+        explicit Health(GameObject* parent, const int value = 0)
+            : Component(parent), value(value) {}
+
+        int value;
+    };
+
+    /**
+     * \brief A component derived from \ref Health, which has its own pool.
+     */
+    class Shield final : public Health
+    {
+        DECLARE_SPARK_RTTI(Shield, Health)
+
+    public:
+        using Health::Health;
+    };
+
+    /**
+     * \brief A second component, required together with \ref Health by some views.
+     */
+    class Speed final : public Component
+    {
+        DECLARE_SPARK_RTTI(Speed, Component)
+
+    public:
+        explicit Speed(GameObject* parent)
+            : Component(parent) {}
+    };
+}
+
+IMPLEMENT_SPARK_RTTI(spark::core::testing::Health)
+IMPLEMENT_SPARK_RTTI(spark::core::testing::Shield)
+IMPLEMENT_SPARK_RTTI(spark::core::testing::Speed)
+
+namespace spark::core::testing
+{
+    /**
+     * \brief Gets the names of the GameObjects yielded by a view.
+     * \tparam T The types of the components of the view.
+     * \param scene The scene to look into.
+     * \return The sorted names of the GameObjects found.
+     */
+    template <typename... T>
+    std::vector<std::string> viewNames(const Scene& scene)
+    {
+        std::vector<std::string> names;
+        for (const auto& components : scene.view<T...>())
+            names.push_back(std::get<0>(components).gameObject()->name());
+        std::ranges::sort(names);
+        return names;
+    }
+
+    TEST(ViewShould, onlyYieldTheObjectsHavingAllItsComponents)
+    {
+        // Given a scene where some objects have a Health, a Speed or both
+        auto* root = new GameObject("root");
+        (new GameObject("health", root))->addComponent<Health>(1);
+        (new GameObject("speed", root))->addComponent<Speed>();
+        auto* both = new GameObject("both", root);
+        both->addComponent<Health>(2);
+        both->addComponent<Speed>();
+        Scene scene(root);
+
+        // When viewing the Health components, alone or with a Speed
+        const auto healths = viewNames<Health>(scene);
+        const auto moving = viewNames<Health, Speed>(scene);
+
+        // Then, only the objects having all the components of the view are yielded, with their components
+        EXPECT_EQ(healths, (std::vector<std::string> {"both", "health"}));
+        EXPECT_EQ(moving, (std::vector<std::string> {"both"}));
+        int values = 0;
+        scene.view<Health, Speed>().each([&values](const Health& health, const Speed&) { values += health.value; });
+        EXPECT_EQ(values, 2);
+    }
+
+    TEST(ViewShould, matchTheExactTypeOfTheComponents)
+    {
+        // Given a scene where an object has a Health, and another one a Shield derived from Health
+        auto* root = new GameObject("root");
+        (new GameObject("health", root))->addComponent<Health>();
+        (new GameObject("shield", root))->addComponent<Shield>();
+        Scene scene(root);
+
+        // When viewing the Health and the Shield components
+        const auto healths = viewNames<Health>(scene);
+        const auto shields = viewNames<Shield>(scene);
+
+        // Then, each view only yields the components of its exact type
+        EXPECT_EQ(healths, (std::vector<std::string> {"health"}));
+        EXPECT_EQ(shields, (std::vector<std::string> {"shield"}));
+    }
+
+    TEST(ViewShould, notYieldTheRemovedComponents)
+    {
+        // Given a scene where two objects have a Health
+        auto* root = new GameObject("root");
+        auto* removed = new GameObject("removed", root);
+        removed->addComponent<Health>();
+        (new GameObject("kept", root))->addComponent<Health>();
+        Scene scene(root);
+
+        // When removing the Health of one of them
+        removed->removeComponent<Health>();
+
+        // Then, the view only yields the other one, before and after the removed component is destroyed
+        EXPECT_EQ(viewNames<Health>(scene), (std::vector<std::string> {"kept"}));
+        details::GameObjectDeleter<GameObject>::DeleteMarkedObjects();
+        EXPECT_EQ(viewNames<Health>(scene), (std::vector<std::string> {"kept"}));
+        EXPECT_FALSE(removed->hasComponent<Health>());
+    }
+}
@@ -26,7 +26,6 @@ namespace
         {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 512},
         {VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 512}
     };
-    VkPipelineCache g_pipeline_cache = VK_NULL_HANDLE;
     VkDescriptorPool g_imgui_descriptor_pool = VK_NULL_HANDLE;
 }
 
@@ -64,10 +63,10 @@ namespace spark::imgui
             .Queue = vk_device.graphicsQueue().handle(),
             .DescriptorPool = g_imgui_descriptor_pool,
             .RenderPass = vk_render_pass.handle(),
-            .MinImageCount = 3,
-            .ImageCount = 3,
+            .MinImageCount = vk_device.swapChain().buffers(),
+            .ImageCount = vk_device.swapChain().buffers(),
             .MSAASamples = VK_SAMPLE_COUNT_1_BIT,
-            .PipelineCache = g_pipeline_cache,
+            .PipelineCache = vk_device.pipelineCache(),
             .Subpass = 0,
             .Allocator = nullptr,
             .CheckVkResultFn = nullptr
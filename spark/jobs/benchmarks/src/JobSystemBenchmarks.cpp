@@ -0,0 +1,79 @@
+#include "spark/jobs/JobSystem.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace spark::jobs::benchmarks
+{
+    // The benchmarks take the total number of threads as argument: the calling thread plus (threads - 1) workers.
+
+    /// A compute-bound parallel for, similar to updating many independent objects.
+    static void BM_ParallelForCompute(benchmark::State& state)
+    {
+        JobSystem system(static_cast<std::size_t>(state.range(0)) - 1);
+        std::vector<float> values(1 << 16, 1.f);
+
+        for (auto _ : state)
+        {
+            parallel_for(system, 0, values.size(), [&values](const std::size_t i)
+            {
+                float value = values[i];
+                for (int j = 0; j < 64; ++j)
+                    value = std::sqrt(value * 1.0001f + 0.5f);
+                values[i] = value;
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+    }
+
+    BENCHMARK(BM_ParallelForCompute)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+    /// Many tiny jobs, measuring the overhead of the scheduler itself.
+    static void BM_SubmitSmallJobs(benchmark::State& state)
+    {
+        JobSystem system(static_cast<std::size_t>(state.range(0)) - 1);
+
+        for (auto _ : state)
+        {
+            Counter counter;
+            for (int i = 0; i < 1024; ++i)
+                system.submit([] { benchmark::DoNotOptimize(0); }, &counter);
+            system.wait(counter);
+        }
+        state.SetItemsProcessed(state.iterations() * 1024);
+    }
+
+    BENCHMARK(BM_SubmitSmallJobs)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+    /// Chains of dependent jobs, measuring the cost of the dependency counters.
+    static void BM_DependencyChains(benchmark::State& state)
+    {
+        JobSystem system(static_cast<std::size_t>(state.range(0)) - 1);
+        constexpr std::size_t chain_count = 16, chain_length = 32;
+
+        for (auto _ : state)
+        {
+            std::vector<Counter> counters(chain_count * chain_length);
+            Counter done;
+            for (std::size_t chain = 0; chain < chain_count; ++chain)
+            {
+                Counter* previous = &counters[chain * chain_length];
+                system.submit([] {}, previous);
+                for (std::size_t link = 1; link < chain_length; ++link)
+                {
+                    Counter* current = &counters[chain * chain_length + link];
+                    system.submitAfter(*previous, [] {}, link + 1 == chain_length ? &done : current);
+                    previous = current;
+                }
+            }
+            system.wait(done);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(chain_count * chain_length));
+    }
+
+    BENCHMARK(BM_DependencyChains)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
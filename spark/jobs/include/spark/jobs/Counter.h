@@ -0,0 +1,80 @@
+#pragma once
+
+#include "spark/jobs/Export.h"
+#include "spark/jobs/details/Task.h"
+
+#include "spark/base/Macros.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace spark::jobs
+{
+    class JobSystem;
+
+    /**
+     * \brief A counter tracking the completion of a group of jobs.
+     *
+     * Each job submitted with a counter increments it, and decrements it once finished. A counter reaching zero means all its jobs are done.
+     * Counters are also used to express dependencies between jobs: a job submitted after a counter is only started once the counter reached zero.
+     */
+    class SPARK_JOBS_EXPORT Counter final
+    {
+        friend class JobSystem;
+
+    public:
+        explicit Counter() = default;
+        ~Counter();
+
+        Counter(const Counter& other) = delete;
+        Counter(Counter&& other) noexcept = delete;
+        Counter& operator=(const Counter& other) = delete;
+        Counter& operator=(Counter&& other) noexcept = delete;
+
+        /**
+         * \brief Gets the number of jobs not finished yet.
+         * \return The current value of the counter.
+         */
+        [[nodiscard]] std::size_t value() const;
+
+        /**
+         * \brief Checks if all the jobs of the counter are finished.
+         * \return `true` if the counter is zero, `false` otherwise.
+         */
+        [[nodiscard]] bool isDone() const;
+
+    private:
+        /**
+         * \brief Adds pending jobs to the counter.
+         * \param count The number of jobs to add.
+         */
+        void increment(std::size_t count);
+
+        /**
+         * \brief Marks a job of the counter as finished.
+         * \param continuations Receives the tasks waiting for the counter if it reached zero.
+         * \return `true` if the counter reached zero, `false` otherwise.
+         */
+        [[nodiscard]] bool decrement(std::vector<details::Task>& continuations);
+
+        /**
+         * \brief Registers a task to start once the counter reaches zero.
+         * \param task The task to register.
+         * \return `true` if the task was registered, `false` if the counter is already zero and the task can be started now.
+         */
+        [[nodiscard]] bool addContinuation(details::Task& task);
+
+    private:
+        std::atomic<std::size_t> m_value = 0;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::jobs::Counter'
+
+        std::mutex m_mutex;
+        std::vector<details::Task> m_continuations;
+
+        SPARK_WARNING_POP
+    };
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "spark/jobs/Counter.h"
+#include "spark/jobs/Export.h"
+#include "spark/jobs/details/Task.h"
+#include "spark/jobs/details/WorkStealingQueue.h"
+
+#include "spark/base/Macros.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace spark::jobs
+{
+    /**
+     * \brief A fixed pool of worker threads executing jobs.
+     *
+     * Each worker owns a queue of jobs. Jobs submitted from a worker are pushed to its own queue, jobs submitted from other threads are spread
+     * across all the queues. A worker without jobs steals them from the other queues, and sleeps when there is no job left at all.
+     *
+     * The thread waiting for a \ref Counter also executes jobs until the counter is done, so a job system with no worker still works (everything
+     * runs on the waiting thread).
+     */
+    class SPARK_JOBS_EXPORT JobSystem final
+    {
+    public:
+        /**
+         * \brief Gets a default number of workers for the current machine.
+         * \return The number of hardware threads minus one (for the main thread), or at least one.
+         */
+        [[nodiscard]] static std::size_t DefaultWorkerCount();
+
+    public:
+        /**
+         * \brief Instantiates a new job system and starts its worker threads.
+         * \param worker_count The number of worker threads to start.
+         */
+        explicit JobSystem(std::size_t worker_count = DefaultWorkerCount());
+        ~JobSystem();
+
+        JobSystem(const JobSystem& other) = delete;
+        JobSystem(JobSystem&& other) noexcept = delete;
+        JobSystem& operator=(const JobSystem& other) = delete;
+        JobSystem& operator=(JobSystem&& other) noexcept = delete;
+
+        /**
+         * \brief Gets the number of worker threads.
+         * \return The number of worker threads of the job system.
+         */
+        [[nodiscard]] std::size_t workerCount() const;
+
+        /**
+         * \brief Submits a job to be executed by a worker.
+         * \param job The job to execute.
+         * \param counter A counter incremented now and decremented once the job is finished. Can be nullptr.
+         */
+        void submit(Job job, Counter* counter = nullptr);
+
+        /**
+         * \brief Submits a job to be executed once all the jobs of \p dependency are finished.
+         * \param dependency The counter to wait for before starting the job.
+         * \param job The job to execute.
+         * \param counter A counter incremented now and decremented once the job is finished. Can be nullptr.
+         */
+        void submitAfter(Counter& dependency, Job job, Counter* counter = nullptr);
+
+        /**
+         * \brief Waits until all the jobs of \p counter are finished, executing other jobs in the meantime.
+         * \param counter The counter to wait for.
+         *
+         * When there is no job left to execute, the calling thread sleeps until a job is scheduled or a counter is done, instead of spinning.
+         */
+        void wait(const Counter& counter);
+
+    private:
+        /**
+         * \brief The main loop of a worker thread.
+         * \param index The index of the worker.
+         * \param stop_token The token requesting the worker to stop.
+         */
+        void workerLoop(std::size_t index, const std::stop_token& stop_token);
+
+        /**
+         * \brief Schedules a task in a queue.
+         * \param task The task to schedule.
+         */
+        void schedule(details::Task task);
+
+        /**
+         * \brief Finds a task to execute, first in the queue of the current worker then in the other queues.
+         * \return A task, or \ref std::nullopt if no task could be found.
+         */
+        [[nodiscard]] std::optional<details::Task> findTask();
+
+        /**
+         * \brief Executes a task and, if its counter reached zero, starts the tasks depending on it and wakes up the threads waiting for it.
+         * \param task The task to execute.
+         */
+        void execute(details::Task& task);
+
+    private:
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::jobs::JobSystem'
+
+        std::vector<std::unique_ptr<details::WorkStealingQueue>> m_queues;
+        std::vector<std::jthread> m_workers;
+
+        std::atomic<std::size_t> m_pendingTasks = 0;
+        std::atomic<std::size_t> m_nextQueue = 0;
+        std::mutex m_sleepMutex;
+        std::condition_variable_any m_wakeUp;
+
+        SPARK_WARNING_POP
+    };
+
+    /**
+     * \brief Calls \p fn for every index in [\p begin, \p end), splitting the range in chunks executed in parallel by \p system.
+     * \param system The job system executing the chunks.
+     * \param begin The first index of the range.
+     * \param end The index past the last one of the range.
+     * \param fn The function to call with each index.
+     * \param grain_size The number of indices per chunk. Default is 0, which splits the range in a few chunks per thread.
+     *
+     * The calling thread participates in the execution and the function returns once every index was processed.
+     */
+    template <typename Fn>
+    void parallel_for(JobSystem& system, std::size_t begin, std::size_t end, Fn&& fn, std::size_t grain_size = 0);
+}
+
+#include "spark/jobs/impl/JobSystem.h"
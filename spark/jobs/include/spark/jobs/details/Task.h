@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+
+namespace spark::jobs
+{
+    class Counter;
+
+    /**
+     * \brief A unit of work executed by the \ref JobSystem.
+     * \note A job must not throw, an exception escaping a job terminates the program.
+     */
+    using Job = std::function<void()>;
+}
+
+namespace spark::jobs::details
+{
+    /**
+     * \brief A job scheduled in the \ref JobSystem with the counter to decrement once it is finished.
+     */
+    struct Task
+    {
+        /// \brief The job to execute.
+        Job job;
+
+        /// \brief The counter to decrement once the job is finished. Can be nullptr.
+        Counter* counter = nullptr;
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "spark/jobs/details/Task.h"
+
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace spark::jobs::details
+{
+    /**
+     * \brief The queue of tasks of a worker thread.
+     *
+     * The owner pushes and pops tasks at the back (LIFO, to keep the data of the last submitted job hot in its cache), while the other threads steal
+     * tasks from the front (FIFO, to take the oldest, and usually biggest, pieces of work). Each operation only locks this queue, so threads only contend
+     * when they access the same queue.
+     */
+    class WorkStealingQueue final
+    {
+    public:
+        /**
+         * \brief Pushes a task at the back of the queue.
+         * \param task The task to push.
+         */
+        void push(Task task)
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+
+        /**
+         * \brief Pops the last pushed task. Should only be called by the owner of the queue.
+         * \return The task, or \ref std::nullopt if the queue is empty.
+         */
+        [[nodiscard]] std::optional<Task> pop()
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_tasks.empty())
+                return std::nullopt;
+
+            Task task = std::move(m_tasks.back());
+            m_tasks.pop_back();
+            return task;
+        }
+
+        /**
+         * \brief Steals the oldest task of the queue. Can be called from any thread.
+         * \return The task, or \ref std::nullopt if the queue is empty or already locked by another thread.
+         */
+        [[nodiscard]] std::optional<Task> steal()
+        {
+            std::unique_lock lock(m_mutex, std::try_to_lock);
+            if (!lock.owns_lock() || m_tasks.empty())
+                return std::nullopt;
+
+            Task task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            return task;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+}
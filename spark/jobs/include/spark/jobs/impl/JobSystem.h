@@ -0,0 +1,41 @@
+#pragma once
+
+#include <algorithm>
+
+namespace spark::jobs
+{
+    template <typename Fn>
+    void parallel_for(JobSystem& system, const std::size_t begin, const std::size_t end, Fn&& fn, std::size_t grain_size)
+    {
+        if (begin >= end)
+            return;
+
+        const std::size_t count = end - begin;
+        if (grain_size == 0)
+        {
+            // A few chunks per thread (including the calling one) lets fast threads steal the work of the slow ones
+            const std::size_t chunk_count = (system.workerCount() + 1) * 4;
+            grain_size = std::max<std::size_t>(1, (count + chunk_count - 1) / chunk_count);
+        }
+
+        // Run directly when there is a single chunk, to avoid the overhead of the job system
+        if (count <= grain_size)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                fn(i);
+            return;
+        }
+
+        Counter counter;
+        for (std::size_t chunk_begin = begin; chunk_begin < end; chunk_begin += grain_size)
+        {
+            const std::size_t chunk_end = std::min(end, chunk_begin + grain_size);
+            system.submit([&fn, chunk_begin, chunk_end]
+            {
+                for (std::size_t i = chunk_begin; i < chunk_end; ++i)
+                    fn(i);
+            }, &counter);
+        }
+        system.wait(counter);
+    }
+}
@@ -0,0 +1,46 @@
+#include "spark/jobs/Counter.h"
+
+#include <utility>
+
+namespace spark::jobs
+{
+    Counter::~Counter()
+    {
+        // Wait for a worker still finishing a decrement, the counter may be destroyed as soon as it reads zero
+        std::lock_guard lock(m_mutex);
+    }
+
+    std::size_t Counter::value() const
+    {
+        return m_value.load(std::memory_order_acquire);
+    }
+
+    bool Counter::isDone() const
+    {
+        return value() == 0;
+    }
+
+    void Counter::increment(const std::size_t count)
+    {
+        m_value.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    bool Counter::decrement(std::vector<details::Task>& continuations)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_value.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return false;
+        continuations = std::exchange(m_continuations, {});
+        return true;
+    }
+
+    bool Counter::addContinuation(details::Task& task)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_value.load(std::memory_order_acquire) == 0)
+            return false;
+
+        m_continuations.push_back(std::move(task));
+        return true;
+    }
+}
@@ -0,0 +1,154 @@
+#include "spark/jobs/JobSystem.h"
+
+#include <algorithm>
+
+namespace
+{
+    /// \brief The job system owning the current thread, nullptr if the thread is not a worker.
+    thread_local const spark::jobs::JobSystem* t_jobSystem = nullptr;
+
+    /// \brief The index of the current worker in its job system.
+    thread_local std::size_t t_workerIndex = 0;
+}
+
+namespace spark::jobs
+{
+    std::size_t JobSystem::DefaultWorkerCount()
+    {
+        const std::size_t hardware_threads = std::thread::hardware_concurrency();
+        return std::max<std::size_t>(1, hardware_threads > 1 ? hardware_threads - 1 : 1);
+    }
+
+    JobSystem::JobSystem(const std::size_t worker_count)
+    {
+        // There is always one queue, used by the threads outside the job system when there are no workers
+        m_queues.resize(std::max<std::size_t>(1, worker_count));
+        for (auto& queue : m_queues)
+            queue = std::make_unique<details::WorkStealingQueue>();
+
+        m_workers.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i)
+            m_workers.emplace_back([this, i](const std::stop_token& stop_token) { workerLoop(i, stop_token); });
+    }
+
+    JobSystem::~JobSystem()
+    {
+        for (auto& worker : m_workers)
+            worker.request_stop();
+        m_workers.clear();
+    }
+
+    std::size_t JobSystem::workerCount() const
+    {
+        return m_workers.size();
+    }
+
+    void JobSystem::submit(Job job, Counter* counter)
+    {
+        if (counter)
+            counter->increment(1);
+        schedule({.job = std::move(job), .counter = counter});
+    }
+
+    void JobSystem::submitAfter(Counter& dependency, Job job, Counter* counter)
+    {
+        if (counter)
+            counter->increment(1);
+
+        details::Task task = {.job = std::move(job), .counter = counter};
+        if (!dependency.addContinuation(task))
+            schedule(std::move(task));
+    }
+
+    void JobSystem::wait(const Counter& counter)
+    {
+        while (!counter.isDone())
+        {
+            if (auto task = findTask())
+            {
+                execute(*task);
+                continue;
+            }
+
+            // Sleep like the workers until a job is scheduled, which this thread can help with, or until a counter is done
+            std::unique_lock lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this, &counter] { return counter.isDone() || m_pendingTasks.load(std::memory_order_acquire) > 0; });
+        }
+    }
+
+    void JobSystem::workerLoop(const std::size_t index, const std::stop_token& stop_token)
+    {
+        t_jobSystem = this;
+        t_workerIndex = index;
+
+        while (!stop_token.stop_requested())
+        {
+            if (auto task = findTask())
+            {
+                execute(*task);
+                continue;
+            }
+
+            std::unique_lock lock(m_sleepMutex);
+            m_wakeUp.wait(lock, stop_token, [this] { return m_pendingTasks.load(std::memory_order_acquire) > 0; });
+        }
+    }
+
+    void JobSystem::schedule(details::Task task)
+    {
+        const std::size_t queue = t_jobSystem == this ? t_workerIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+        // Count the task before pushing it, so it can never be popped before being counted
+        m_pendingTasks.fetch_add(1, std::memory_order_release);
+        m_queues[queue]->push(std::move(task));
+
+        // Lock the mutex to not lose the notification if a worker is checking the pending tasks right before sleeping
+        {
+            std::lock_guard lock(m_sleepMutex);
+        }
+        m_wakeUp.notify_one();
+    }
+
+    std::optional<details::Task> JobSystem::findTask()
+    {
+        std::size_t first_victim = 0;
+        if (t_jobSystem == this)
+        {
+            if (auto task = m_queues[t_workerIndex]->pop())
+            {
+                m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+            first_victim = t_workerIndex + 1;
+        }
+
+        for (std::size_t i = 0; i < m_queues.size(); ++i)
+        {
+            if (auto task = m_queues[(first_victim + i) % m_queues.size()]->steal())
+            {
+                m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void JobSystem::execute(details::Task& task)
+    {
+        task.job();
+
+        // The counter may be destroyed by its waiter as soon as it is done, so it is not read after being decremented
+        std::vector<details::Task> continuations;
+        if (!task.counter || !task.counter->decrement(continuations))
+            return;
+
+        for (auto& continuation : continuations)
+            schedule(std::move(continuation));
+
+        // Wake up the threads waiting for the counter, with the lock so that a thread checking the counter right before sleeping gets the notification
+        {
+            std::lock_guard lock(m_sleepMutex);
+        }
+        m_wakeUp.notify_all();
+    }
+}
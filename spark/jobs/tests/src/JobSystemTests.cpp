@@ -0,0 +1,158 @@
+#include "spark/jobs/JobSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+
+namespace spark::jobs::testing
+{
+    TEST(JobSystemShould, executeSubmittedJobs)
+    {
+        // Given a job system with some workers
+        JobSystem system(4);
+        std::atomic<int> executed = 0;
+        Counter counter;
+
+        // When submitting many jobs and waiting for them
+        for (int i = 0; i < 1000; ++i)
+            system.submit([&executed] { ++executed; }, &counter);
+        system.wait(counter);
+
+        // Then, all the jobs were executed
+        EXPECT_EQ(executed, 1000);
+        EXPECT_TRUE(counter.isDone());
+    }
+
+    TEST(JobSystemShould, executeJobsWithoutWorkers)
+    {
+        // Given a job system without workers
+        JobSystem system(0);
+        int executed = 0;
+        Counter counter;
+
+        // When submitting jobs and waiting for them
+        for (int i = 0; i < 10; ++i)
+            system.submit([&executed] { ++executed; }, &counter);
+        system.wait(counter);
+
+        // Then, the jobs were executed by the waiting thread
+        EXPECT_EQ(system.workerCount(), 0);
+        EXPECT_EQ(executed, 10);
+    }
+
+    TEST(JobSystemShould, executeJobsOnWorkerThreads)
+    {
+        // Given a job system with workers
+        JobSystem system(2);
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+        Counter counter;
+
+        // When submitting jobs from the main thread without waiting on it
+        for (int i = 0; i < 10; ++i)
+            system.submit([&]
+            {
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }, &counter);
+        while (!counter.isDone())
+            std::this_thread::yield();
+
+        // Then, the jobs were executed by the workers
+        EXPECT_FALSE(threads.empty());
+        EXPECT_FALSE(threads.contains(std::this_thread::get_id()));
+    }
+
+    TEST(JobSystemShould, startJobsAfterTheirDependency)
+    {
+        // Given a first group of jobs and a job depending on it
+        JobSystem system(4);
+        std::atomic<int> first_group = 0;
+        int seen_by_dependent = -1;
+        Counter first_counter, dependent_counter;
+
+        for (int i = 0; i < 100; ++i)
+            system.submit([&first_group]
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                ++first_group;
+            }, &first_counter);
+
+        // When submitting the dependent job and waiting for it
+        system.submitAfter(first_counter, [&] { seen_by_dependent = first_group; }, &dependent_counter);
+        system.wait(dependent_counter);
+
+        // Then, the dependent job started after all the jobs of the first group
+        EXPECT_EQ(seen_by_dependent, 100);
+    }
+
+    TEST(JobSystemShould, startJobsImmediatelyWhenTheirDependencyIsDone)
+    {
+        // Given a counter without pending jobs
+        JobSystem system(1);
+        Counter done, counter;
+        bool executed = false;
+
+        // When submitting a job depending on it
+        system.submitAfter(done, [&executed] { executed = true; }, &counter);
+        system.wait(counter);
+
+        // Then, the job is executed
+        EXPECT_TRUE(executed);
+    }
+
+    TEST(JobSystemShould, supportJobsSubmittingAndWaitingForJobs)
+    {
+        // Given a job system
+        JobSystem system(2);
+        std::atomic<int> executed = 0;
+        Counter counter;
+
+        // When jobs submit other jobs and wait for them
+        for (int i = 0; i < 8; ++i)
+            system.submit([&]
+            {
+                Counter nested;
+                for (int j = 0; j < 8; ++j)
+                    system.submit([&executed] { ++executed; }, &nested);
+                system.wait(nested);
+            }, &counter);
+        system.wait(counter);
+
+        // Then, all the jobs are executed without deadlock
+        EXPECT_EQ(executed, 64);
+    }
+
+    TEST(JobSystemShould, wakeUpTheWaitingThreadWhenTheJobsRunningOnWorkersAreDone)
+    {
+        // Given a job started by a worker and still running, so that the waiting thread has nothing to execute
+        JobSystem system(1);
+        std::atomic<bool> started = false, release = false;
+        Counter counter;
+        system.submit([&]
+        {
+            started = true;
+            while (!release)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }, &counter);
+        while (!started)
+            std::this_thread::yield();
+
+        // When waiting for it while another thread lets it finish later, then submits jobs the waiting thread can help with
+        std::jthread releaser([&]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            Counter other;
+            system.submit([] {}, &other);
+            release = true;
+            system.wait(other);
+        });
+        system.wait(counter);
+
+        // Then, the waiting thread is woken up once the job is done
+        EXPECT_TRUE(counter.isDone());
+    }
+}
@@ -0,0 +1,50 @@
+#include "spark/jobs/JobSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+namespace spark::jobs::testing
+{
+    TEST(ParallelForShould, visitEachIndexOnce)
+    {
+        // Given a job system and a range of indices
+        JobSystem system(4);
+        std::vector<std::atomic<int>> visits(10'000);
+
+        // When running a parallel for over the range
+        parallel_for(system, 0, visits.size(), [&visits](const std::size_t i) { ++visits[i]; });
+
+        // Then, each index was visited exactly once
+        for (const auto& visit : visits)
+            EXPECT_EQ(visit, 1);
+    }
+
+    TEST(ParallelForShould, respectTheRangeBounds)
+    {
+        // Given a job system
+        JobSystem system(2);
+        std::vector<int> values(100, 0);
+
+        // When running a parallel for over a sub-range with a custom grain size
+        parallel_for(system, 10, 90, [&values](const std::size_t i) { values[i] = 1; }, 7);
+
+        // Then, only the indices of the sub-range were visited
+        for (std::size_t i = 0; i < values.size(); ++i)
+            EXPECT_EQ(values[i], i >= 10 && i < 90 ? 1 : 0);
+    }
+
+    TEST(ParallelForShould, doNothingOnAnEmptyRange)
+    {
+        // Given a job system
+        JobSystem system(2);
+        bool called = false;
+
+        // When running a parallel for over an empty range
+        parallel_for(system, 5, 5, [&called](std::size_t) { called = true; });
+
+        // Then, the function was never called
+        EXPECT_FALSE(called);
+    }
+}
@@ -19,16 +19,52 @@ namespace spark::patterns
 
         [[nodiscard]] std::vector<DerivedType*> children() const;
 
+        /**
+         * \brief Gets the number of direct children of the node, without copying them.
+         * \return The number of children.
+         */
+        [[nodiscard]] std::size_t childCount() const;
+
+        /**
+         * \brief Gets a direct child of the node, without copying the children list.
+         * \param index The index of the child, lower than \ref childCount.
+         * \return A pointer to the child at \p index.
+         */
+        [[nodiscard]] DerivedType* child(std::size_t index) const;
+
         [[nodiscard]] DerivedType* parent();
         [[nodiscard]] const DerivedType* parent() const;
 
         [[nodiscard]] DerivedType* root();
         [[nodiscard]] const DerivedType* root() const;
 
+        /**
+         * \brief Moves the node and its children under another parent.
+         * \param parent The new parent of the node, or nullptr to make it a root.
+         *
+         * \throws base::BadArgumentException If \p parent is the node itself or one of its descendants.
+         */
+        void setParent(DerivedType* parent);
+
+    protected:
+        /**
+         * \brief Method called when a child is added to or removed from this node.
+         *
+         * \note This is not called for the children destroyed by the destructor of this node.
+         */
+        virtual void onChildrenChanged() {}
+
+        /**
+         * \brief Method called when the node was moved under another parent by \ref setParent.
+         * \param old_parent The previous parent of the node, or nullptr if it was a root.
+         *
+         * \note This is not called when the node is constructed.
+         */
+        virtual void onParentChanged(DerivedType* old_parent) { static_cast<void>(old_parent); }
+
     private:
         void add(DerivedType* child);
         void remove(DerivedType* child);
-        void setParent(DerivedType* parent);
 
     private:
         DerivedType* m_parent = nullptr;
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "spark/patterns/Export.h"
+
+#include "spark/base/Macros.h"
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace spark::patterns
+{
+    namespace details
+    {
+        /**
+         * \brief The type used to store an argument of type \p T until a deferred call is executed.
+         *
+         * Arguments are copied, except mutable lvalue references (the callee expects to modify the original object) and non-copyable objects,
+         * which are stored by reference. The referenced objects must then outlive the deferred call.
+         */
+        template <typename T>
+        using deferred_argument_t = std::conditional_t<std::is_lvalue_reference_v<T>
+                                                       && (!std::is_const_v<std::remove_reference_t<T>> || !std::is_copy_constructible_v<std::remove_cvref_t<T>>),
+                                                       std::reference_wrapper<std::remove_reference_t<T>>,
+                                                       std::remove_cvref_t<T>>;
+    }
+
+    /**
+     * \brief A thread-safe queue of calls postponed until a synchronization point.
+     *
+     * A \ref DeferredCalls::Scope makes a queue the current one for the calling thread. Code supporting deferral (like \ref Signal::emit) checks
+     * \ref DeferredCalls::Current and pushes itself in the queue instead of running immediately.
+     * When flushed, the calls are executed on the calling thread, sorted by the order of the scope that pushed them. This makes the result
+     * independent of the threads that pushed the calls.
+     */
+    class SPARK_PATTERNS_EXPORT DeferredCalls final
+    {
+    public:
+        /**
+         * \brief Makes a \ref DeferredCalls the current queue of the calling thread during its lifetime.
+         */
+        class SPARK_PATTERNS_EXPORT Scope final
+        {
+        public:
+            /**
+             * \brief Makes \p calls the current queue of the calling thread.
+             * \param calls The queue receiving the calls pushed by this thread.
+             * \param order The order of the calls pushed within the scope. Calls with a lower order are executed first when flushed.
+             */
+            explicit Scope(DeferredCalls& calls, std::size_t order = 0);
+            ~Scope();
+
+            Scope(const Scope& other) = delete;
+            Scope(Scope&& other) noexcept = delete;
+            Scope& operator=(const Scope& other) = delete;
+            Scope& operator=(Scope&& other) noexcept = delete;
+
+        private:
+            DeferredCalls* m_previousCalls = nullptr;
+            std::size_t m_previousOrder = 0;
+        };
+
+    public:
+        /**
+         * \brief Gets the current queue of the calling thread.
+         * \return A pointer to the queue of the innermost active \ref Scope on this thread, or `nullptr` if calls must run immediately.
+         */
+        [[nodiscard]] static DeferredCalls* Current();
+
+        explicit DeferredCalls() = default;
+        ~DeferredCalls() = default;
+
+        DeferredCalls(const DeferredCalls& other) = delete;
+        DeferredCalls(DeferredCalls&& other) noexcept = delete;
+        DeferredCalls& operator=(const DeferredCalls& other) = delete;
+        DeferredCalls& operator=(DeferredCalls&& other) noexcept = delete;
+
+        /**
+         * \brief Adds a call to the queue. Can be called from any thread.
+         * \param call The function to call when the queue is flushed.
+         */
+        void push(std::function<void()> call);
+
+        /**
+         * \brief Executes all the queued calls on the calling thread, then empties the queue.
+         *
+         * Calls pushed while flushing (by a flushed call running in a scope of this queue) are executed in the same flush.
+         */
+        void flush();
+
+        /**
+         * \brief Checks if there is no call waiting in the queue.
+         * \return `true` if the queue is empty, `false` otherwise.
+         */
+        [[nodiscard]] bool empty() const;
+
+    private:
+        struct Call
+        {
+            std::size_t order = 0;
+            std::function<void()> function;
+        };
+
+    private:
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::patterns::DeferredCalls'
+
+        mutable std::mutex m_mutex;
+        std::vector<Call> m_calls;
+
+        SPARK_WARNING_POP
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "spark/patterns/DeferredCalls.h"
 #include "spark/patterns/details/Connection.h"
 
 #include <functional>
@@ -106,6 +107,9 @@ namespace spark::patterns
          * \brief Emits the signal to all connected slots.
          * \tparam FnArgs The types of the arguments to emit. Must be convertible to the signal arguments.
          * \param args The arguments for the slots.
+         *
+         * \note If a \ref DeferredCalls::Scope is active on the calling thread, the emission is queued and the slots are only called when the queue
+         * is flushed. The arguments are stored as described in \ref details::deferred_argument_t, and the signal must outlive the flush.
          */
         template <typename... FnArgs>
         void emit(FnArgs&&... args) const;
@@ -131,6 +135,13 @@ namespace spark::patterns
          */
         void move(Signal* signal);
 
+        /**
+         * \brief Calls all connected slots with \p args. Used by \ref emit, once it is known the emission is not deferred.
+         * \param args The arguments for the slots.
+         */
+        template <typename... FnArgs>
+        void call(FnArgs&&... args) const;
+
     private:
         std::map<std::size_t, details::Connection<Args...>> m_connections;
         std::size_t m_sequence = 0;
@@ -28,7 +28,7 @@ namespace spark::patterns::details
         {
             for (auto* child : container->children())
             {
-                if (!child->children().empty())
+                if (child->childCount() != 0)
                 {
                     auto* sub_container = static_cast<std::conditional_t<std::is_const_v<NodeType>, const NodeType, NodeType>*>(child);
                     traverser.pre(child, std::forward<FnArgsTypes>(args)...);
@@ -17,8 +17,14 @@ namespace spark::patterns
             m_parent->remove(static_cast<DerivedType*>(this));
         m_parent = nullptr;
 
-        for (std::size_t i = 0; i < m_children.size(); ++i)
-            Deleter<DerivedType>()(m_children[i]);
+        // Detach the children first, so they do not remove themselves from the list while it is iterated
+        const std::vector<DerivedType*> children = std::move(m_children);
+        m_children.clear();
+        for (auto* child : children)
+        {
+            static_cast<Composite*>(child)->m_parent = nullptr;
+            Deleter<DerivedType>()(child);
+        }
     }
 
     template <typename DerivedType, template<typename> typename Deleter>
@@ -57,6 +63,18 @@ namespace spark::patterns
         return m_children;
     }
 
+    template <typename DerivedType, template<typename> typename Deleter>
+    std::size_t Composite<DerivedType, Deleter>::childCount() const
+    {
+        return m_children.size();
+    }
+
+    template <typename DerivedType, template<typename> typename Deleter>
+    DerivedType* Composite<DerivedType, Deleter>::child(const std::size_t index) const
+    {
+        return m_children[index];
+    }
+
     template <typename DerivedType, template<typename> typename Deleter>
     void Composite<DerivedType, Deleter>::add(DerivedType* child)
     {
@@ -64,6 +82,7 @@ namespace spark::patterns
         if (it != m_children.end())
             throw spark::base::BadArgumentException("Child already exists in the children list!");
         m_children.push_back(child);
+        onChildrenChanged();
     }
 
     template <typename DerivedType, template<typename> typename Deleter>
@@ -73,12 +92,22 @@ namespace spark::patterns
         if (it == m_children.end())
             throw spark::base::BadArgumentException("Child could not be found in the children list!");
         m_children.erase(it);
+        onChildrenChanged();
     }
 
     template <typename DerivedType, template<typename> typename Deleter>
     void Composite<DerivedType, Deleter>::setParent(DerivedType* parent)
     {
+        if (parent == m_parent)
+            return;
+
+        // A node cannot be moved under itself, it would create a cycle
+        for (const Composite* node = parent; node != nullptr; node = node->m_parent)
+            if (node == this)
+                throw spark::base::BadArgumentException("Unable to move a node under itself or one of its children!");
+
         // Remove from old parent if it not nullptr
+        DerivedType* old_parent = m_parent;
         if (m_parent)
             m_parent->remove(static_cast<DerivedType*>(this));
 
@@ -88,5 +117,7 @@ namespace spark::patterns
         // Add this child to the new parent il it is not nullptr
         if (m_parent)
             m_parent->add(static_cast<DerivedType*>(this));
+
+        onParentChanged(old_parent);
     }
 }
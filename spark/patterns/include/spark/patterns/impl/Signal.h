@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <ranges>
+#include <tuple>
 
 namespace spark::patterns
 {
@@ -147,6 +148,22 @@ namespace spark::patterns
                                               typename mpl::typelist<Args...>::template transform<std::remove_cvref>>,
                           "Cannot call Signal::emit() with args that are not in the signal.");
 
+        if (DeferredCalls* deferred_calls = DeferredCalls::Current())
+        {
+            deferred_calls->push([this, arguments = std::tuple<details::deferred_argument_t<Args>...>(std::forward<FnArgs>(args)...)]() mutable
+            {
+                std::apply([this](auto&... arguments) { call(static_cast<Args>(arguments)...); }, arguments);
+            });
+            return;
+        }
+
+        call(std::forward<FnArgs>(args)...);
+    }
+
+    template <typename... Args>
+    template <typename... FnArgs>
+    void Signal<Args...>::call(FnArgs&&... args) const
+    {
         /*
          * When emitting, we need to make sure that:
          * - the program does not crash if a slot is destroyed during the emit
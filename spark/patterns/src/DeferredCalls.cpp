@@ -0,0 +1,67 @@
+#include "spark/patterns/DeferredCalls.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    thread_local spark::patterns::DeferredCalls* t_current = nullptr;
+    thread_local std::size_t t_order = 0;
+}
+
+namespace spark::patterns
+{
+    DeferredCalls::Scope::Scope(DeferredCalls& calls, const std::size_t order)
+        : m_previousCalls(t_current), m_previousOrder(t_order)
+    {
+        t_current = &calls;
+        t_order = order;
+    }
+
+    DeferredCalls::Scope::~Scope()
+    {
+        t_current = m_previousCalls;
+        t_order = m_previousOrder;
+    }
+
+    DeferredCalls* DeferredCalls::Current()
+    {
+        return t_current;
+    }
+
+    void DeferredCalls::push(std::function<void()> call)
+    {
+        std::lock_guard lock(m_mutex);
+        m_calls.push_back({.order = t_order, .function = std::move(call)});
+    }
+
+    void DeferredCalls::flush()
+    {
+        std::vector<Call> calls;
+        while (true)
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_calls.empty())
+                {
+                    // Give the storage back to the queue, to avoid reallocating it on the next frame
+                    std::swap(m_calls, calls);
+                    return;
+                }
+                std::swap(m_calls, calls);
+            }
+
+            // A stable sort keeps the calls pushed by the same scope in their original order
+            std::ranges::stable_sort(calls, {}, &Call::order);
+            for (const Call& call : calls)
+                call.function();
+            calls.clear();
+        }
+    }
+
+    bool DeferredCalls::empty() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_calls.empty();
+    }
+}
@@ -2,6 +2,8 @@
 
 #include "spark/patterns/Composite.h"
 
+#include "spark/base/Exception.h"
+
 namespace spark::patterns::testing
 {
     class Node final : public Composite<Node>
@@ -68,6 +70,61 @@ namespace spark::patterns::testing
         EXPECT_EQ(dtor_delete_count, 2);
     }
 
+    TEST(CompositeShould, deleteAllChildrenWhenParentIsDeleted)
+    {
+        // Given a tree with multiple children at the same level
+        int dtor_delete_count = 0;
+
+        auto* root = new NodeWithDeleter(dtor_delete_count);
+        auto* a1 = new NodeWithDeleter(dtor_delete_count, {}, root);
+        new NodeWithDeleter(dtor_delete_count, {}, root);
+        new NodeWithDeleter(dtor_delete_count, {}, root);
+        new NodeWithDeleter(dtor_delete_count, {}, a1);
+
+        // When deleting the root node
+        delete root;
+
+        // Then, all the children are deleted
+        EXPECT_EQ(dtor_delete_count, 5);
+    }
+
+    TEST(CompositeShould, accessChildrenWithoutCopy)
+    {
+        // Given a node with two children
+        Node root;
+        Node a1(&root), a2(&root);
+
+        // When accessing the children by index
+        const std::size_t count = root.childCount();
+
+        // Then, they are in insertion order
+        EXPECT_EQ(count, 2);
+        EXPECT_EQ(root.child(0), &a1);
+        EXPECT_EQ(root.child(1), &a2);
+    }
+
+    TEST(CompositeShould, moveANodeUnderAnotherParent)
+    {
+        // Given a tree with a node under a1
+        Node root;
+        Node a1(&root), a2(&root);
+        Node b(&a1);
+
+        // When moving the node under a2
+        b.setParent(&a2);
+
+        // Then, it is only a child of a2
+        EXPECT_EQ(b.parent(), &a2);
+        EXPECT_EQ(a1.childCount(), 0);
+        ASSERT_EQ(a2.childCount(), 1);
+        EXPECT_EQ(a2.child(0), &b);
+
+        // And it cannot be moved under itself or one of its children
+        EXPECT_THROW(b.setParent(&b), spark::base::BadArgumentException);
+        EXPECT_THROW(a2.setParent(&b), spark::base::BadArgumentException);
+        EXPECT_EQ(a2.parent(), &root);
+    }
+
     TEST(CompositeShould, useGivenDeleter)
     {
         // Given a simple tree with a deleter count and a function
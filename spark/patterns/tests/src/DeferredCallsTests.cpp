@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include "spark/patterns/DeferredCalls.h"
+#include "spark/patterns/Signal.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace spark::patterns::testing
+{
+    TEST(DeferredCallsShould, haveNoCurrentQueueOutsideOfAScope)
+    {
+        // Given no active scope
+        // Then, there is no current queue
+        EXPECT_EQ(DeferredCalls::Current(), nullptr);
+    }
+
+    TEST(DeferredCallsShould, restorePreviousQueueWhenScopeEnds)
+    {
+        // Given two queues
+        DeferredCalls first, second;
+
+        // When nesting scopes
+        {
+            DeferredCalls::Scope first_scope(first);
+            EXPECT_EQ(DeferredCalls::Current(), &first);
+            {
+                DeferredCalls::Scope second_scope(second);
+                EXPECT_EQ(DeferredCalls::Current(), &second);
+            }
+
+            // Then, the outer queue is current again
+            EXPECT_EQ(DeferredCalls::Current(), &first);
+        }
+        EXPECT_EQ(DeferredCalls::Current(), nullptr);
+    }
+
+    TEST(DeferredCallsShould, executeCallsOnlyWhenFlushed)
+    {
+        // Given a queue with a call
+        DeferredCalls calls;
+        int value = 0;
+        calls.push([&value] { ++value; });
+
+        // Then, the call is not executed until the queue is flushed
+        EXPECT_EQ(value, 0);
+        EXPECT_FALSE(calls.empty());
+
+        calls.flush();
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(calls.empty());
+    }
+
+    TEST(DeferredCallsShould, executeCallsSortedByScopeOrder)
+    {
+        // Given calls pushed from scopes in reverse order
+        DeferredCalls calls;
+        std::vector<int> result;
+        for (int i = 3; i >= 0; --i)
+        {
+            DeferredCalls::Scope scope(calls, static_cast<std::size_t>(i));
+            calls.push([&result, i] { result.push_back(i * 10); });
+            calls.push([&result, i] { result.push_back(i * 10 + 1); });
+        }
+
+        // When flushing the queue
+        calls.flush();
+
+        // Then, calls are sorted by order, and calls of the same scope keep their push order
+        EXPECT_EQ(result, (std::vector {0, 1, 10, 11, 20, 21, 30, 31}));
+    }
+
+    TEST(DeferredCallsShould, acceptCallsFromMultipleThreads)
+    {
+        // Given threads pushing calls in their own scope
+        DeferredCalls calls;
+        std::vector<std::size_t> result;
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < 8; ++i)
+            threads.emplace_back([&calls, &result, i]
+            {
+                DeferredCalls::Scope scope(calls, i);
+                for (std::size_t j = 0; j < 100; ++j)
+                    calls.push([&result, i] { result.push_back(i); });
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        // When flushing the queue
+        calls.flush();
+
+        // Then, all calls are executed in a deterministic order
+        ASSERT_EQ(result.size(), 800);
+        for (std::size_t i = 0; i < result.size(); ++i)
+            EXPECT_EQ(result[i], i / 100);
+    }
+
+    TEST(DeferredCallsShould, deferSignalEmissionsInAScope)
+    {
+        // Given a signal with a connected callback
+        Signal<std::string, int&> signal;
+        std::string received;
+        signal.connect([&received](const std::string& str, int& value)
+        {
+            received = str;
+            ++value;
+        });
+
+        // When emitting the signal in a scope
+        DeferredCalls calls;
+        int value = 0;
+        {
+            DeferredCalls::Scope scope(calls);
+            std::string str = "deferred";
+            signal.emit(str, value);
+            str = "modified";
+        }
+
+        // Then, the callback is called with a copy of the value argument and a reference to the mutable one only when flushed
+        EXPECT_TRUE(received.empty());
+        EXPECT_EQ(value, 0);
+
+        calls.flush();
+        EXPECT_EQ(received, "deferred");
+        EXPECT_EQ(value, 1);
+    }
+}
@@ -100,6 +100,7 @@ namespace spark::render
         using shader_program_type = typename device_type::shader_program_type;
         using input_assembler_type = typename device_type::input_assembler_type;
         using rasterizer_type = typename device_type::rasterizer_type;
+        using compute_pipeline_type = typename device_type::compute_pipeline_type;
 
     public:
         ~RenderBackend() noexcept override = default;
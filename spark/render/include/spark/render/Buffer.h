@@ -66,6 +66,10 @@ namespace spark::render
         /// Buffers of this type can be bound to `Buffer`/`RWBuffer` descriptors.
         Texel = 0x00000005,
 
+        /// \brief Describes a buffer of draw arguments, read by \ref ICommandBuffer::drawIndexedIndirect().
+        /// Buffers of this type can also be bound to `RWStructuredBuffer` or `RWByteAddressBuffer` descriptors, for a compute shader to write the arguments.
+        Indirect = 0x00000006,
+
         /// \brief Describes another type of buffer, such as samplers or images.
         /// Buffers of this type must not be bound to any descriptor, but can be used as copy/transfer targets and sources.
         Other = 0x7FFFFFFF
@@ -88,7 +92,8 @@ namespace spark::render
         /// \brief Creates a buffer that can optimally be mapped from the CPU in order to be transferred to the GPU later.
         /// The memory for the buffer will be allocated in the DRAM (CPU or host memory). It can be optimally accessed by the CPU in order to be written. However,
         /// reading it from the GPU may be inefficient. This usage mode should be used to create a staging buffer, i.e. a buffer that is written infrequently and
-        /// then transferred to another buffer, that uses \ref BufferUsage::Resource.
+        /// then transferred to another buffer, that uses \ref BufferUsage::Resource. Its memory stays mapped, and can be written directly through
+        /// \ref IMappable::mappedMemory().
         Staging = 0x00000001,
 
         /// \brief Creates a buffer that can optimally be read by the GPU.
@@ -98,7 +103,7 @@ namespace spark::render
 
         /// \brief Creates a buffer that can be optimally mapped by the CPU and is preferred to be optimally read by the GPU.
         /// Dynamic buffers are used when the content is expected to be changed every frame. They do not require transfer calls, but may not be read as efficiently
-        /// as \ref BufferUsage::Resource buffers.
+        /// as \ref BufferUsage::Resource buffers. Their memory stays mapped, and can be written directly through \ref IMappable::mappedMemory().
         Dynamic = 0x00000010,
 
         /// \brief Creates a buffer that can be written by the GPU and read by the CPU.
@@ -338,6 +343,8 @@ struct std::formatter<spark::render::BufferType> : std::formatter<std::string_vi
             return std::format_to(ctx.out(), "Storage");
         case spark::render::BufferType::Texel:
             return std::format_to(ctx.out(), "Texel");
+        case spark::render::BufferType::Indirect:
+            return std::format_to(ctx.out(), "Indirect");
         case spark::render::BufferType::Other:
             return std::format_to(ctx.out(), "Other");
         }
@@ -10,10 +10,12 @@
 #include "spark/render/VertexBuffer.h"
 #include "spark/render/Viewport.h"
 
+#include "spark/math/Vector3.h"
 #include "spark/math/Vector4.h"
 
 #include <memory>
 #include <span>
+#include <string_view>
 
 namespace spark::render
 {
@@ -51,6 +53,22 @@ namespace spark::render
          */
         [[nodiscard]] virtual bool isSecondary() const noexcept = 0;
 
+        /**
+         * \brief Begins a profiling scope, which measures the GPU time and the pipeline statistics of the commands recorded until \ref endProfileScope().
+         * \param name The name of the scope. The scopes of a frame with the same name are merged, see \ref IGpuProfiler::results().
+         *
+         * The scopes can be nested, only the outermost scope of a command buffer counting the pipeline statistics. The scope is ignored if the device does
+         * not support the profiling.
+         */
+        virtual void beginProfileScope(std::string_view name) const = 0;
+
+        /**
+         * \brief Ends the last profiling scope begun by \ref beginProfileScope().
+         *
+         * \throws base::BadArgumentException If no profiling scope is begun.
+         */
+        virtual void endProfileScope() const = 0;
+
         /**
          * \brief Performs a buffer to buffer transfer from \p source to \p target.
          * \param source The source buffer to transfer data from.
@@ -208,8 +226,49 @@ namespace spark::render
         }
 
         /**
-         * \brief Sets the \p pipeline to be used for subsequent draw calls.
-         * \param pipeline A \ref IPipeline object to use for subsequent draw calls.
+         * \brief Copies a range of bytes from \p source to \p target, regardless of the size of their elements.
+         * \param source The source buffer to copy the data from.
+         * \param target The target buffer to copy the data to.
+         * \param source_offset The offset of the first byte to copy in \p source.
+         * \param target_offset The offset in \p target to copy the first byte to.
+         * \param size The number of bytes to copy.
+         *
+         * This allows to copy a part of a buffer shared by many copies, such as the staging memory of an \ref UploadManager.
+         *
+         * \throws spark::base::ArgumentOutOfRangeException if either the source or target buffer does not contain the copied range.
+         */
+        void copy(IBuffer& source, IBuffer& target, const std::size_t source_offset, const std::size_t target_offset, const std::size_t size) const
+        {
+            genericCopy(source, target, source_offset, target_offset, size);
+        }
+
+        /**
+         * \brief Copies a sub-resource of \p target from the bytes of \p source starting at \p source_offset.
+         * \param source The source buffer to copy the data from.
+         * \param target The target image to copy the data to.
+         * \param source_offset The offset of the first byte of the sub-resource in \p source.
+         * \param subresource The index of the sub-resource of \p target to copy the data to.
+         *
+         * The sub-resource is transitioned to be read by the shaders after the copy, as with \ref transfer().
+         *
+         * \throws spark::base::ArgumentOutOfRangeException if \p target has no sub-resource \p subresource.
+         */
+        void copy(IBuffer& source, IImage& target, const std::size_t source_offset, const unsigned int subresource = 0) const
+        {
+            genericCopy(source, target, source_offset, subresource);
+        }
+
+        /**
+         * \brief Waits for the previous transfers and copies to finish writing their buffers before the next commands read them.
+         *
+         * The next commands include the commands of this command buffer, and of the command buffers submitted after it on the same queue. They can then read
+         * the written buffers as shader resources, as indirect arguments or as vertex and index buffers.
+         */
+        virtual void transferBarrier() const noexcept = 0;
+
+        /**
+         * \brief Sets the \p pipeline to be used for subsequent draw calls, or for subsequent dispatches if it is a \ref IComputePipeline.
+         * \param pipeline A \ref IPipeline object to use for subsequent draw calls or dispatches.
          */
         void use(const IPipeline& pipeline) const noexcept { genericUse(pipeline); }
 
@@ -314,9 +373,33 @@ namespace spark::render
                          unsigned int first_instance = 0) const noexcept { genericDrawIndexed(vertex_buffer, index_buffer, instances, first_index, vertex_offset, first_instance); }
 
         /**
-         * \brief Executes a compute shader.
+         * \brief Draws the currently bound vertex buffer with the currently bound index buffer, reading the arguments of the draws from a buffer.
+         * \param arguments The \ref IBuffer of type \ref BufferType::Indirect holding the arguments, one draw per element. Each element holds the number of
+         * indices, the number of instances, the first index, the vertex offset and the first instance of a draw, as 32 bits integers.
+         * \param first_draw The element of the first draw in \p arguments.
+         * \param draws The number of draws.
+         *
+         * The arguments are read by the GPU when the draws are executed, so they can be written by a compute shader dispatched before, which decides how many
+         * instances are drawn without the CPU knowing their number.
+         */
+        void drawIndexedIndirect(const IBuffer& arguments, unsigned int first_draw = 0, unsigned int draws = 1) const noexcept
+        {
+            genericDrawIndexedIndirect(arguments, first_draw, draws);
+        }
+
+        /**
+         * \brief Executes the compute shader of the last used \ref IComputePipeline.
+         * \param thread_groups The number of thread groups to execute on each axis.
+         */
+        virtual void dispatch(const math::Vector3<unsigned>& thread_groups) const noexcept = 0;
+
+        /**
+         * \brief Waits for the previous dispatches to finish writing their buffers before the next commands read them.
+         *
+         * The next commands include the draws and the dispatches of this command buffer, and of the command buffers submitted after it on the same queue. They
+         * can then read the written buffers as shader resources, as indirect arguments or as vertex and index buffers.
          */
-        virtual void dispatch() const noexcept = 0;
+        virtual void dispatchBarrier() const noexcept = 0;
 
         /**
          * \brief Executes a secondary command buffer.
@@ -419,6 +502,8 @@ namespace spark::render
                                      unsigned int first_subresource = 0,
                                      unsigned int target_element = 0,
                                      unsigned int subresources = 1) const noexcept = 0;
+        virtual void genericCopy(IBuffer& source, IBuffer& target, std::size_t source_offset, std::size_t target_offset, std::size_t size) const = 0;
+        virtual void genericCopy(IBuffer& source, IImage& target, std::size_t source_offset, unsigned int subresource) const = 0;
         virtual void genericUse(const IPipeline& pipeline) const noexcept = 0;
         virtual void genericBind(const IDescriptorSet& descriptor_set) const = 0;
         virtual void genericBind(const IDescriptorSet& descriptor_set, const IPipeline& pipeline) const noexcept = 0;
@@ -442,6 +527,7 @@ namespace spark::render
                                         unsigned int first_index = 0,
                                         int vertex_offset = 0,
                                         unsigned int first_instance = 0) const noexcept = 0;
+        virtual void genericDrawIndexedIndirect(const IBuffer& arguments, unsigned int first_draw, unsigned int draws) const noexcept = 0;
         virtual void genericExecute(std::shared_ptr<const ICommandBuffer> command_buffer) const = 0;
         virtual void genericExecute(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const = 0;
         virtual void genericPushConstants(const IPushConstantsLayout& layout, const void* const memory) const noexcept = 0;
@@ -501,6 +587,12 @@ namespace spark::render
                               unsigned int target_element,
                               unsigned int subresources) const = 0;
 
+        /// \copydoc ICommandBuffer::copy()
+        virtual void copy(buffer_type& source, buffer_type& target, std::size_t source_offset, std::size_t target_offset, std::size_t size) const = 0;
+
+        /// \copydoc ICommandBuffer::copy()
+        virtual void copy(buffer_type& source, image_type& target, std::size_t source_offset, unsigned subresource) const = 0;
+
         /// \copydoc ICommandBuffer::use()
         virtual void use(const pipeline_type& pipeline) const noexcept = 0;
 
@@ -536,6 +628,9 @@ namespace spark::render
                                  int vertex_offset,
                                  unsigned first_instance) const noexcept = 0;
 
+        /// \copydoc ICommandBuffer::drawIndexedIndirect()
+        virtual void drawIndexedIndirect(const buffer_type& arguments, unsigned first_draw, unsigned draws) const noexcept = 0;
+
         /// \copydoc ICommandBuffer::execute()
         virtual void execute(std::shared_ptr<const command_buffer_type> command_buffer) const = 0;
 
@@ -586,6 +681,16 @@ namespace spark::render
             transfer(std::static_pointer_cast<image_type>(source), dynamic_cast<buffer_type&>(target), first_subresource, target_element, subresources);
         }
 
+        void genericCopy(IBuffer& source, IBuffer& target, std::size_t source_offset, std::size_t target_offset, std::size_t size) const final
+        {
+            copy(dynamic_cast<buffer_type&>(source), dynamic_cast<buffer_type&>(target), source_offset, target_offset, size);
+        }
+
+        void genericCopy(IBuffer& source, IImage& target, std::size_t source_offset, unsigned subresource) const final
+        {
+            copy(dynamic_cast<buffer_type&>(source), dynamic_cast<image_type&>(target), source_offset, subresource);
+        }
+
         void genericUse(const IPipeline& pipeline) const noexcept final { use(dynamic_cast<const pipeline_type&>(pipeline)); }
         void genericBind(const IDescriptorSet& descriptor_set) const final { bind(dynamic_cast<const descriptor_set_type&>(descriptor_set)); }
 
@@ -632,6 +737,11 @@ namespace spark::render
                         first_instance);
         }
 
+        void genericDrawIndexedIndirect(const IBuffer& arguments, unsigned first_draw, unsigned draws) const noexcept final
+        {
+            drawIndexedIndirect(dynamic_cast<const buffer_type&>(arguments), first_draw, draws);
+        }
+
         void genericExecute(std::shared_ptr<const ICommandBuffer> command_buffer) const final { execute(std::static_pointer_cast<const command_buffer_type>(command_buffer)); }
 
         void genericExecute(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const final
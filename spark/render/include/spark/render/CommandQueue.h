@@ -109,8 +109,10 @@ namespace spark::render
          * applying the command buffer multiple times. Ideally they are used as small chunks of re-occurring workloads.
          * 
          * A secondary command buffer must not be submitted to a queue, but rather to a primary command buffer by calling \ref ICommandBuffer::execute().
+         *
+         * \throws base::NullPointerException If the backend fails to allocate the command buffer.
          */
-        [[nodiscard]] std::shared_ptr<ICommandBuffer> createCommandBuffer(bool begin_recording = false, bool secondary = false) const noexcept
+        [[nodiscard]] std::shared_ptr<ICommandBuffer> createCommandBuffer(bool begin_recording = false, bool secondary = false) const
         {
             return genericCreateCommandBuffer(begin_recording, secondary);
         }
@@ -121,8 +123,11 @@ namespace spark::render
          * \return The fence that was inserted to wait for the command buffer.
          *
          * \note Submitting a recording command buffer will implicitly end the recording.
+         *
+         * \throws base::NullPointerException If the command buffer is `nullptr` or was not created by this backend.
+         * \throws base::BadArgumentException If the command buffer is a secondary command buffer.
          */
-        [[nodiscard]] std::size_t submit(std::shared_ptr<ICommandBuffer> command_buffer) const noexcept { return genericSubmit(std::move(command_buffer)); }
+        [[nodiscard]] std::size_t submit(std::shared_ptr<ICommandBuffer> command_buffer) const { return genericSubmit(std::move(command_buffer)); }
 
         /**
          * \brief Submits a single command buffer to the queue and inserts a fence to wait for it.
@@ -130,8 +135,11 @@ namespace spark::render
          * \return The fence that was inserted to wait for the command buffer.
          *
          * \note Submitting a recording command buffer will implicitly end the recording.
+         *
+         * \throws base::NullPointerException If the command buffer is `nullptr` or was not created by this backend.
+         * \throws base::BadArgumentException If the command buffer is a secondary command buffer.
          */
-        [[nodiscard]] std::size_t submit(std::shared_ptr<const ICommandBuffer> command_buffer) const noexcept { return genericSubmit(std::move(command_buffer)); }
+        [[nodiscard]] std::size_t submit(std::shared_ptr<const ICommandBuffer> command_buffer) const { return genericSubmit(std::move(command_buffer)); }
 
         /**
          * \brief Submits multiple command buffers to the queue and inserts a fence to wait for them.
@@ -139,8 +147,11 @@ namespace spark::render
          * \return The fence that was inserted to wait for the command buffers.
          *
          * \note If any of the command buffers is currently recording, it will implicitly end the recording.
+         *
+         * \throws base::NullPointerException If a command buffer is `nullptr` or was not created by this backend.
+         * \throws base::BadArgumentException If a command buffer is a secondary command buffer.
          */
-        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const noexcept { return genericSubmit(command_buffers); }
+        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const { return genericSubmit(command_buffers); }
 
         /**
          * \brief Submits multiple command buffers to the queue and inserts a fence to wait for them.
@@ -148,8 +159,11 @@ namespace spark::render
          * \return The fence that was inserted to wait for the command buffers.
          *
          * \note If any of the command buffers is currently recording, it will implicitly end the recording.
+         *
+         * \throws base::NullPointerException If a command buffer is `nullptr` or was not created by this backend.
+         * \throws base::BadArgumentException If a command buffer is a secondary command buffer.
          */
-        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<ICommandBuffer>>& command_buffers) const noexcept
+        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<ICommandBuffer>>& command_buffers) const
         {
             std::vector<std::shared_ptr<const ICommandBuffer>> command_buffers_vector;
             command_buffers_vector.reserve(command_buffers.size());
@@ -159,6 +173,20 @@ namespace spark::render
             return genericSubmit(command_buffers_vector);
         }
 
+        /**
+         * \brief Defers the next submissions to the queue until \ref endBatch(), to hand them to the GPU at once.
+         *
+         * The submissions return their fence as usual. The consecutive ones which do not wait for other work are grouped and share the same fence.
+         * Waiting for a deferred fence with \ref waitFor() submits the deferred work first.
+         */
+        virtual void beginBatch() const noexcept = 0;
+
+        /**
+         * \brief Submits the work deferred since \ref beginBatch() at once, and stops deferring the next submissions.
+         * \return The latest fence inserted into the queue.
+         */
+        virtual std::size_t endBatch() const = 0;
+
         /**
          * \brief Waits for fence value \p fence to complete on the command queue.
          * \param fence The fence value to wait for.
@@ -166,8 +194,19 @@ namespace spark::render
          * Each time one or more command buffers are submitted to the queue, a fence is inserted and its value will be returned. By calling this method, it is possible to
          * wait for this fence. A fence value is guaranteed to be larger than earlier fences, so the method returns, if the latest signaled fence value is larger or equal
          * to the value specified in \p fence.
+         *
+         * \throws base::NullPointerException If \p fence is deferred in a batch and the deferred work cannot be submitted.
+         */
+        virtual void waitFor(std::size_t fence) const = 0;
+
+        /**
+         * \brief Makes the next submission to the queue wait on the GPU for \p queue to reach \p fence, without blocking the calling thread.
+         * \param queue The queue to wait for. Waiting for the queue itself does nothing, since its submissions are already ordered.
+         * \param fence The fence value of \p queue to wait for.
+         *
+         * The ownership of the images released by \p queue to this one up to \p fence is acquired by the next submission as well.
          */
-        virtual void waitFor(std::size_t fence) const noexcept = 0;
+        virtual void waitForQueue(const ICommandQueue& queue, std::size_t fence) const = 0;
 
         /**
          * \brief Gets the latest fence inserted into the queue.
@@ -175,13 +214,25 @@ namespace spark::render
          */
         [[nodiscard]] virtual std::size_t currentFence() const noexcept = 0;
 
+        /**
+         * \brief Gets the latest fence reached by the queue, without waiting for the pending ones.
+         * \return The latest completed fence value, lower or equal to \ref currentFence().
+         */
+        [[nodiscard]] virtual std::size_t completedFence() const noexcept = 0;
+
+        /**
+         * \brief Gets the number of command buffers and command pools allocated by the queue since it was bound.
+         * \return The number of allocations, which stops growing once the command buffers created by the queue are all recycled.
+         */
+        [[nodiscard]] virtual std::size_t commandBufferAllocations() const noexcept = 0;
+
     private:
         /// @{
         /// \brief Private method used to allow replacement of the generic methods by custom types.
-        [[nodiscard]] virtual std::shared_ptr<ICommandBuffer> genericCreateCommandBuffer(bool begin_recording, bool secondary) const noexcept = 0;
-        virtual std::size_t genericSubmit(std::shared_ptr<ICommandBuffer> command_buffer) const noexcept = 0;
-        virtual std::size_t genericSubmit(std::shared_ptr<const ICommandBuffer> command_buffer) const noexcept = 0;
-        virtual std::size_t genericSubmit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const noexcept = 0;
+        [[nodiscard]] virtual std::shared_ptr<ICommandBuffer> genericCreateCommandBuffer(bool begin_recording, bool secondary) const = 0;
+        virtual std::size_t genericSubmit(std::shared_ptr<ICommandBuffer> command_buffer) const = 0;
+        virtual std::size_t genericSubmit(std::shared_ptr<const ICommandBuffer> command_buffer) const = 0;
+        virtual std::size_t genericSubmit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const = 0;
         /// @}
     };
 
@@ -197,37 +248,37 @@ namespace spark::render
 
     public:
         /// \copydoc ICommandQueue::createCommandBuffer()
-        [[nodiscard]] virtual std::shared_ptr<command_buffer_type> createCommandBuffer(bool begin_recording = false, bool secondary = false) const noexcept = 0;
+        [[nodiscard]] virtual std::shared_ptr<command_buffer_type> createCommandBuffer(bool begin_recording = false, bool secondary = false) const = 0;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] virtual std::size_t submit(std::shared_ptr<command_buffer_type> command_buffer) const noexcept = 0;
+        [[nodiscard]] virtual std::size_t submit(std::shared_ptr<command_buffer_type> command_buffer) const = 0;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] virtual std::size_t submit(std::shared_ptr<const command_buffer_type> command_buffer) const noexcept = 0;
+        [[nodiscard]] virtual std::size_t submit(std::shared_ptr<const command_buffer_type> command_buffer) const = 0;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] virtual std::size_t submit(const std::vector<std::shared_ptr<const command_buffer_type>>& command_buffers) const noexcept = 0;
+        [[nodiscard]] virtual std::size_t submit(const std::vector<std::shared_ptr<const command_buffer_type>>& command_buffers) const = 0;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] virtual std::size_t submit(const std::vector<std::shared_ptr<command_buffer_type>>& command_buffers) const noexcept = 0;
+        [[nodiscard]] virtual std::size_t submit(const std::vector<std::shared_ptr<command_buffer_type>>& command_buffers) const = 0;
 
     private:
-        [[nodiscard]] std::shared_ptr<ICommandBuffer> genericCreateCommandBuffer(bool begin_recording, bool secondary) const noexcept final
+        [[nodiscard]] std::shared_ptr<ICommandBuffer> genericCreateCommandBuffer(bool begin_recording, bool secondary) const final
         {
             return createCommandBuffer(begin_recording, secondary);
         }
 
-        std::size_t genericSubmit(std::shared_ptr<ICommandBuffer> command_buffer) const noexcept final
+        std::size_t genericSubmit(std::shared_ptr<ICommandBuffer> command_buffer) const final
         {
             return submit(std::dynamic_pointer_cast<command_buffer_type>(std::move(command_buffer)));
         }
 
-        std::size_t genericSubmit(std::shared_ptr<const ICommandBuffer> command_buffer) const noexcept final
+        std::size_t genericSubmit(std::shared_ptr<const ICommandBuffer> command_buffer) const final
         {
             return submit(std::dynamic_pointer_cast<const command_buffer_type>(std::move(command_buffer)));
         }
 
-        std::size_t genericSubmit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const noexcept final
+        std::size_t genericSubmit(const std::vector<std::shared_ptr<const ICommandBuffer>>& command_buffers) const final
         {
             std::vector<std::shared_ptr<const command_buffer_type>> command_buffers_vector;
             std::ranges::transform(command_buffers,
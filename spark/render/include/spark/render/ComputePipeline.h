@@ -0,0 +1,34 @@
+#pragma once
+
+#include "spark/render/Export.h"
+#include "spark/render/Pipeline.h"
+
+#include "spark/math/Vector3.h"
+
+namespace spark::render
+{
+    /**
+     * \brief Interface for a compute pipeline.
+     */
+    class SPARK_RENDER_EXPORT IComputePipeline : public virtual IPipeline
+    {
+    public:
+        ~IComputePipeline() noexcept override = default;
+
+        /**
+         * \brief Gets the number of threads of a thread group, as declared by the `numthreads` attribute of the compute shader.
+         * \return A \ref math::Vector3 containing the number of threads of a thread group on each axis.
+         *
+         * The number of thread groups given to \ref ICommandBuffer::dispatch() is usually the number of elements to process divided by this size, rounded up.
+         */
+        [[nodiscard]] virtual math::Vector3<unsigned> threadGroupSize() const noexcept = 0;
+    };
+
+    /**
+     * \brief Represents a compute \ref IPipeline, which only runs a compute shader.
+     * \tparam PipelineLayoutType The type of the pipeline layout. (inherits from \ref IPipelineLayout)
+     * \tparam ShaderProgramType The type of the shader program. (inherits from \ref IShaderProgram)
+     */
+    template <typename PipelineLayoutType, typename ShaderProgramType>
+    class ComputePipeline : public IComputePipeline, public StateResource, public virtual Pipeline<PipelineLayoutType, ShaderProgramType> {};
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "spark/render/Export.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace spark::render
+{
+    /**
+     * \brief The pipeline statistics counted by the GPU during a profiling scope.
+     */
+    struct PipelineStatistics
+    {
+        /// \brief The number of primitives read by the input assembly stage.
+        std::uint64_t inputPrimitives = 0;
+
+        /// \brief The number of vertex shader invocations.
+        std::uint64_t vertexShaderInvocations = 0;
+
+        /// \brief The number of primitives output by the clipping stage, which are rasterized.
+        std::uint64_t clippingPrimitives = 0;
+
+        /// \brief The number of fragment shader invocations.
+        std::uint64_t fragmentShaderInvocations = 0;
+
+        /// \brief The number of compute shader invocations.
+        std::uint64_t computeShaderInvocations = 0;
+
+        PipelineStatistics& operator+=(const PipelineStatistics& other) noexcept;
+        bool operator==(const PipelineStatistics& other) const noexcept = default;
+    };
+
+    /**
+     * \brief A profiling scope, as recorded into a command buffer by \ref ICommandBuffer::beginProfileScope() and \ref ICommandBuffer::endProfileScope().
+     */
+    struct GpuProfileSample
+    {
+        /// \brief The name of the scope.
+        std::string name;
+
+        /// \brief The GPU timestamp written when the scope began, in ticks.
+        std::uint64_t beginTicks = 0;
+
+        /// \brief The GPU timestamp written when the scope ended, in ticks.
+        std::uint64_t endTicks = 0;
+
+        /// \brief The pipeline statistics counted during the scope.
+        PipelineStatistics statistics;
+    };
+
+    /**
+     * \brief The GPU cost of all the profiling scopes of a frame with the same name, for example all the parts of a render graph pass.
+     */
+    struct GpuProfileScope
+    {
+        /// \brief The name of the scopes.
+        std::string name;
+
+        /// \brief The GPU time spent in the scopes, in milliseconds.
+        double milliseconds = 0.0;
+
+        /// \brief The pipeline statistics counted during the scopes.
+        PipelineStatistics statistics;
+
+        /// \brief The number of scopes merged into this one.
+        unsigned scopes = 0;
+    };
+
+    /**
+     * \brief Merges the samples of a frame with the same name, in the order the names first appear.
+     * \param samples The samples of the frame.
+     * \param ticks_per_millisecond The number of GPU timestamp ticks in a millisecond.
+     * \param timestamp_bits The number of valid bits of the timestamps, the higher bits being ignored and the timestamps wrapping around.
+     * \return A \ref GpuProfileScope for each name of the samples.
+     */
+    [[nodiscard]] SPARK_RENDER_EXPORT std::vector<GpuProfileScope> merge_profile_samples(std::span<const GpuProfileSample> samples,
+                                                                                         double ticks_per_millisecond,
+                                                                                         unsigned timestamp_bits = 64);
+
+    /**
+     * \brief Interface for the profiler of a graphics device, which measures the profiling scopes recorded into its command buffers.
+     *
+     * The scopes are measured on the GPU with timestamp and pipeline statistics queries, whose results are read a few frames later without waiting for
+     * the GPU. The frames whose results are not yet available when their queries are reused are skipped.
+     */
+    class SPARK_RENDER_EXPORT IGpuProfiler
+    {
+    public:
+        virtual ~IGpuProfiler() noexcept = default;
+
+        /**
+         * \brief Checks if the device supports the profiling. The profiling scopes are ignored otherwise.
+         * \return `true` if the scopes are measured, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool isEnabled() const noexcept = 0;
+
+        /**
+         * \brief Starts a new frame, before recording its scopes. The results of the oldest profiled frame are read if the GPU finished it.
+         */
+        virtual void beginFrame() const = 0;
+
+        /**
+         * \brief Gets the measures of the last frame whose results were read.
+         * \return A \ref GpuProfileScope for each scope name of the frame, in the order they were first recorded.
+         */
+        [[nodiscard]] virtual std::span<const GpuProfileScope> results() const noexcept = 0;
+
+        /**
+         * \brief Gets the number of frames whose results were read.
+         * \return The number of profiled frames.
+         */
+        [[nodiscard]] virtual std::size_t resolvedFrames() const noexcept = 0;
+
+        /**
+         * \brief Gets the number of frames which were not profiled, because their queries were still used by the GPU or they recorded too many scopes.
+         * \return The number of skipped frames.
+         */
+        [[nodiscard]] virtual std::size_t skippedFrames() const noexcept = 0;
+    };
+}
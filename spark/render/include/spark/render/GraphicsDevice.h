@@ -3,12 +3,15 @@
 #include "spark/render/CommandQueue.h"
 #include "spark/render/DeviceState.h"
 #include "spark/render/Export.h"
+#include "spark/render/GpuProfiler.h"
 #include "spark/render/GraphicsAdapter.h"
 #include "spark/render/GraphicsFactory.h"
 #include "spark/render/Surface.h"
 #include "spark/render/SwapChain.h"
 #include "spark/render/Format.h"
 
+#include <filesystem>
+
 namespace spark::render
 {
     /**
@@ -95,6 +98,12 @@ namespace spark::render
          */
         [[nodiscard]] virtual double ticksPerMillisecond() const noexcept = 0;
 
+        /**
+         * \brief Gets the profiler measuring the profiling scopes recorded into the command buffers of the device.
+         * \return The \ref IGpuProfiler of the device.
+         */
+        [[nodiscard]] virtual const IGpuProfiler& profiler() const noexcept = 0;
+
         /**
          * \brief Waits until the device is idle.
          *
@@ -102,6 +111,22 @@ namespace spark::render
          * Calling this method guarantees, that the device resources are in an unused state and may safely be released.
          */
         virtual void wait() const = 0;
+
+        /**
+         * \brief Loads the pipelines compiled by the previous runs on the same adapter and driver, and saves them again when the device is destroyed.
+         * \param directory The directory of the cache file. It is created if it does not exist.
+         *
+         * The loaded pipelines are merged into the cache of the device, so this can be called after some pipelines were created. A missing or
+         * incompatible cache file is ignored, the pipelines are then compiled as if there was no cache.
+         */
+        virtual void loadPipelineCache(const std::filesystem::path& directory) = 0;
+
+        /**
+         * \brief Writes the pipeline cache to the directory given to \ref loadPipelineCache. Does nothing if no cache was loaded.
+         *
+         * \throws base::CouldNotOpenFileException If the cache file cannot be written.
+         */
+        virtual void savePipelineCache() const = 0;
     };
 
     /**
@@ -111,12 +136,19 @@ namespace spark::render
      * \tparam SwapChainType The type of the swap chain the device uses for presentation. (Implements \ref ISwapChain)
      * \tparam CommandQueueType The type of the command queue the device uses for draw calls. (Implements \ref ICommandQueue)
      * \tparam RenderPassType The type of the render pass the device uses for draw calls. (Implements \ref IRenderPass)
+     * \tparam ComputePipelineType The type of the compute pipeline the device uses for dispatches. (Implements \ref IComputePipeline)
      *
      * The graphics device is the central instance of a renderer.
      * It owns the device state, which contains objects required for communication between your application and the graphics driver. Most notably, those objects
      * contain the \ref ISwapChain instance and the \ref ICommandQueue instances used for data and command transfer.
      */
-    template <typename FactoryType, typename SurfaceType, typename GraphicsAdapterType, typename SwapChainType, typename CommandQueueType, typename RenderPassType>
+    template <typename FactoryType,
+              typename SurfaceType,
+              typename GraphicsAdapterType,
+              typename SwapChainType,
+              typename CommandQueueType,
+              typename RenderPassType,
+              typename ComputePipelineType>
     class GraphicsDevice : public IGraphicsDevice
     {
     public:
@@ -139,6 +171,7 @@ namespace spark::render
         using shader_program_type = typename render_pipeline_type::shader_program_type;
         using input_assembler_type = typename render_pipeline_type::input_assembler_type;
         using rasterizer_type = typename render_pipeline_type::rasterizer_type;
+        using compute_pipeline_type = ComputePipelineType;
 
     public:
         /// \copydoc IGraphicsDevice::state()
@@ -47,5 +47,14 @@ namespace spark::render
          * \param write `true` if the data will be written to the object. `false` if the data will be read from the object.
          */
         virtual void map(std::span<void*> data, size_t element_size, unsigned int first_element = 0, bool write = true) = 0;
+
+        /**
+         * \brief Gets the address of the internal memory of the object, if it stays mapped during its whole lifetime.
+         * \return A pointer to the first byte of the memory, or `nullptr` if the memory is not persistently mapped.
+         *
+         * Data written through this pointer is visible to the device without calling \ref map(). The caller must ensure that the device is not reading the
+         * written memory at the same time.
+         */
+        [[nodiscard]] virtual void* mappedMemory() const noexcept = 0;
     };
 }
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "spark/render/CommandBuffer.h"
+#include "spark/render/Export.h"
+#include "spark/render/Format.h"
+#include "spark/render/RenderTarget.h"
+
+#include "spark/base/Macros.h"
+#include "spark/math/Vector2.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace spark::render
+{
+    class RenderGraph;
+
+    /**
+     * \brief The state of an attachment while a pass of a \ref RenderGraph uses it.
+     */
+    enum class AttachmentState
+    {
+        /// \brief The content of the attachment is undefined, before its first use.
+        Undefined,
+
+        /// \brief The attachment is written as a color target.
+        ColorAttachment,
+
+        /// \brief The attachment is written as a depth/stencil target.
+        DepthStencilAttachment,
+
+        /// \brief The attachment is read by the shaders, as an input attachment or a texture.
+        ShaderRead,
+
+        /// \brief The attachment is presented to the swap chain.
+        Present
+    };
+
+    /**
+     * \brief An attachment read or written by the passes of a \ref RenderGraph.
+     */
+    struct RenderGraphAttachment
+    {
+        /// \brief The name of the attachment, used by the passes to declare their reads and writes.
+        std::string name;
+
+        /// \brief The type of the attachment. A \ref RenderTargetType::Present attachment belongs to the swap chain, it is never aliased.
+        RenderTargetType type = RenderTargetType::Color;
+
+        /// \brief The format of the attachment.
+        Format format = Format::None;
+
+        /// \brief The size of the attachment, in pixels.
+        math::Vector2<unsigned> size;
+    };
+
+    /**
+     * \brief A transition of an attachment to the state needed by a pass.
+     */
+    struct AttachmentBarrier
+    {
+        /// \brief The index of the attachment in the graph.
+        std::size_t attachment = 0;
+
+        /// \brief The state of the attachment before the barrier.
+        AttachmentState before = AttachmentState::Undefined;
+
+        /// \brief The state of the attachment after the barrier.
+        AttachmentState after = AttachmentState::Undefined;
+
+        [[nodiscard]] bool operator==(const AttachmentBarrier& other) const = default;
+    };
+
+    /**
+     * \brief A pass of a \ref RenderGraph, which records its commands into its own command buffers.
+     *
+     * A pass can be split in several parts, recorded in parallel into consecutive command buffers which are executed in order. Splitting a pass drawing
+     * many instances shares its recording between several threads, without changing the order of its draws.
+     */
+    class SPARK_RENDER_EXPORT RenderGraphPass final
+    {
+        friend RenderGraph;
+
+    public:
+        /// \brief The function recording the commands of a pass.
+        using record_function = std::function<void(const ICommandBuffer&)>;
+
+        /// \brief The function recording the commands of a part of a pass, from the index of the part.
+        using part_record_function = std::function<void(const ICommandBuffer&, std::size_t)>;
+
+    public:
+        /**
+         * \brief Declares that the pass reads an attachment, which must be written before by other passes.
+         * \param attachment The name of the attachment.
+         * \return A reference to this pass, to chain the declarations.
+         *
+         * \throws base::BadArgumentException If the attachment does not exist in the graph.
+         */
+        RenderGraphPass& read(const std::string& attachment);
+
+        /**
+         * \brief Declares that the pass writes an attachment. The passes writing the same attachment run in the order they were added.
+         * \param attachment The name of the attachment.
+         * \return A reference to this pass, to chain the declarations.
+         *
+         * \throws base::BadArgumentException If the attachment does not exist in the graph.
+         */
+        RenderGraphPass& write(const std::string& attachment);
+
+        /**
+         * \brief Gets the name of the pass.
+         * \return The name of the pass.
+         */
+        [[nodiscard]] const std::string& name() const noexcept;
+
+        /**
+         * \brief Gets the transitions recorded before the commands of the pass, once the graph is compiled.
+         * \return The barriers of the pass.
+         */
+        [[nodiscard]] std::span<const AttachmentBarrier> barriers() const noexcept;
+
+        /**
+         * \brief Gets the level of the pass, once the graph is compiled. The passes of the same level do not depend on each other.
+         * \return The level of the pass, 0 for the passes depending on no other pass.
+         */
+        [[nodiscard]] std::size_t level() const noexcept;
+
+        /**
+         * \brief Gets the number of parts of the pass, each one recorded into its own command buffer.
+         * \return The number of parts of the pass, 1 if it is not split.
+         */
+        [[nodiscard]] std::size_t parts() const noexcept;
+
+        /**
+         * \brief Gets the command buffer of the first part of the pass, once the graph is compiled. The other parts use the following ones.
+         * \return The index of the command buffer, between 0 and \ref RenderGraph::commandBufferCount.
+         */
+        [[nodiscard]] std::size_t firstCommandBuffer() const noexcept;
+
+    private:
+        explicit RenderGraphPass(RenderGraph& graph, std::string name, std::size_t parts, part_record_function record);
+
+    private:
+        RenderGraph& m_graph;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::vector<...>' needs to have dll-interface to be used by clients of class 'spark::render::RenderGraphPass'
+
+        std::string m_name;
+        part_record_function m_record;
+        std::vector<std::size_t> m_reads;
+        std::vector<std::size_t> m_writes;
+        std::vector<AttachmentBarrier> m_barriers;
+
+        SPARK_WARNING_POP
+
+        std::size_t m_level = 0;
+        std::size_t m_parts = 1;
+        std::size_t m_firstCommandBuffer = 0;
+    };
+
+    /**
+     * \brief A graph of passes declaring the attachments they read and write, from which the order of the passes is deduced.
+     *
+     * Once compiled, the graph only keeps the passes contributing to its output and orders them by dependency levels: a pass reading an attachment runs
+     * after all the passes writing it, and the passes writing the same attachment run in the order they were added. The passes of the same level do not
+     * depend on each other, so they can be recorded in parallel. The graph also computes the barriers between the passes, the lifetime of the attachments
+     * and which attachments can share the same memory, since they are never used at the same time.
+     */
+    class SPARK_RENDER_EXPORT RenderGraph final
+    {
+        friend RenderGraphPass;
+
+    public:
+        /// \brief Gets a command buffer from its index, between 0 and \ref commandBufferCount.
+        using command_buffer_provider = std::function<const ICommandBuffer&(std::size_t)>;
+
+        /// \brief Calls a function with every index in [0, count), possibly in parallel, and returns once all of them were processed.
+        using level_executor = std::function<void(std::size_t, const std::function<void(std::size_t)>&)>;
+
+    public:
+        explicit RenderGraph();
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph& other) = delete;
+        RenderGraph(RenderGraph&& other) noexcept = delete;
+        RenderGraph& operator=(const RenderGraph& other) = delete;
+        RenderGraph& operator=(RenderGraph&& other) noexcept = delete;
+
+        /**
+         * \brief Adds an attachment to the graph.
+         * \param attachment The description of the attachment.
+         * \return The index of the attachment.
+         *
+         * \throws base::BadArgumentException If an attachment with the same name already exists.
+         */
+        std::size_t addAttachment(RenderGraphAttachment attachment);
+
+        /**
+         * \brief Adds a pass to the graph. The graph must be compiled again before being executed.
+         * \param name The name of the pass.
+         * \param record The function recording the commands of the pass.
+         * \return A reference to the pass, to declare its reads and writes. It stays valid as long as the graph.
+         */
+        RenderGraphPass& addPass(std::string name, RenderGraphPass::record_function record);
+
+        /**
+         * \brief Adds a pass split in several parts to the graph. The parts are recorded in parallel, and executed in the order of their index.
+         * \param name The name of the pass.
+         * \param parts The number of parts of the pass.
+         * \param record The function recording the commands of a part, called once for each part.
+         * \return A reference to the pass, to declare its reads and writes. It stays valid as long as the graph.
+         *
+         * \throws base::BadArgumentException If \p parts is zero.
+         */
+        RenderGraphPass& addPass(std::string name, std::size_t parts, RenderGraphPass::part_record_function record);
+
+        /**
+         * \brief Sets the attachment produced by the graph, usually the back buffer. Only the passes contributing to it are kept.
+         * \param attachment The name of the attachment.
+         *
+         * \throws base::BadArgumentException If the attachment does not exist in the graph.
+         */
+        void setOutput(const std::string& attachment);
+
+        /**
+         * \brief Orders the passes, and computes their barriers and the aliasing of the attachments.
+         *
+         * \throws base::BadArgumentException If the graph has no output, or if its passes depend on each other in a cycle.
+         */
+        void compile();
+
+        /**
+         * \brief Gets the passes to execute, in their compiled order.
+         * \return The passes, sorted by level.
+         */
+        [[nodiscard]] std::span<const RenderGraphPass* const> passes() const noexcept;
+
+        /**
+         * \brief Gets the number of command buffers needed to record the passes, one for each part of the passes to execute.
+         * \return The number of command buffers, once the graph is compiled.
+         */
+        [[nodiscard]] std::size_t commandBufferCount() const noexcept;
+
+        /**
+         * \brief Gets an attachment of the graph.
+         * \param attachment The index of the attachment.
+         * \return The description of the attachment.
+         *
+         * \throws base::ArgumentOutOfRangeException If the attachment does not exist in the graph.
+         */
+        [[nodiscard]] const RenderGraphAttachment& attachment(std::size_t attachment) const;
+
+        /**
+         * \brief Gets the index of an attachment.
+         * \param name The name of the attachment.
+         * \return The index of the attachment.
+         *
+         * \throws base::BadArgumentException If the attachment does not exist in the graph.
+         */
+        [[nodiscard]] std::size_t attachmentIndex(const std::string& name) const;
+
+        /**
+         * \brief Gets the memory of an attachment, which is shared by the attachments of the same format and size never used at the same time.
+         * \param attachment The index of the attachment.
+         * \return The index of the memory of the attachment, between 0 and \ref physicalAttachmentCount, or `std::nullopt` if no pass uses it.
+         *
+         * \throws base::BadArgumentException If the graph is not compiled.
+         * \throws base::ArgumentOutOfRangeException If the attachment does not exist in the graph.
+         */
+        [[nodiscard]] std::optional<std::size_t> physicalAttachment(std::size_t attachment) const;
+
+        /**
+         * \brief Gets the number of attachments to allocate once the attachments are aliased.
+         * \return The number of physical attachments.
+         */
+        [[nodiscard]] std::size_t physicalAttachmentCount() const noexcept;
+
+        /**
+         * \brief Gets the transitions recorded after all the passes, to present the output.
+         * \return The barriers of the end of the graph.
+         */
+        [[nodiscard]] std::span<const AttachmentBarrier> finalBarriers() const noexcept;
+
+        /**
+         * \brief Records the passes level by level.
+         * \param command_buffers Gets the command buffers of the parts of the passes, which must be recording.
+         * \param executor Records the parts of the passes of a level, possibly in parallel. By default, they are recorded one after another on the calling
+         * thread.
+         *
+         * \throws base::BadArgumentException If the graph is not compiled.
+         */
+        void execute(const command_buffer_provider& command_buffers, const level_executor& executor = {}) const;
+
+    private:
+        struct Impl;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::unique_ptr<...>' needs to have dll-interface to be used by clients of class 'spark::render::RenderGraph'
+
+        std::unique_ptr<Impl> m_impl;
+
+        SPARK_WARNING_POP
+    };
+}
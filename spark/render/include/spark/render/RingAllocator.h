@@ -0,0 +1,75 @@
+#pragma once
+
+#include "spark/render/Export.h"
+
+#include "spark/base/Macros.h"
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <utility>
+
+namespace spark::render
+{
+    /**
+     * \brief Sub-allocates ranges of a memory block used circularly, such as a staging buffer, released once the GPU reached a fence.
+     *
+     * The ranges are allocated one after another and wrap to the beginning of the block when they reach its end. The ranges allocated since the previous
+     * \ref submit() are tied to the fence given to it, and are released together by \ref release() once the fence is completed. This only keeps the count of
+     * the used bytes, the memory itself is owned by the caller.
+     */
+    class SPARK_RENDER_EXPORT RingAllocator final
+    {
+    public:
+        /**
+         * \brief Initializes a new \ref RingAllocator.
+         * \param size The size of the memory block, in bytes.
+         */
+        explicit RingAllocator(std::size_t size) noexcept;
+
+        /**
+         * \brief Allocates a range of the memory block.
+         * \param size The size of the range, in bytes.
+         * \param alignment The alignment of the offset of the range, which must be a power of two.
+         * \return The offset of the range in the memory block, or `std::nullopt` if there is not enough contiguous free memory.
+         */
+        [[nodiscard]] std::optional<std::size_t> allocate(std::size_t size, std::size_t alignment = 1) noexcept;
+
+        /**
+         * \brief Ties the ranges allocated since the previous call to \p fence.
+         * \param fence The fence completed once the GPU does not read the ranges anymore.
+         */
+        void submit(std::size_t fence);
+
+        /**
+         * \brief Releases the ranges tied to a fence lower or equal to \p completed_fence.
+         * \param completed_fence The latest fence completed by the GPU.
+         */
+        void release(std::size_t completed_fence) noexcept;
+
+        /**
+         * \brief Gets the size of the memory block.
+         * \return The size of the memory block, in bytes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * \brief Gets the number of bytes which are not released, including the padding added to align and wrap the ranges.
+         * \return The number of used bytes.
+         */
+        [[nodiscard]] std::size_t used() const noexcept;
+
+    private:
+        std::size_t m_size;
+        std::size_t m_head = 0;
+        std::size_t m_used = 0;
+        std::size_t m_unsubmitted = 0;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::deque<...>' needs to have dll-interface to be used by clients of class 'spark::render::RingAllocator'
+
+        std::deque<std::pair<std::size_t, std::size_t>> m_submitted;
+
+        SPARK_WARNING_POP
+    };
+}
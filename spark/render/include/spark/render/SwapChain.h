@@ -7,6 +7,9 @@
 
 #include "spark/math/Vector2.h"
 
+#include <cstddef>
+#include <vector>
+
 namespace spark::render
 {
     /**
@@ -83,6 +86,22 @@ namespace spark::render
          */
         [[nodiscard]] virtual unsigned int swapBackBuffer() const noexcept = 0;
 
+        /**
+         * \brief Checks if the swap chain draws to offscreen images instead of presenting them to a surface.
+         * \return `true` if the swap chain is offscreen, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool isOffscreen() const noexcept = 0;
+
+        /**
+         * \brief Reads the content of an image of the swap chain back to the CPU, once the frames drawn to it are finished.
+         * \param back_buffer Index of the back buffer to read.
+         * \return The texels of the image, row by row without padding, in the \ref surfaceFormat() of the swap chain.
+         *
+         * \throws base::BadArgumentException If the swap chain is not offscreen, since the presented images cannot be read.
+         * \throws base::ArgumentOutOfRangeException If \p back_buffer is out of range.
+         */
+        [[nodiscard]] virtual std::vector<std::byte> readBack(unsigned int back_buffer) const = 0;
+
     private:
         /// @{
         /// \brief Private method used to allow replacement of the generic methods by custom types.
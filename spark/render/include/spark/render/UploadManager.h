@@ -0,0 +1,105 @@
+#pragma once
+
+#include "spark/render/Export.h"
+
+#include "spark/base/Macros.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace spark::render
+{
+    class IBuffer;
+    class IImage;
+    class ICommandQueue;
+    class IGraphicsFactory;
+
+    /**
+     * \brief Uploads data to the buffers and images of the GPU through pooled staging memory, in batches.
+     *
+     * The data is copied into large persistently mapped staging rings, from which the uploads are sub-allocated instead of creating a staging buffer each
+     * time. The copies queued by \ref upload() are recorded into a single command buffer, submitted by \ref flush() in one submission. The staging memory of
+     * a batch is reused once the queue reached the fence of its submission. When the rings are full, a new ring is added and kept for the next uploads.
+     *
+     * The targets must be able to receive transfers, such as the buffers and images created with \ref BufferUsage::Resource. The uploaded data can be read
+     * by the command buffers submitted after the batch on the same queue, or on the other ones once they waited for its fence, for example with
+     * \ref ICommandQueue::waitForQueue().
+     */
+    class SPARK_RENDER_EXPORT UploadManager final
+    {
+    public:
+        /// \brief The default size of a staging ring, in bytes.
+        inline static constexpr std::size_t DefaultRingSize = 16 * 1024 * 1024;
+
+    public:
+        /**
+         * \brief Initializes a new \ref UploadManager.
+         * \param factory The \ref IGraphicsFactory creating the staging rings.
+         * \param queue The \ref ICommandQueue the uploads are submitted to.
+         * \param ring_size The size of a staging ring, in bytes. Uploads larger than this size get a ring of their own size.
+         */
+        explicit UploadManager(const IGraphicsFactory& factory, const ICommandQueue& queue, std::size_t ring_size = DefaultRingSize);
+        ~UploadManager();
+
+        UploadManager(const UploadManager& other) = delete;
+        UploadManager(UploadManager&& other) noexcept = delete;
+        UploadManager& operator=(const UploadManager& other) = delete;
+        UploadManager& operator=(UploadManager&& other) noexcept = delete;
+
+        /**
+         * \brief Queues the upload of \p size bytes to \p target.
+         * \param data The data to upload, copied before this method returns.
+         * \param size The number of bytes to upload.
+         * \param target The buffer to upload the data to.
+         * \param target_offset The offset in \p target to upload the first byte to.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p target does not contain the uploaded range.
+         */
+        void upload(const void* data, std::size_t size, IBuffer& target, std::size_t target_offset = 0);
+
+        /**
+         * \brief Queues the upload of a sub-resource of \p target.
+         * \param data The data of the sub-resource, copied before this method returns.
+         * \param size The size of the sub-resource, in bytes.
+         * \param target The image to upload the data to.
+         * \param subresource The index of the sub-resource of \p target to upload the data to.
+         *
+         * \throws base::ArgumentOutOfRangeException If \p target has no sub-resource \p subresource.
+         */
+        void upload(const void* data, std::size_t size, IImage& target, unsigned subresource = 0);
+
+        /**
+         * \brief Submits the uploads queued since the previous flush in a single command buffer.
+         * \return The fence of the queue reached once the uploads are done, or the one of the previous flush if no upload was queued.
+         */
+        std::size_t flush();
+
+        /**
+         * \brief Gets the fence of the last submitted uploads.
+         * \return The fence of the queue reached once the uploads of the last flush are done, 0 if nothing was flushed.
+         */
+        [[nodiscard]] std::size_t lastFence() const noexcept;
+
+        /**
+         * \brief Gets the number of uploads queued since the previous flush.
+         * \return The number of uploads submitted by the next \ref flush().
+         */
+        [[nodiscard]] std::size_t pendingUploads() const noexcept;
+
+        /**
+         * \brief Gets the number of staging rings.
+         * \return The number of staging rings allocated by the manager.
+         */
+        [[nodiscard]] std::size_t ringCount() const noexcept;
+
+    private:
+        struct Impl;
+
+        SPARK_WARNING_PUSH
+        SPARK_DISABLE_MSVC_WARNING(4251) // 'std::unique_ptr<...>' needs to have dll-interface to be used by clients of class 'spark::render::UploadManager'
+
+        std::unique_ptr<Impl> m_impl;
+
+        SPARK_WARNING_POP
+    };
+}
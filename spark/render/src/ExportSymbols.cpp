@@ -2,6 +2,7 @@
 // Else, the symbols are not exported and it fails to link, searching for the ctor and dtor of the interfaces.
 
 #include "spark/render/Backend.h"
+#include "spark/render/ComputePipeline.h"
 #include "spark/render/GraphicsAdapter.h"
 #include "spark/render/GraphicsDevice.h"
 #include "spark/render/Shader.h"
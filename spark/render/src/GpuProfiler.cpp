@@ -0,0 +1,40 @@
+#include "spark/render/GpuProfiler.h"
+
+#include <algorithm>
+
+namespace spark::render
+{
+    PipelineStatistics& PipelineStatistics::operator+=(const PipelineStatistics& other) noexcept
+    {
+        inputPrimitives += other.inputPrimitives;
+        vertexShaderInvocations += other.vertexShaderInvocations;
+        clippingPrimitives += other.clippingPrimitives;
+        fragmentShaderInvocations += other.fragmentShaderInvocations;
+        computeShaderInvocations += other.computeShaderInvocations;
+        return *this;
+    }
+
+    std::vector<GpuProfileScope> merge_profile_samples(const std::span<const GpuProfileSample> samples, const double ticks_per_millisecond, const unsigned timestamp_bits)
+    {
+        // The timestamps only have some valid bits, an end timestamp lower than the begin one means that the counter wrapped around between them
+        const std::uint64_t mask = timestamp_bits >= 64 ? ~std::uint64_t {0} : (std::uint64_t {1} << timestamp_bits) - 1;
+
+        std::vector<GpuProfileScope> scopes;
+        for (const GpuProfileSample& sample : samples)
+        {
+            auto scope = std::ranges::find(scopes, sample.name, &GpuProfileScope::name);
+            if (scope == scopes.end())
+            {
+                scopes.push_back({.name = sample.name, .milliseconds = 0.0, .statistics = {}, .scopes = 0});
+                scope = scopes.end() - 1;
+            }
+
+            // The scopes of a name are executed one after another, for example the parts of a pass, so their time is the sum of their durations
+            const std::uint64_t ticks = ((sample.endTicks & mask) - (sample.beginTicks & mask)) & mask;
+            scope->milliseconds += static_cast<double>(ticks) / ticks_per_millisecond;
+            scope->statistics += sample.statistics;
+            scope->scopes++;
+        }
+        return scopes;
+    }
+}
@@ -0,0 +1,462 @@
+#include "spark/render/RenderGraph.h"
+
+#include "spark/base/Exception.h"
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <queue>
+#include <ranges>
+#include <unordered_map>
+
+namespace
+{
+    /**
+     * \brief Checks whether a pass declared an attachment.
+     * \param attachments The attachments read or written by the pass.
+     * \param attachment The index of the attachment to look for.
+     * \return `true` if \p attachment is in \p attachments, `false` otherwise.
+     */
+    bool contains(const std::vector<std::size_t>& attachments, const std::size_t attachment)
+    {
+        return std::ranges::find(attachments, attachment) != attachments.end();
+    }
+}
+
+namespace spark::render
+{
+    struct RenderGraph::Impl
+    {
+        friend RenderGraph;
+        friend RenderGraphPass;
+
+    public:
+        /**
+         * \brief The levels of the passes using an attachment, between which its memory cannot be shared.
+         */
+        struct Lifetime
+        {
+            std::size_t first = 0;
+            std::size_t last = 0;
+            bool isUsed = false;
+        };
+
+        explicit Impl() = default;
+
+        /**
+         * \brief Finds the passes each pass waits for, from the attachments they read and write.
+         * \return The indices of the passes each pass depends on.
+         */
+        [[nodiscard]] std::vector<std::vector<std::size_t>> dependencies() const
+        {
+            // The writers of each attachment, in the order they were added
+            std::vector<std::vector<std::size_t>> writers(m_attachments.size());
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+                for (const std::size_t attachment : m_passes[pass]->m_writes)
+                    writers[attachment].push_back(pass);
+
+            std::vector<std::vector<std::size_t>> dependencies(m_passes.size());
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+            {
+                auto& pass_dependencies = dependencies[pass];
+
+                // A pass writing an attachment runs after the passes writing it before, a pass only reading it after all of them
+                for (const std::size_t attachment : m_passes[pass]->m_writes)
+                    for (const std::size_t writer : writers[attachment])
+                        if (writer < pass)
+                            pass_dependencies.push_back(writer);
+                for (const std::size_t attachment : m_passes[pass]->m_reads)
+                    if (!contains(m_passes[pass]->m_writes, attachment))
+                        pass_dependencies.insert(pass_dependencies.end(), writers[attachment].begin(), writers[attachment].end());
+
+                std::ranges::sort(pass_dependencies);
+                const auto [first, last] = std::ranges::unique(pass_dependencies);
+                pass_dependencies.erase(first, last);
+            }
+            return dependencies;
+        }
+
+        /**
+         * \brief Finds the passes contributing to the output of the graph.
+         * \param dependencies The dependencies of each pass.
+         * \return Whether each pass must be executed.
+         */
+        [[nodiscard]] std::vector<bool> usedPasses(const std::vector<std::vector<std::size_t>>& dependencies) const
+        {
+            std::vector<bool> is_used(m_passes.size(), false);
+            std::vector<std::size_t> pending;
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+                if (contains(m_passes[pass]->m_writes, *m_output))
+                    pending.push_back(pass);
+
+            while (!pending.empty())
+            {
+                const std::size_t pass = pending.back();
+                pending.pop_back();
+                if (is_used[pass])
+                    continue;
+
+                is_used[pass] = true;
+                pending.insert(pending.end(), dependencies[pass].begin(), dependencies[pass].end());
+            }
+            return is_used;
+        }
+
+        /**
+         * \brief Sorts the used passes topologically and computes their level, keeping the order they were added in when they do not depend on each other.
+         * \param dependencies The dependencies of each pass.
+         * \param is_used Whether each pass must be executed.
+         *
+         * \throws base::BadArgumentException If the passes depend on each other in a cycle.
+         */
+        void schedule(const std::vector<std::vector<std::size_t>>& dependencies, const std::vector<bool>& is_used)
+        {
+            std::vector<std::size_t> remaining(m_passes.size(), 0);
+            std::vector<std::vector<std::size_t>> dependents(m_passes.size());
+            std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> ready;
+            std::size_t used_count = 0;
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+            {
+                if (!is_used[pass])
+                    continue;
+
+                ++used_count;
+                remaining[pass] = dependencies[pass].size();
+                for (const std::size_t dependency : dependencies[pass])
+                    dependents[dependency].push_back(pass);
+                if (remaining[pass] == 0)
+                    ready.push(pass);
+            }
+
+            m_order.clear();
+            while (!ready.empty())
+            {
+                const std::size_t pass = ready.top();
+                ready.pop();
+
+                RenderGraphPass& render_pass = *m_passes[pass];
+                render_pass.m_level = 0;
+                for (const std::size_t dependency : dependencies[pass])
+                    render_pass.m_level = std::max(render_pass.m_level, m_passes[dependency]->m_level + 1);
+                m_order.push_back(pass);
+
+                for (const std::size_t dependent : dependents[pass])
+                    if (--remaining[dependent] == 0)
+                        ready.push(dependent);
+            }
+
+            if (m_order.size() != used_count)
+                throw base::BadArgumentException("The passes of the render graph depend on each other in a cycle.");
+
+            std::ranges::stable_sort(m_order, {}, [&](const std::size_t pass) { return m_passes[pass]->m_level; });
+            m_schedule.clear();
+            m_commandBufferCount = 0;
+            for (const std::size_t pass : m_order)
+            {
+                m_passes[pass]->m_firstCommandBuffer = m_commandBufferCount;
+                m_commandBufferCount += m_passes[pass]->m_parts;
+                m_schedule.push_back(m_passes[pass].get());
+            }
+        }
+
+        /**
+         * \brief Computes the transitions of the attachments before each pass, and after the last one.
+         */
+        void computeBarriers()
+        {
+            std::vector states(m_attachments.size(), AttachmentState::Undefined);
+            const auto transition = [&](std::vector<AttachmentBarrier>& barriers, const std::size_t attachment, const AttachmentState state)
+            {
+                if (states[attachment] == state)
+                    return;
+                barriers.push_back({.attachment = attachment, .before = states[attachment], .after = state});
+                states[attachment] = state;
+            };
+
+            for (const std::size_t index : m_order)
+            {
+                RenderGraphPass* pass = m_passes[index].get();
+                auto& barriers = pass->m_barriers;
+                barriers.clear();
+                for (const std::size_t attachment : pass->m_writes)
+                    transition(barriers,
+                               attachment,
+                               m_attachments[attachment].type == RenderTargetType::DepthStencil ? AttachmentState::DepthStencilAttachment : AttachmentState::ColorAttachment);
+                for (const std::size_t attachment : pass->m_reads)
+                    if (!contains(pass->m_writes, attachment))
+                        transition(barriers, attachment, AttachmentState::ShaderRead);
+            }
+
+            m_finalBarriers.clear();
+            for (std::size_t attachment = 0; attachment < m_attachments.size(); ++attachment)
+                if (m_attachments[attachment].type == RenderTargetType::Present && states[attachment] != AttachmentState::Undefined)
+                    transition(m_finalBarriers, attachment, AttachmentState::Present);
+        }
+
+        /**
+         * \brief Computes the lifetime of each attachment and shares the memory of the attachments which are never used at the same time.
+         */
+        void aliasAttachments()
+        {
+            std::vector<Lifetime> lifetimes(m_attachments.size());
+            const auto use = [&](const std::size_t attachment, const std::size_t level)
+            {
+                Lifetime& lifetime = lifetimes[attachment];
+                if (!lifetime.isUsed)
+                    lifetime = {.first = level, .last = level, .isUsed = true};
+                lifetime.first = std::min(lifetime.first, level);
+                lifetime.last = std::max(lifetime.last, level);
+            };
+            for (const RenderGraphPass* pass : m_schedule)
+            {
+                for (const std::size_t attachment : pass->m_reads)
+                    use(attachment, pass->m_level);
+                for (const std::size_t attachment : pass->m_writes)
+                    use(attachment, pass->m_level);
+            }
+
+            // Place the attachments by order of first use, in the first memory of the same format and size which is free since then
+            std::vector<std::size_t> order;
+            for (std::size_t attachment = 0; attachment < m_attachments.size(); ++attachment)
+                if (lifetimes[attachment].isUsed)
+                    order.push_back(attachment);
+            std::ranges::stable_sort(order, {}, [&](const std::size_t attachment) { return lifetimes[attachment].first; });
+
+            struct Slot
+            {
+                std::size_t attachment = 0;
+                std::size_t last = 0;
+            };
+
+            std::vector<Slot> slots;
+            m_physicalAttachments.assign(m_attachments.size(), std::nullopt);
+            for (const std::size_t attachment : order)
+            {
+                const RenderGraphAttachment& description = m_attachments[attachment];
+                const Lifetime& lifetime = lifetimes[attachment];
+                const auto is_free = [&](const Slot& slot)
+                {
+                    const RenderGraphAttachment& other = m_attachments[slot.attachment];
+                    return other.type != RenderTargetType::Present && other.type == description.type && other.format == description.format && other.size == description.size &&
+                           slot.last < lifetime.first;
+                };
+
+                const auto slot = std::ranges::find_if(slots, is_free);
+                if (description.type != RenderTargetType::Present && slot != slots.end())
+                {
+                    slot->last = lifetime.last;
+                    m_physicalAttachments[attachment] = static_cast<std::size_t>(std::distance(slots.begin(), slot));
+                } else
+                {
+                    m_physicalAttachments[attachment] = slots.size();
+                    slots.push_back({.attachment = attachment, .last = lifetime.last});
+                }
+            }
+            m_physicalAttachmentCount = slots.size();
+        }
+
+    private:
+        std::vector<RenderGraphAttachment> m_attachments;
+        std::unordered_map<std::string, std::size_t> m_attachmentIndices;
+        std::vector<std::unique_ptr<RenderGraphPass>> m_passes;
+        std::optional<std::size_t> m_output;
+
+        bool m_isCompiled = false;
+        std::vector<std::size_t> m_order;
+        std::vector<const RenderGraphPass*> m_schedule;
+        std::size_t m_commandBufferCount = 0;
+        std::vector<AttachmentBarrier> m_finalBarriers;
+        std::vector<std::optional<std::size_t>> m_physicalAttachments;
+        std::size_t m_physicalAttachmentCount = 0;
+    };
+
+    RenderGraphPass::RenderGraphPass(RenderGraph& graph, std::string name, const std::size_t parts, part_record_function record)
+        : m_graph(graph), m_name(std::move(name)), m_record(std::move(record)), m_parts(parts) {}
+
+    RenderGraphPass& RenderGraphPass::read(const std::string& attachment)
+    {
+        const std::size_t index = m_graph.attachmentIndex(attachment);
+        if (!contains(m_reads, index))
+            m_reads.push_back(index);
+        m_graph.m_impl->m_isCompiled = false;
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::write(const std::string& attachment)
+    {
+        const std::size_t index = m_graph.attachmentIndex(attachment);
+        if (!contains(m_writes, index))
+            m_writes.push_back(index);
+        m_graph.m_impl->m_isCompiled = false;
+        return *this;
+    }
+
+    const std::string& RenderGraphPass::name() const noexcept
+    {
+        return m_name;
+    }
+
+    std::span<const AttachmentBarrier> RenderGraphPass::barriers() const noexcept
+    {
+        return m_barriers;
+    }
+
+    std::size_t RenderGraphPass::level() const noexcept
+    {
+        return m_level;
+    }
+
+    std::size_t RenderGraphPass::parts() const noexcept
+    {
+        return m_parts;
+    }
+
+    std::size_t RenderGraphPass::firstCommandBuffer() const noexcept
+    {
+        return m_firstCommandBuffer;
+    }
+
+    RenderGraph::RenderGraph()
+        : m_impl(std::make_unique<Impl>()) {}
+
+    RenderGraph::~RenderGraph() = default;
+
+    std::size_t RenderGraph::addAttachment(RenderGraphAttachment attachment)
+    {
+        if (m_impl->m_attachmentIndices.contains(attachment.name))
+            throw base::BadArgumentException(std::format("An attachment named \"{0}\" already exists in the render graph.", attachment.name));
+
+        const std::size_t index = m_impl->m_attachments.size();
+        m_impl->m_attachmentIndices[attachment.name] = index;
+        m_impl->m_attachments.push_back(std::move(attachment));
+        m_impl->m_isCompiled = false;
+        return index;
+    }
+
+    RenderGraphPass& RenderGraph::addPass(std::string name, RenderGraphPass::record_function record)
+    {
+        return addPass(std::move(name),
+                       1,
+                       [record = std::move(record)](const ICommandBuffer& command_buffer, std::size_t)
+                       {
+                           if (record)
+                               record(command_buffer);
+                       });
+    }
+
+    RenderGraphPass& RenderGraph::addPass(std::string name, const std::size_t parts, RenderGraphPass::part_record_function record)
+    {
+        if (parts == 0)
+            throw base::BadArgumentException(std::format("The pass \"{0}\" must be recorded in at least one part.", name));
+
+        // The constructor of a pass is private, it cannot be created with std::make_unique
+        m_impl->m_passes.push_back(std::unique_ptr<RenderGraphPass>(new RenderGraphPass(*this, std::move(name), parts, std::move(record))));
+        m_impl->m_isCompiled = false;
+        return *m_impl->m_passes.back();
+    }
+
+    void RenderGraph::setOutput(const std::string& attachment)
+    {
+        m_impl->m_output = attachmentIndex(attachment);
+        m_impl->m_isCompiled = false;
+    }
+
+    void RenderGraph::compile()
+    {
+        if (!m_impl->m_output)
+            throw base::BadArgumentException("The render graph cannot be compiled without an output attachment.");
+
+        const auto dependencies = m_impl->dependencies();
+        m_impl->schedule(dependencies, m_impl->usedPasses(dependencies));
+        m_impl->computeBarriers();
+        m_impl->aliasAttachments();
+        m_impl->m_isCompiled = true;
+    }
+
+    std::span<const RenderGraphPass* const> RenderGraph::passes() const noexcept
+    {
+        return m_impl->m_schedule;
+    }
+
+    std::size_t RenderGraph::commandBufferCount() const noexcept
+    {
+        return m_impl->m_commandBufferCount;
+    }
+
+    const RenderGraphAttachment& RenderGraph::attachment(const std::size_t attachment) const
+    {
+        if (attachment >= m_impl->m_attachments.size())
+            throw base::ArgumentOutOfRangeException(std::format("The render graph has {0} attachments, but the attachment {1} was requested.", m_impl->m_attachments.size(), attachment));
+
+        return m_impl->m_attachments[attachment];
+    }
+
+    std::size_t RenderGraph::attachmentIndex(const std::string& name) const
+    {
+        if (!m_impl->m_attachmentIndices.contains(name))
+            throw base::BadArgumentException(std::format("No attachment named \"{0}\" exists in the render graph.", name));
+
+        return m_impl->m_attachmentIndices.at(name);
+    }
+
+    std::optional<std::size_t> RenderGraph::physicalAttachment(const std::size_t attachment) const
+    {
+        if (!m_impl->m_isCompiled)
+            throw base::BadArgumentException("The render graph must be compiled before its attachments are allocated.");
+        if (attachment >= m_impl->m_attachments.size())
+            throw base::ArgumentOutOfRangeException(std::format("The render graph has {0} attachments, but the attachment {1} was requested.", m_impl->m_attachments.size(), attachment));
+
+        return m_impl->m_physicalAttachments[attachment];
+    }
+
+    std::size_t RenderGraph::physicalAttachmentCount() const noexcept
+    {
+        return m_impl->m_physicalAttachmentCount;
+    }
+
+    std::span<const AttachmentBarrier> RenderGraph::finalBarriers() const noexcept
+    {
+        return m_impl->m_finalBarriers;
+    }
+
+    void RenderGraph::execute(const command_buffer_provider& command_buffers, const level_executor& executor) const
+    {
+        if (!m_impl->m_isCompiled)
+            throw base::BadArgumentException("The render graph must be compiled before being executed.");
+
+        const auto& schedule = m_impl->m_schedule;
+        for (std::size_t first = 0; first < schedule.size();)
+        {
+            // The passes of a level do not depend on each other, record all their parts before moving to the next level
+            std::size_t last = first;
+            while (last < schedule.size() && schedule[last]->m_level == schedule[first]->m_level)
+                ++last;
+
+            // The parts of the passes of a level use consecutive command buffers
+            const std::size_t first_command_buffer = schedule[first]->m_firstCommandBuffer;
+            const std::size_t command_buffer_count = schedule[last - 1]->m_firstCommandBuffer + schedule[last - 1]->m_parts - first_command_buffer;
+            const auto record = [&](const std::size_t i)
+            {
+                const std::size_t command_buffer = first_command_buffer + i;
+                const auto pass = std::ranges::find_if(schedule.begin() + static_cast<std::ptrdiff_t>(first),
+                                                       schedule.begin() + static_cast<std::ptrdiff_t>(last),
+                                                       [command_buffer](const RenderGraphPass* p) { return command_buffer < p->m_firstCommandBuffer + p->m_parts; });
+                if (!(*pass)->m_record)
+                    return;
+
+                // Each part is measured in its own scope, the profiler merging the parts of a pass since they have the same name
+                const ICommandBuffer& part_command_buffer = command_buffers(command_buffer);
+                part_command_buffer.beginProfileScope((*pass)->m_name);
+                (*pass)->m_record(part_command_buffer, command_buffer - (*pass)->m_firstCommandBuffer);
+                part_command_buffer.endProfileScope();
+            };
+
+            if (executor)
+                executor(command_buffer_count, record);
+            else
+                for (std::size_t i = 0; i < command_buffer_count; ++i)
+                    record(i);
+            first = last;
+        }
+    }
+}
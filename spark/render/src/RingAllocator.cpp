@@ -0,0 +1,62 @@
+#include "spark/render/RingAllocator.h"
+
+namespace spark::render
+{
+    RingAllocator::RingAllocator(const std::size_t size) noexcept
+        : m_size(size) {}
+
+    std::optional<std::size_t> RingAllocator::allocate(const std::size_t size, const std::size_t alignment) noexcept
+    {
+        if (m_size == 0 || size > m_size)
+            return std::nullopt;
+
+        // Start again from the beginning of the block when nothing is used, to keep the largest contiguous range free
+        if (m_used == 0)
+            m_head = 0;
+
+        // The skipped bytes are counted as used, so that the used bytes always follow each other from the oldest range to the head
+        std::size_t offset = (m_head + alignment - 1) & ~(alignment - 1);
+        std::size_t consumed = offset + size - m_head;
+        if (offset + size > m_size)
+        {
+            offset = 0;
+            consumed = m_size - m_head + size;
+        }
+
+        if (m_used + consumed > m_size)
+            return std::nullopt;
+
+        m_head = (offset + size) % m_size;
+        m_used += consumed;
+        m_unsubmitted += consumed;
+        return offset;
+    }
+
+    void RingAllocator::submit(const std::size_t fence)
+    {
+        if (m_unsubmitted == 0)
+            return;
+
+        m_submitted.emplace_back(fence, m_unsubmitted);
+        m_unsubmitted = 0;
+    }
+
+    void RingAllocator::release(const std::size_t completed_fence) noexcept
+    {
+        while (!m_submitted.empty() && m_submitted.front().first <= completed_fence)
+        {
+            m_used -= m_submitted.front().second;
+            m_submitted.pop_front();
+        }
+    }
+
+    std::size_t RingAllocator::size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::size_t RingAllocator::used() const noexcept
+    {
+        return m_used;
+    }
+}
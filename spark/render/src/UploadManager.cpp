@@ -0,0 +1,159 @@
+#include "spark/render/UploadManager.h"
+#include "spark/render/Buffer.h"
+#include "spark/render/CommandBuffer.h"
+#include "spark/render/CommandQueue.h"
+#include "spark/render/GraphicsFactory.h"
+#include "spark/render/Image.h"
+#include "spark/render/RingAllocator.h"
+
+#include "spark/base/Exception.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // The alignment of the staging memory of the buffers, and of the images which is a multiple of the size of any texel
+    constexpr std::size_t s_bufferAlignment = 16;
+    constexpr std::size_t s_imageAlignment = 256;
+}
+
+namespace spark::render
+{
+    struct UploadManager::Impl
+    {
+        friend UploadManager;
+
+    public:
+        /**
+         * \brief A persistently mapped staging buffer, sub-allocated circularly.
+         */
+        struct Ring
+        {
+            std::unique_ptr<IBuffer> buffer;
+            std::byte* memory = nullptr;
+            RingAllocator allocator;
+        };
+
+    public:
+        explicit Impl(const IGraphicsFactory& factory, const ICommandQueue& queue, const std::size_t ring_size)
+            : m_factory(factory), m_queue(queue), m_ringSize(ring_size) {}
+
+        /**
+         * \brief Copies \p data into the staging memory, and begins the command buffer recording the pending uploads if needed.
+         * \return The ring holding the copy and the offset of the copy in its buffer.
+         */
+        std::pair<Ring*, std::size_t> stage(const void* data, const std::size_t size, const std::size_t alignment)
+        {
+            // Reuse the staging memory of the uploads the queue is done with
+            const std::size_t completed_fence = m_queue.completedFence();
+            for (Ring& ring : m_rings)
+                ring.allocator.release(completed_fence);
+
+            Ring* staging_ring = nullptr;
+            std::size_t offset = 0;
+            for (Ring& ring : m_rings)
+                if (const auto allocation = ring.allocator.allocate(size, alignment))
+                {
+                    staging_ring = &ring;
+                    offset = *allocation;
+                    break;
+                }
+
+            // All the rings are used by uploads in flight, add one instead of waiting for them
+            if (!staging_ring)
+            {
+                const std::size_t ring_size = std::max(m_ringSize, size);
+                auto buffer = m_factory.createBuffer(BufferType::Other, BufferUsage::Staging, ring_size, 1);
+                auto* memory = static_cast<std::byte*>(buffer->mappedMemory());
+                if (!memory)
+                    throw base::NullPointerException("The staging buffer is not persistently mapped.");
+
+                staging_ring = &m_rings.emplace_back(Ring {std::move(buffer), memory, RingAllocator(ring_size)});
+                offset = *staging_ring->allocator.allocate(size, alignment);
+            }
+
+            std::memcpy(staging_ring->memory + offset, data, size);
+            if (!m_commandBuffer)
+                m_commandBuffer = m_queue.createCommandBuffer(true, false);
+            ++m_pendingUploads;
+            return {staging_ring, offset};
+        }
+
+    private:
+        const IGraphicsFactory& m_factory;
+        const ICommandQueue& m_queue;
+        std::size_t m_ringSize;
+
+        std::vector<Ring> m_rings;
+        std::shared_ptr<ICommandBuffer> m_commandBuffer;
+        std::size_t m_pendingUploads = 0;
+        std::size_t m_lastFence = 0;
+    };
+
+    UploadManager::UploadManager(const IGraphicsFactory& factory, const ICommandQueue& queue, const std::size_t ring_size)
+        : m_impl(std::make_unique<Impl>(factory, queue, ring_size)) {}
+
+    UploadManager::~UploadManager() = default;
+
+    void UploadManager::upload(const void* data, const std::size_t size, IBuffer& target, const std::size_t target_offset)
+    {
+        if (target.size() < target_offset + size)
+            throw base::ArgumentOutOfRangeException(std::format("The target buffer has only {0} bytes, but an upload of {1} bytes starting from byte {2} has been requested.",
+                                                                target.size(),
+                                                                size,
+                                                                target_offset));
+        if (size == 0)
+            return;
+
+        const auto [ring, offset] = m_impl->stage(data, size, s_bufferAlignment);
+        m_impl->m_commandBuffer->copy(*ring->buffer, target, offset, target_offset, size);
+    }
+
+    void UploadManager::upload(const void* data, const std::size_t size, IImage& target, const unsigned subresource)
+    {
+        if (target.elements() <= subresource)
+            throw base::ArgumentOutOfRangeException(std::format("The target image has only {0} sub-resources, but an upload to sub-resource {1} has been requested.",
+                                                                target.elements(),
+                                                                subresource));
+
+        const auto [ring, offset] = m_impl->stage(data, size, s_imageAlignment);
+        m_impl->m_commandBuffer->copy(*ring->buffer, target, offset, subresource);
+    }
+
+    std::size_t UploadManager::flush()
+    {
+        if (!m_impl->m_commandBuffer)
+            return m_impl->m_lastFence;
+
+        // The queue holds the command buffers of the previous uploads until it is waited for, which nothing else may do if it only receives uploads
+        m_impl->m_queue.waitFor(m_impl->m_queue.completedFence());
+
+        // Make the uploaded buffers readable by the next commands, the images are already transitioned by their copy
+        m_impl->m_commandBuffer->transferBarrier();
+        m_impl->m_lastFence = m_impl->m_queue.submit(std::exchange(m_impl->m_commandBuffer, nullptr));
+        m_impl->m_pendingUploads = 0;
+
+        for (Impl::Ring& ring : m_impl->m_rings)
+            ring.allocator.submit(m_impl->m_lastFence);
+        return m_impl->m_lastFence;
+    }
+
+    std::size_t UploadManager::lastFence() const noexcept
+    {
+        return m_impl->m_lastFence;
+    }
+
+    std::size_t UploadManager::pendingUploads() const noexcept
+    {
+        return m_impl->m_pendingUploads;
+    }
+
+    std::size_t UploadManager::ringCount() const noexcept
+    {
+        return m_impl->m_rings.size();
+    }
+}
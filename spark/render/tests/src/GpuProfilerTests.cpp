@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+
+#include "spark/render/GpuProfiler.h"
+
+namespace spark::render::testing
+{
+    TEST(GpuProfilerShould, mergeTheSamplesWithTheSameNameInTheOrderTheyAppear)
+    {
+        // Given the samples of a frame where a pass was split in two parts, and another pass was recorded between them
+        const std::vector<GpuProfileSample> samples = {
+            {.name = "Geometry", .beginTicks = 100, .endTicks = 300, .statistics = {.inputPrimitives = 10, .fragmentShaderInvocations = 400}},
+            {.name = "ImGui", .beginTicks = 500, .endTicks = 600, .statistics = {.inputPrimitives = 2}},
+            {.name = "Geometry", .beginTicks = 300, .endTicks = 400, .statistics = {.inputPrimitives = 6, .fragmentShaderInvocations = 100}},
+        };
+
+        // When merging them with 100 ticks per millisecond
+        const auto scopes = merge_profile_samples(samples, 100.0);
+
+        // Then, each name has one scope with the sum of the durations and statistics of its samples
+        ASSERT_EQ(scopes.size(), 2);
+        EXPECT_EQ(scopes[0].name, "Geometry");
+        EXPECT_DOUBLE_EQ(scopes[0].milliseconds, 3.0);
+        EXPECT_EQ(scopes[0].statistics, (PipelineStatistics {.inputPrimitives = 16, .fragmentShaderInvocations = 500}));
+        EXPECT_EQ(scopes[0].scopes, 2);
+        EXPECT_EQ(scopes[1].name, "ImGui");
+        EXPECT_DOUBLE_EQ(scopes[1].milliseconds, 1.0);
+        EXPECT_EQ(scopes[1].scopes, 1);
+    }
+
+    TEST(GpuProfilerShould, measureTheScopesWhoseTimestampsWrappedAround)
+    {
+        // Given a sample whose 36-bits timestamps wrapped around, with garbage in the invalid bits
+        const std::uint64_t wrap = std::uint64_t {1} << 36;
+        const std::vector<GpuProfileSample> samples = {
+            {.name = "Geometry", .beginTicks = (wrap - 50) | (wrap << 1), .endTicks = 150 | (wrap << 2), .statistics = {}},
+        };
+
+        // When merging it
+        const auto scopes = merge_profile_samples(samples, 1.0, 36);
+
+        // Then, only the valid bits are used to measure it
+        ASSERT_EQ(scopes.size(), 1);
+        EXPECT_DOUBLE_EQ(scopes[0].milliseconds, 200.0);
+    }
+}
@@ -0,0 +1,211 @@
+#include "gtest/gtest.h"
+
+#include "spark/render/RenderGraph.h"
+
+#include "spark/base/Exception.h"
+
+#include <string>
+#include <vector>
+
+namespace spark::render::testing
+{
+    namespace
+    {
+        /**
+         * \brief Adds a transient color attachment of 800x600 pixels to a graph.
+         */
+        std::size_t add_color(RenderGraph& graph, std::string name, const Format format = Format::R8G8B8A8_UNORM)
+        {
+            return graph.addAttachment({.name = std::move(name), .type = RenderTargetType::Color, .format = format, .size = {800, 600}});
+        }
+
+        /**
+         * \brief Gets the names of the passes of a compiled graph, in their order of execution.
+         */
+        std::vector<std::string> pass_names(const RenderGraph& graph)
+        {
+            std::vector<std::string> names;
+            for (const RenderGraphPass* pass : graph.passes())
+                names.push_back(pass->name());
+            return names;
+        }
+    }
+
+    TEST(RenderGraphShould, orderThePassesFromTheirAttachments)
+    {
+        // Given a graph whose passes are added in reverse order: shadows and geometry are composed, then presented
+        RenderGraph graph;
+        add_color(graph, "Shadows");
+        add_color(graph, "Scene");
+        graph.addAttachment({.name = "Back Buffer", .type = RenderTargetType::Present, .format = Format::B8G8R8A8_UNORM, .size = {800, 600}});
+        graph.addPass("Compose", {}).read("Shadows").read("Scene").write("Back Buffer");
+        graph.addPass("Geometry", {}).write("Scene");
+        graph.addPass("Shadows", {}).write("Shadows");
+        graph.setOutput("Back Buffer");
+
+        // When compiling it
+        graph.compile();
+
+        // Then, the independent passes share the first level and the composition runs after them
+        EXPECT_EQ(pass_names(graph), (std::vector<std::string> {"Geometry", "Shadows", "Compose"}));
+        EXPECT_EQ(graph.passes()[0]->level(), 0);
+        EXPECT_EQ(graph.passes()[1]->level(), 0);
+        EXPECT_EQ(graph.passes()[2]->level(), 1);
+    }
+
+    TEST(RenderGraphShould, keepTheOrderOfThePassesWritingTheSameAttachment)
+    {
+        // Given a graph where the geometry, then the UI, are drawn to the back buffer
+        RenderGraph graph;
+        graph.addAttachment({.name = "Back Buffer", .type = RenderTargetType::Present, .format = Format::B8G8R8A8_UNORM, .size = {800, 600}});
+        graph.addPass("Geometry", {}).write("Back Buffer");
+        graph.addPass("UI", {}).write("Back Buffer");
+        graph.setOutput("Back Buffer");
+
+        // When compiling it
+        graph.compile();
+
+        // Then, the UI is drawn over the geometry
+        EXPECT_EQ(pass_names(graph), (std::vector<std::string> {"Geometry", "UI"}));
+        EXPECT_EQ(graph.passes()[1]->level(), 1);
+    }
+
+    TEST(RenderGraphShould, cullThePassesNotContributingToTheOutput)
+    {
+        // Given a graph with a debug pass whose attachment is never read
+        RenderGraph graph;
+        add_color(graph, "Debug");
+        add_color(graph, "Output");
+        graph.addPass("Debug", {}).write("Debug");
+        graph.addPass("Geometry", {}).write("Output");
+        graph.setOutput("Output");
+
+        // When compiling it
+        graph.compile();
+
+        // Then, the debug pass is not executed and its attachment is not allocated
+        EXPECT_EQ(pass_names(graph), (std::vector<std::string> {"Geometry"}));
+        EXPECT_FALSE(graph.physicalAttachment(graph.attachmentIndex("Debug")).has_value());
+    }
+
+    TEST(RenderGraphShould, rejectTheCyclesAndTheUnknownAttachments)
+    {
+        // Given a graph where two passes read the attachment written by the other one
+        RenderGraph graph;
+        add_color(graph, "A");
+        add_color(graph, "B");
+        graph.addPass("First", {}).read("A").write("B");
+        graph.addPass("Second", {}).read("B").write("A");
+        graph.setOutput("A");
+
+        // When compiling it, or declaring attachments which do not exist
+        // Then, an exception is thrown
+        EXPECT_THROW(graph.compile(), base::BadArgumentException);
+        EXPECT_THROW(graph.addPass("Third", {}).read("C"), base::BadArgumentException);
+        EXPECT_THROW(add_color(graph, "A"), base::BadArgumentException);
+        EXPECT_THROW(graph.execute([](std::size_t) -> const ICommandBuffer& { throw std::exception(); }), base::BadArgumentException);
+    }
+
+    TEST(RenderGraphShould, transitionTheAttachmentsBetweenThePasses)
+    {
+        // Given a graph drawing a scene with depth, then sampling it to the back buffer
+        RenderGraph graph;
+        const std::size_t scene = add_color(graph, "Scene");
+        const std::size_t depth = graph.addAttachment({.name = "Depth", .type = RenderTargetType::DepthStencil, .format = Format::D32_SFLOAT, .size = {800, 600}});
+        const std::size_t back_buffer = graph.addAttachment({.name = "Back Buffer", .type = RenderTargetType::Present, .format = Format::B8G8R8A8_UNORM, .size = {800, 600}});
+        graph.addPass("Geometry", {}).write("Scene").write("Depth");
+        graph.addPass("Post Process", {}).read("Scene").write("Back Buffer");
+        graph.setOutput("Back Buffer");
+
+        // When compiling it
+        graph.compile();
+
+        // Then, each attachment is moved to the state needed by each pass, and the back buffer is presented at the end
+        const std::vector<AttachmentBarrier> geometry(graph.passes()[0]->barriers().begin(), graph.passes()[0]->barriers().end());
+        EXPECT_EQ(geometry,
+                  (std::vector<AttachmentBarrier> {{scene, AttachmentState::Undefined, AttachmentState::ColorAttachment},
+                                                   {depth, AttachmentState::Undefined, AttachmentState::DepthStencilAttachment}}));
+        const std::vector<AttachmentBarrier> post_process(graph.passes()[1]->barriers().begin(), graph.passes()[1]->barriers().end());
+        EXPECT_EQ(post_process,
+                  (std::vector<AttachmentBarrier> {{back_buffer, AttachmentState::Undefined, AttachmentState::ColorAttachment},
+                                                   {scene, AttachmentState::ColorAttachment, AttachmentState::ShaderRead}}));
+        ASSERT_EQ(graph.finalBarriers().size(), 1);
+        EXPECT_EQ(graph.finalBarriers()[0], (AttachmentBarrier {back_buffer, AttachmentState::ColorAttachment, AttachmentState::Present}));
+    }
+
+    TEST(RenderGraphShould, shareTheMemoryOfTheAttachmentsNeverUsedAtTheSameTime)
+    {
+        // Given a chain of passes where each one reads the attachment of the previous one
+        RenderGraph graph;
+        const std::size_t first = add_color(graph, "First");
+        const std::size_t second = add_color(graph, "Second");
+        const std::size_t third = add_color(graph, "Third");
+        const std::size_t other_format = add_color(graph, "Fourth", Format::R16G16B16A16_SFLOAT);
+        const std::size_t output = add_color(graph, "Output");
+        graph.addPass("1", {}).write("First");
+        graph.addPass("2", {}).read("First").write("Second");
+        graph.addPass("3", {}).read("Second").write("Third");
+        graph.addPass("4", {}).read("Third").write("Fourth");
+        graph.addPass("5", {}).read("Fourth").write("Output");
+        graph.setOutput("Output");
+
+        // When compiling it
+        graph.compile();
+
+        // Then, an attachment reuses the memory of the ones which are not used anymore, if they have the same format and size
+        EXPECT_EQ(graph.physicalAttachment(first), graph.physicalAttachment(third));
+        EXPECT_NE(graph.physicalAttachment(first), graph.physicalAttachment(second));
+        EXPECT_EQ(graph.physicalAttachment(third), graph.physicalAttachment(output));
+        EXPECT_NE(graph.physicalAttachment(other_format), graph.physicalAttachment(first));
+        EXPECT_EQ(graph.physicalAttachmentCount(), 3);
+    }
+
+    TEST(RenderGraphShould, executeThePassesLevelByLevel)
+    {
+        // Given a graph with two independent passes and one depending on both
+        RenderGraph graph;
+        add_color(graph, "A");
+        add_color(graph, "B");
+        add_color(graph, "Output");
+        graph.addPass("A", {}).write("A");
+        graph.addPass("B", {}).write("B");
+        graph.addPass("Output", {}).read("A").read("B").write("Output");
+        graph.setOutput("Output");
+        graph.compile();
+
+        // When executing it
+        std::vector<std::size_t> levels;
+        graph.execute([](std::size_t) -> const ICommandBuffer& { throw std::exception(); },
+                      [&](const std::size_t count, const auto&) { levels.push_back(count); });
+
+        // Then, the passes of each level are given together to the executor
+        EXPECT_EQ(levels, (std::vector<std::size_t> {2, 1}));
+    }
+
+    TEST(RenderGraphShould, recordTheSplitPassesIntoConsecutiveCommandBuffers)
+    {
+        // Given a graph where a pass split in 3 parts and another pass are independent, and a last pass depends on both
+        RenderGraph graph;
+        add_color(graph, "A");
+        add_color(graph, "B");
+        add_color(graph, "Output");
+        graph.addPass("A", 3, {}).write("A");
+        graph.addPass("B", {}).write("B");
+        graph.addPass("Output", {}).read("A").read("B").write("Output");
+        graph.setOutput("Output");
+        graph.compile();
+
+        // When executing it
+        std::vector<std::size_t> levels;
+        graph.execute([](std::size_t) -> const ICommandBuffer& { throw std::exception(); },
+                      [&](const std::size_t count, const auto&) { levels.push_back(count); });
+
+        // Then, each part has its own command buffer, and all the parts of a level are given together to the executor
+        EXPECT_EQ(graph.commandBufferCount(), 5);
+        EXPECT_EQ(graph.passes()[0]->parts(), 3);
+        EXPECT_EQ(graph.passes()[1]->firstCommandBuffer(), 3);
+        EXPECT_EQ(graph.passes()[2]->firstCommandBuffer(), 4);
+        EXPECT_EQ(levels, (std::vector<std::size_t> {4, 1}));
+        EXPECT_THROW(graph.addPass("Empty", 0, {}), base::BadArgumentException);
+    }
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include "spark/render/RingAllocator.h"
+
+namespace spark::render::testing
+{
+    TEST(RingAllocatorShould, allocateTheRangesOneAfterAnother)
+    {
+        // Given an empty ring of 256 bytes
+        RingAllocator ring(256);
+
+        // When allocating aligned ranges
+        const auto first = ring.allocate(10);
+        const auto second = ring.allocate(32, 16);
+        const auto third = ring.allocate(8, 16);
+
+        // Then, they follow each other at their alignment, and the padding is counted as used
+        EXPECT_EQ(first, 0);
+        EXPECT_EQ(second, 16);
+        EXPECT_EQ(third, 48);
+        EXPECT_EQ(ring.used(), 56);
+    }
+
+    TEST(RingAllocatorShould, notAllocateMoreThanItsSize)
+    {
+        // Given a ring of 64 bytes, with 48 of them allocated
+        RingAllocator ring(64);
+        ASSERT_TRUE(ring.allocate(48).has_value());
+
+        // When allocating more than the free bytes, or more than the whole ring
+        const auto too_large = ring.allocate(32);
+        const auto larger_than_ring = RingAllocator(64).allocate(65);
+
+        // Then, the allocations fail without using memory
+        EXPECT_FALSE(too_large.has_value());
+        EXPECT_FALSE(larger_than_ring.has_value());
+        EXPECT_EQ(ring.used(), 48);
+    }
+
+    TEST(RingAllocatorShould, releaseTheRangesOnceTheirFenceIsCompleted)
+    {
+        // Given a ring with ranges submitted with the fences 1 and 2, and a range not submitted yet
+        RingAllocator ring(256);
+        ASSERT_TRUE(ring.allocate(64).has_value());
+        ring.submit(1);
+        ASSERT_TRUE(ring.allocate(32).has_value());
+        ring.submit(2);
+        ASSERT_TRUE(ring.allocate(16).has_value());
+
+        // When the GPU completed the fence 1, then the fence 2
+        ring.release(1);
+        const std::size_t used_after_first = ring.used();
+        ring.release(2);
+
+        // Then, only the ranges of the completed fences are released, the one not submitted stays used
+        EXPECT_EQ(used_after_first, 48);
+        EXPECT_EQ(ring.used(), 16);
+    }
+
+    TEST(RingAllocatorShould, wrapToTheBeginningOnceItIsReleased)
+    {
+        // Given a ring of 100 bytes whose first 60 bytes are released, and the next 30 are still used
+        RingAllocator ring(100);
+        ASSERT_TRUE(ring.allocate(60).has_value());
+        ring.submit(1);
+        ASSERT_TRUE(ring.allocate(30).has_value());
+        ring.submit(2);
+        ring.release(1);
+
+        // When allocating a range which does not fit in the 10 bytes left at the end of the ring
+        const auto wrapped = ring.allocate(40);
+        const auto too_large = ring.allocate(40);
+
+        // Then, the range starts at the beginning and the skipped bytes stay used until the range is released
+        EXPECT_EQ(wrapped, 0);
+        EXPECT_FALSE(too_large.has_value());
+        EXPECT_EQ(ring.used(), 80);
+
+        ring.submit(3);
+        ring.release(3);
+        EXPECT_EQ(ring.used(), 0);
+    }
+
+    TEST(RingAllocatorShould, startAgainFromTheBeginningWhenEmpty)
+    {
+        // Given a ring whose ranges were all released
+        RingAllocator ring(128);
+        ASSERT_TRUE(ring.allocate(100).has_value());
+        ring.submit(1);
+        ring.release(1);
+
+        // When allocating a range larger than the bytes after the previous ranges
+        const auto allocation = ring.allocate(120);
+
+        // Then, it is allocated from the beginning of the ring without wasting the end of the ring
+        EXPECT_EQ(allocation, 0);
+        EXPECT_EQ(ring.used(), 120);
+    }
+}
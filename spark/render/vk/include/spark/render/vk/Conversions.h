@@ -1007,4 +1007,41 @@ namespace spark::render::vk::conversions
         }
         throw base::BadArgumentException("Unsupported image dimensions.");
     }
+
+    /**
+     * \brief Converts a \ref ImageLayout to a \ref VkImageLayout.
+     * \param layout The \ref ImageLayout to convert.
+     * \return A \ref VkImageLayout value representing the \ref ImageLayout.
+     *
+     * \throws base::BadArgumentException If the \ref ImageLayout is not supported.
+     */
+    [[nodiscard]] SPARK_RENDER_VK_EXPORT constexpr VkImageLayout to_image_layout(const ImageLayout layout)
+    {
+        switch (layout)
+        {
+        case ImageLayout::Common:
+        case ImageLayout::ReadWrite:
+            return VK_IMAGE_LAYOUT_GENERAL;
+        case ImageLayout::ShaderResource:
+            return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        case ImageLayout::CopySource:
+            return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        case ImageLayout::CopyDestination:
+            return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        case ImageLayout::RenderTarget:
+        case ImageLayout::ResolveDestination:
+            return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        case ImageLayout::DepthRead:
+            return VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        case ImageLayout::DepthWrite:
+            return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        case ImageLayout::Present:
+            return VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        case ImageLayout::ResolveSource:
+            return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        case ImageLayout::Undefined:
+            return VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        throw base::BadArgumentException("Unsupported image layout.");
+    }
 }
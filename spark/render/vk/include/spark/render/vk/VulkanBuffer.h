@@ -139,6 +139,9 @@ namespace spark::render::vk
         /// \copydoc IMappable::map()
         void map(std::span<void*> data, size_t element_size, unsigned first_element, bool write) override;
 
+        /// \copydoc IMappable::mappedMemory()
+        [[nodiscard]] void* mappedMemory() const noexcept override;
+
     private:
         struct Impl;
         std::unique_ptr<Impl> m_impl;
@@ -9,7 +9,11 @@
 #include "spark/render/vk/VulkanPipelineLayout.h"
 #include "spark/render/vk/VulkanVertexBuffer.h"
 
+#include <span>
+
 SPARK_FWD_DECLARE_VK_HANDLE(VkCommandBuffer)
+SPARK_FWD_DECLARE_VK_HANDLE(VkCommandPool)
+struct VkImageMemoryBarrier;
 
 namespace spark::render::vk
 {
@@ -29,6 +33,16 @@ namespace spark::render::vk
     {
     public:
         explicit VulkanCommandBuffer(const VulkanQueue& queue, bool begin_recording = false, bool is_primary = true);
+
+        /**
+         * \brief Initializes a primary command buffer allocated from \p command_pool, which frees it when it is destroyed or reset.
+         * \param queue The queue the command buffer is submitted to.
+         * \param command_pool The command pool to allocate the command buffer from, created for the family of \p queue.
+         * \param begin_recording `true` to begin recording the command buffer, `false` otherwise.
+         *
+         * \note The command buffer does not free itself, it must not be used anymore once its command pool is reset or destroyed.
+         */
+        explicit VulkanCommandBuffer(const VulkanQueue& queue, VkCommandPool command_pool, bool begin_recording = false);
         ~VulkanCommandBuffer() override;
 
         VulkanCommandBuffer(const VulkanCommandBuffer& other) = delete;
@@ -54,6 +68,12 @@ namespace spark::render::vk
         /// \copydoc ICommandBuffer::isSecondary()
         [[nodiscard]] bool isSecondary() const noexcept override;
 
+        /// \copydoc ICommandBuffer::beginProfileScope()
+        void beginProfileScope(std::string_view name) const override;
+
+        /// \copydoc ICommandBuffer::endProfileScope()
+        void endProfileScope() const override;
+
         /// \copydoc ICommandBuffer::transfer()
         void transfer(IVulkanBuffer& source, IVulkanBuffer& target, unsigned source_element, unsigned target_element, unsigned elements) const override;
 
@@ -78,6 +98,15 @@ namespace spark::render::vk
         /// \copydoc ICommandBuffer::transfer()
         void transfer(std::shared_ptr<IVulkanImage> source, IVulkanBuffer& target, unsigned first_subresource, unsigned target_element, unsigned subresources) const override;
 
+        /// \copydoc ICommandBuffer::copy()
+        void copy(IVulkanBuffer& source, IVulkanBuffer& target, std::size_t source_offset, std::size_t target_offset, std::size_t size) const override;
+
+        /// \copydoc ICommandBuffer::copy()
+        void copy(IVulkanBuffer& source, IVulkanImage& target, std::size_t source_offset, unsigned subresource) const override;
+
+        /// \copydoc ICommandBuffer::transferBarrier()
+        void transferBarrier() const noexcept override;
+
         /// \copydoc ICommandBuffer::use()
         void use(const VulkanPipelineState& pipeline) const noexcept override;
 
@@ -113,8 +142,14 @@ namespace spark::render::vk
                          int vertex_offset,
                          unsigned first_instance) const noexcept override;
 
+        /// \copydoc ICommandBuffer::drawIndexedIndirect()
+        void drawIndexedIndirect(const IVulkanBuffer& arguments, unsigned first_draw, unsigned draws) const noexcept override;
+
         /// \copydoc ICommandBuffer::dispatch()
-        void dispatch() const noexcept override;
+        void dispatch(const math::Vector3<unsigned>& thread_groups) const noexcept override;
+
+        /// \copydoc ICommandBuffer::dispatchBarrier()
+        void dispatchBarrier() const noexcept override;
 
         /// \copydoc ICommandBuffer::execute()
         void execute(std::shared_ptr<const VulkanCommandBuffer> command_buffer) const override;
@@ -146,6 +181,24 @@ namespace spark::render::vk
         /// \copydoc ICommandBuffer::releaseSharedState()
         void releaseSharedState() const override;
 
+        /**
+         * \brief Resets the command buffer to its initial state, so that it can be recorded again.
+         *
+         * Resets the command pool of the secondary command buffers, which have their own one. The primary ones are reset along with the whole command pool
+         * they are allocated from by its owner.
+         *
+         * \note The command buffer must not be used by the GPU anymore.
+         */
+        void reset() const noexcept;
+
+        /**
+         * \brief Gets the barriers releasing the ownership of the images copied by the command buffer to the family of the graphics queue.
+         * \return The barriers releasing the ownership of the images, to acquire on the graphics queue once the command buffer is executed.
+         *
+         * The command buffers of a queue of another family than the graphics queue release the images they copy to it, so that they can be sampled.
+         */
+        [[nodiscard]] std::span<const VkImageMemoryBarrier> ownershipReleases() const noexcept;
+
     private:
         struct Impl;
         std::unique_ptr<Impl> m_impl;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "spark/base/Macros.h"
+#include "spark/render/ComputePipeline.h"
+#include "spark/render/vk/Export.h"
+#include "spark/render/vk/VulkanPipeline.h"
+
+namespace spark::render::vk
+{
+    class VulkanDevice;
+    class VulkanShaderProgram;
+    class VulkanPipelineLayout;
+    class VulkanDescriptorSet;
+
+    SPARK_WARNING_PUSH
+    SPARK_DISABLE_MSVC_WARNING(4250) // 'VulkanComputePipeline': inherits 'StateResource::name' via dominance
+
+    /**
+     * \brief Vulkan implementation of \ref IComputePipeline.
+     */
+    class SPARK_RENDER_VK_EXPORT VulkanComputePipeline final : public ComputePipeline<VulkanPipelineLayout, VulkanShaderProgram>, public VulkanPipelineState
+    {
+    public:
+        /**
+         * \brief Initializes a new \ref VulkanComputePipeline.
+         * \param device The parent \ref VulkanDevice.
+         * \param shader_program The \ref VulkanShaderProgram used by this pipeline, which must only contain a compute shader.
+         * \param layout The \ref VulkanPipelineLayout of the pipeline, usually reflected from the \p shader_program.
+         * \param name The optional name of the compute pipeline.
+         *
+         * \throws base::BadArgumentException If the \p shader_program does not contain exactly one compute shader.
+         */
+        explicit VulkanComputePipeline(const VulkanDevice& device,
+                                       std::shared_ptr<VulkanShaderProgram> shader_program,
+                                       std::shared_ptr<VulkanPipelineLayout> layout,
+                                       const std::string& name = "");
+        ~VulkanComputePipeline() override;
+
+        VulkanComputePipeline(const VulkanComputePipeline& other) = delete;
+        VulkanComputePipeline(VulkanComputePipeline&& other) noexcept = delete;
+        VulkanComputePipeline& operator=(const VulkanComputePipeline& other) = delete;
+        VulkanComputePipeline& operator=(VulkanComputePipeline&& other) noexcept = delete;
+
+        /// \copydoc IComputePipeline::program()
+        [[nodiscard]] std::shared_ptr<const VulkanShaderProgram> program() const noexcept override;
+
+        /// \copydoc IComputePipeline::layout()
+        [[nodiscard]] std::shared_ptr<VulkanPipelineLayout> layout() const noexcept override;
+
+        /// \copydoc IComputePipeline::threadGroupSize()
+        [[nodiscard]] math::Vector3<unsigned> threadGroupSize() const noexcept override;
+
+        /// \copydoc VulkanPipelineState::use()
+        void use(const VulkanCommandBuffer& command_buffer) const noexcept override;
+
+        /// \copydoc VulkanPipelineState::bind()
+        void bind(const VulkanCommandBuffer& command_buffer, const VulkanDescriptorSet& descriptor_set) const noexcept override;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+
+    SPARK_WARNING_POP
+}
@@ -6,28 +6,39 @@
 #include "spark/render/Resource.h"
 #include "spark/render/vk/Export.h"
 #include "spark/render/vk/Helpers.h"
+#include "spark/render/vk/VulkanComputePipeline.h"
 #include "spark/render/vk/VulkanFactory.h"
 #include "spark/render/vk/VulkanGraphicsAdapter.h"
+#include "spark/render/vk/VulkanProfiler.h"
 #include "spark/render/vk/VulkanQueue.h"
 #include "spark/render/vk/VulkanRenderPass.h"
 #include "spark/render/vk/VulkanSurface.h"
 #include "spark/render/vk/VulkanSwapChain.h"
 
+#include <filesystem>
+
 SPARK_FWD_DECLARE_VK_HANDLE(VkDevice)
+SPARK_FWD_DECLARE_VK_HANDLE(VkPipelineCache)
 
 namespace spark::render::vk
 {
     /**
      * \brief Vulkan implementation of \ref IGraphicsDevice.
      */
-    class SPARK_RENDER_VK_EXPORT VulkanDevice final : public GraphicsDevice<VulkanFactory, VulkanSurface, VulkanGraphicsAdapter, VulkanSwapChain, VulkanQueue, VulkanRenderPass>,
+    class SPARK_RENDER_VK_EXPORT VulkanDevice final : public GraphicsDevice<VulkanFactory,
+                                                                            VulkanSurface,
+                                                                            VulkanGraphicsAdapter,
+                                                                            VulkanSwapChain,
+                                                                            VulkanQueue,
+                                                                            VulkanRenderPass,
+                                                                            VulkanComputePipeline>,
                                                       public Resource<VkDevice>
     {
     public:
         /**
          * \brief Initializes a new \ref VulkanDevice.
          * \param adapter The adapter to use for drawing.
-         * \param surface The surface the device will draw to.
+         * \param surface The surface the device will draw to. A surface without handle makes the device headless, see \ref isHeadless().
          * \param extensions The required extensions for the device to be initialized with.
          */
         explicit VulkanDevice(const VulkanGraphicsAdapter& adapter, std::unique_ptr<VulkanSurface>&& surface, std::span<std::string> extensions = {});
@@ -35,7 +46,7 @@ namespace spark::render::vk
         /**
          * \brief Initializes a new \ref VulkanDevice.
          * \param adapter The adapter to use for drawing.
-         * \param surface The surface the device will draw to.
+         * \param surface The surface the device will draw to. A surface without handle makes the device headless, see \ref isHeadless().
          * \param format The initial format of the swap chain.
          * \param frame_buffer_size The initial size of the frame buffers.
          * \param frame_buffers The initial number of frame buffers to use.
@@ -60,15 +71,39 @@ namespace spark::render::vk
          */
         [[nodiscard]] std::span<std::string> enabledExtensions() const noexcept;
 
+        /**
+         * \brief Checks if the device draws to offscreen images instead of a surface.
+         * \return `true` if the device was created with a surface without handle, `false` otherwise.
+         *
+         * A headless device does not require any presentation support, so that it can run on machines without display or with a software implementation
+         * (lavapipe, SwiftShader). Its swap chain is made of offscreen images, which can be read back with \ref VulkanSwapChain::readBack().
+         */
+        [[nodiscard]] bool isHeadless() const noexcept;
+
         /// \copydoc GraphicsDevice::maximumMultiSamplingLevel()
         [[nodiscard]] MultiSamplingLevel maximumMultiSamplingLevel(Format format) const noexcept override;
 
         /// \copydoc GraphicsDevice::ticksPerMillisecond()
         [[nodiscard]] double ticksPerMillisecond() const noexcept override;
 
+        /// \copydoc GraphicsDevice::profiler()
+        [[nodiscard]] const VulkanProfiler& profiler() const noexcept override;
+
         /// \copydoc GraphicsDevice::wait()
         void wait() const override;
 
+        /// \copydoc IGraphicsDevice::loadPipelineCache()
+        void loadPipelineCache(const std::filesystem::path& directory) override;
+
+        /// \copydoc IGraphicsDevice::savePipelineCache()
+        void savePipelineCache() const override;
+
+        /**
+         * \brief Gets the pipeline cache through which all the pipelines of the device are created.
+         * \return The \ref VkPipelineCache of the device, which lives as long as the device.
+         */
+        [[nodiscard]] VkPipelineCache pipelineCache() const noexcept;
+
         /// \copydoc GraphicsDevice::state()
         [[nodiscard]] DeviceState& state() noexcept override;
 
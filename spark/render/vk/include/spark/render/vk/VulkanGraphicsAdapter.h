@@ -56,6 +56,18 @@ namespace spark::render::vk
         /// \copydoc IGraphicsAdapter::dedicatedVideoMemory()
         [[nodiscard]] unsigned long long dedicatedVideoMemory() const noexcept override;
 
+        /**
+         * \brief Gets the identifier of the driver of the physical device.
+         * \return A \ref lib::Uuid identifying the driver and its version.
+         */
+        [[nodiscard]] lib::Uuid driverUuid() const noexcept;
+
+        /**
+         * \brief Gets the identifier of the pipeline caches the physical device can load.
+         * \return A \ref lib::Uuid which changes whenever the driver cannot reuse the pipelines compiled by another version.
+         */
+        [[nodiscard]] lib::Uuid pipelineCacheUuid() const noexcept;
+
         /**
          * \brief Gets the limits of the physical device.
          * \return A \ref VkPhysicalDeviceLimits struct containing the limits of the physical device.
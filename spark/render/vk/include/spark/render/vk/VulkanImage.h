@@ -53,6 +53,13 @@ namespace spark::render::vk
          * \return A \ref VkImageView representing the image view for the given sub-resource.
          */
         [[nodiscard]] virtual const VkImageView& imageView(unsigned int plane = 0) const = 0;
+
+        /**
+         * \brief Records the layout a sub-resource was transitioned to by a barrier.
+         * \param sub_resource The sub-resource index whose layout changed.
+         * \param layout The new \ref ImageLayout of the sub-resource.
+         */
+        virtual void setLayout(unsigned int sub_resource, ImageLayout layout) = 0;
     };
 
     SPARK_WARNING_PUSH
@@ -218,6 +225,9 @@ namespace spark::render::vk
         /// \copydoc IVulkanImage::layout()
         [[nodiscard]] ImageLayout layout(unsigned sub_resource) const override;
 
+        /// \copydoc IVulkanImage::setLayout()
+        void setLayout(unsigned sub_resource, ImageLayout layout) override;
+
     private:
         struct Impl;
         std::unique_ptr<Impl> m_impl;
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "spark/render/GpuProfiler.h"
+#include "spark/render/vk/Export.h"
+#include "spark/render/vk/Helpers.h"
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+SPARK_FWD_DECLARE_VK_HANDLE(VkCommandBuffer)
+
+namespace spark::render::vk
+{
+    class VulkanDevice;
+
+    /**
+     * \brief Vulkan implementation of \ref IGpuProfiler, which owns the timestamp and pipeline statistics query pools of a \ref VulkanDevice.
+     *
+     * The query pools are split between \ref Frames frames used in turn. When a frame is begun, the queries of the frame which used them \ref Frames
+     * frames before are read if they are all available, and reset from the host. Otherwise, they are kept for the next turn and the new frame is not
+     * profiled, so that reading the results never waits for the GPU.
+     */
+    class SPARK_RENDER_VK_EXPORT VulkanProfiler final : public IGpuProfiler
+    {
+    public:
+        /// \brief The number of frames whose queries are used in turn, which should be greater than the number of frames the GPU draws at once.
+        static constexpr unsigned Frames = 8;
+
+        /// \brief The maximum number of scopes of a frame. A frame with more scopes is not profiled.
+        static constexpr unsigned MaxScopes = 128;
+
+        /**
+         * \brief Initializes a new \ref VulkanProfiler.
+         * \param device The device owning the profiler.
+         * \param timestamp_bits The number of valid bits of the timestamps written by the graphics queue. The profiler is disabled if it is 0.
+         * \param pipeline_statistics `true` if the device enables the pipeline statistics queries, `false` to only measure the time of the scopes.
+         */
+        explicit VulkanProfiler(const VulkanDevice& device, unsigned timestamp_bits, bool pipeline_statistics);
+        ~VulkanProfiler() override;
+
+        VulkanProfiler(const VulkanProfiler& other) = delete;
+        VulkanProfiler(VulkanProfiler&& other) noexcept = delete;
+        VulkanProfiler& operator=(const VulkanProfiler& other) = delete;
+        VulkanProfiler& operator=(VulkanProfiler&& other) noexcept = delete;
+
+        /**
+         * \brief Begins a scope of the current frame, by writing its begin timestamp into \p command_buffer. This can be called by several threads at once.
+         * \param command_buffer The command buffer recording the scope.
+         * \param name The name of the scope.
+         * \param statistics `true` to also count the pipeline statistics of the scope, which must not be done by another scope of the command buffer.
+         * \return The index of the scope to end, or `std::nullopt` if the scope is not measured.
+         */
+        [[nodiscard]] std::optional<unsigned> beginScope(VkCommandBuffer command_buffer, std::string_view name, bool statistics) const;
+
+        /**
+         * \brief Ends a scope begun by \ref beginScope(), by writing its end timestamp into \p command_buffer.
+         * \param command_buffer The command buffer recording the scope.
+         * \param scope The index of the scope.
+         */
+        void endScope(VkCommandBuffer command_buffer, unsigned scope) const noexcept;
+
+        /// \copydoc IGpuProfiler::isEnabled()
+        [[nodiscard]] bool isEnabled() const noexcept override;
+
+        /// \copydoc IGpuProfiler::beginFrame()
+        void beginFrame() const override;
+
+        /// \copydoc IGpuProfiler::results()
+        [[nodiscard]] std::span<const GpuProfileScope> results() const noexcept override;
+
+        /// \copydoc IGpuProfiler::resolvedFrames()
+        [[nodiscard]] std::size_t resolvedFrames() const noexcept override;
+
+        /// \copydoc IGpuProfiler::skippedFrames()
+        [[nodiscard]] std::size_t skippedFrames() const noexcept override;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+}
@@ -37,8 +37,8 @@ namespace spark::render::vk
         [[nodiscard]] const VulkanDevice& device() const noexcept;
 
         /**
-         * \brief Gets a reference to the command pool used to allocate command buffers.
-         * \return A reference to the command pool used to allocate command buffers.
+         * \brief Gets a reference to the command pool used to allocate the primary command buffers created directly, instead of by \ref createCommandBuffer().
+         * \return A reference to the command pool used to allocate the primary command buffers created directly.
          *
          * \note The command pool exists only if the queue is bound to a device.
          */
@@ -77,14 +77,44 @@ namespace spark::render::vk
         /// \copydoc ICommandQueue::release()
         void release() const noexcept override;
 
+        /// \copydoc ICommandQueue::beginBatch()
+        void beginBatch() const noexcept override;
+
+        /**
+         * \copydoc ICommandQueue::endBatch()
+         *
+         * The batches of command buffers are handed to the GPU as an array of `VkSubmitInfo` in a single `vkQueueSubmit`, each of them signaling the
+         * timeline semaphore with its own fence.
+         */
+        std::size_t endBatch() const override;
+
+        /**
+         * \copydoc ICommandQueue::waitForQueue()
+         *
+         * \throws base::BadArgumentException If \p queue is not a \ref VulkanQueue.
+         */
+        void waitForQueue(const ICommandQueue& queue, std::size_t fence) const override;
+
         /// \copydoc ICommandQueue::waitFor()
-        void waitFor(std::size_t fence) const noexcept override;
+        void waitFor(std::size_t fence) const override;
 
         /// \copydoc ICommandQueue::currentFence()
         [[nodiscard]] std::size_t currentFence() const noexcept override;
 
-        /// \copydoc ICommandQueue::createCommandBuffer()
-        [[nodiscard]] std::shared_ptr<VulkanCommandBuffer> createCommandBuffer(bool begin_recording, bool secondary) const noexcept override;
+        /// \copydoc ICommandQueue::completedFence()
+        [[nodiscard]] std::size_t completedFence() const noexcept override;
+
+        /// \copydoc ICommandQueue::commandBufferAllocations()
+        [[nodiscard]] std::size_t commandBufferAllocations() const noexcept override;
+
+        /**
+         * \copydoc ICommandQueue::createCommandBuffer()
+         *
+         * The command buffers are recycled once they are released by their owners and by the queue, which holds the submitted ones until their fence is
+         * passed. The primary ones are allocated from transient command pools reset at once when all their command buffers came back, the secondary ones
+         * have their own command pool so that they can be recorded in parallel.
+         */
+        [[nodiscard]] std::shared_ptr<VulkanCommandBuffer> createCommandBuffer(bool begin_recording, bool secondary) const override;
 
         /**
          * \brief Submits a single command buffer and inserts a fence to wait for it.
@@ -98,6 +128,7 @@ namespace spark::render::vk
          * during a \ref waitFor(), if the awaited fence is inserted after the associated one.
          *
          * \note If any of the command buffers is currently recording, it will implicitly end the recording.
+         * \note Between \ref beginBatch() and \ref endBatch(), the submission is deferred and handed to the GPU along with the other ones.
          */
         [[nodiscard]] std::size_t submit(std::shared_ptr<const VulkanCommandBuffer> command_buffer,
                                          std::span<VkSemaphore> wait_for_semaphores,
@@ -116,6 +147,7 @@ namespace spark::render::vk
          * during a \ref waitFor(), if the awaited fence is inserted after the associated one.
          *
          * \note If any of the command buffers is currently recording, it will implicitly end the recording.
+         * \note Between \ref beginBatch() and \ref endBatch(), the submission is deferred and handed to the GPU along with the other ones.
          */
         [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<const VulkanCommandBuffer>>& command_buffers,
                                          std::span<VkSemaphore> wait_for_semaphores,
@@ -123,16 +155,16 @@ namespace spark::render::vk
                                          std::span<VkSemaphore> signal_semaphores = {}) const;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] std::size_t submit(std::shared_ptr<VulkanCommandBuffer> command_buffer) const noexcept override;
+        [[nodiscard]] std::size_t submit(std::shared_ptr<VulkanCommandBuffer> command_buffer) const override;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] std::size_t submit(std::shared_ptr<const VulkanCommandBuffer> command_buffer) const noexcept override;
+        [[nodiscard]] std::size_t submit(std::shared_ptr<const VulkanCommandBuffer> command_buffer) const override;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<const VulkanCommandBuffer>>& command_buffers) const noexcept override;
+        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<const VulkanCommandBuffer>>& command_buffers) const override;
 
         /// \copydoc ICommandQueue::submit()
-        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<VulkanCommandBuffer>>& command_buffers) const noexcept override;
+        [[nodiscard]] std::size_t submit(const std::vector<std::shared_ptr<VulkanCommandBuffer>>& command_buffers) const override;
 
     private:
         struct Impl;
@@ -17,6 +17,8 @@ namespace spark::render::vk
 
     /**
      * \brief Vulkan implementation of \ref ISwapChain.
+     *
+     * The swap chain of a headless \ref VulkanDevice is offscreen: its images are color attachments which are never presented, but can be read back.
      */
     class SPARK_RENDER_VK_EXPORT VulkanSwapChain final : public SwapChain<IVulkanImage, VulkanFrameBuffer>
     {
@@ -72,6 +74,12 @@ namespace spark::render::vk
         /// \copydoc ISwapChain::present()
         void present(const VulkanFrameBuffer& frame_buffer) const noexcept override;
 
+        /// \copydoc ISwapChain::isOffscreen()
+        [[nodiscard]] bool isOffscreen() const noexcept override;
+
+        /// \copydoc ISwapChain::readBack()
+        [[nodiscard]] std::vector<std::byte> readBack(unsigned back_buffer) const override;
+
     private:
         struct Impl;
         std::unique_ptr<Impl> m_impl;
@@ -24,7 +24,13 @@ namespace spark::render::vk
                       const bool writable,
                       const VmaAllocator& allocator,
                       const VmaAllocation& allocation)
-            : m_type(type), m_elements(elements), m_writable(writable), m_elementSize(element_size), m_alignment(alignment), m_allocator(allocator), m_allocation(allocation) {}
+            : m_type(type), m_elements(elements), m_writable(writable), m_elementSize(element_size), m_alignment(alignment), m_allocator(allocator), m_allocation(allocation)
+        {
+            // Allocations created with VMA_ALLOCATION_CREATE_MAPPED_BIT stay mapped until they are destroyed
+            VmaAllocationInfo allocation_info;
+            vmaGetAllocationInfo(m_allocator, m_allocation, &allocation_info);
+            m_mappedMemory = allocation_info.pMappedData;
+        }
 
     private:
         BufferType m_type;
@@ -33,6 +39,7 @@ namespace spark::render::vk
         std::size_t m_elementSize, m_alignment;
         VmaAllocator m_allocator;
         VmaAllocation m_allocation;
+        void* m_mappedMemory = nullptr;
     };
 
     VulkanBuffer::VulkanBuffer(const VkBuffer buffer,
@@ -108,7 +115,7 @@ namespace spark::render::vk
 
     std::size_t VulkanBuffer::size() const noexcept
     {
-        return m_impl->m_elements * m_impl->m_alignment;
+        return m_impl->m_elements * alignedElementSize();
     }
 
     std::size_t VulkanBuffer::elementSize() const noexcept
@@ -182,7 +189,11 @@ namespace spark::render::vk
         if (write)
             std::memcpy(buffer + element * aligned_size, data, size);
         else
-            std::memcpy(data, buffer + element * aligned_size, aligned_size);
+        {
+            // The memory of the readback buffers may not be coherent, the writes of the device must be made visible first
+            vmaInvalidateAllocation(m_impl->m_allocator, m_impl->m_allocation, 0, VK_WHOLE_SIZE);
+            std::memcpy(data, buffer + element * aligned_size, size);
+        }
 
         vmaUnmapMemory(m_impl->m_allocator, m_impl->m_allocation);
     }
@@ -195,4 +206,9 @@ namespace spark::render::vk
                                   this->map(mem, element_size, i++, write);
                               });
     }
+
+    void* VulkanBuffer::mappedMemory() const noexcept
+    {
+        return m_impl->m_mappedMemory;
+    }
 }
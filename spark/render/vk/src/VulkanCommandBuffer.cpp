@@ -15,6 +15,7 @@
 #include "spark/base/Exception.h"
 
 #include <optional>
+#include <utility>
 
 namespace spark::render::vk
 {
@@ -26,7 +27,7 @@ namespace spark::render::vk
         explicit Impl(const VulkanQueue& queue)
             : m_queue(queue) {}
 
-        VkCommandBuffer initialize(const bool is_primary)
+        VkCommandBuffer initialize(const bool is_primary, const VkCommandPool command_pool)
         {
             // Secondary command buffers have their own command pool.
             if (!is_primary)
@@ -34,20 +35,24 @@ namespace spark::render::vk
                 const VkCommandPoolCreateInfo pool_info = {
                     .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
                     .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-                    .queueFamilyIndex = m_queue.queueId()
+                    .queueFamilyIndex = m_queue.familyId()
                 };
 
-                VkCommandPool command_pool = {};
-                if (vkCreateCommandPool(m_queue.device().handle(), &pool_info, nullptr, &command_pool) != VK_SUCCESS)
+                if (vkCreateCommandPool(m_queue.device().handle(), &pool_info, nullptr, &m_commandPool) != VK_SUCCESS)
                     throw base::NullPointerException("Failed to create command pool");
 
-                m_commandPool = command_pool;
+                m_ownsCommandPool = true;
                 m_secondary = true;
-            }
+            } else if (command_pool != VK_NULL_HANDLE)
+            {
+                m_commandPool = command_pool;
+                m_freedWithCommandPool = true;
+            } else
+                m_commandPool = m_queue.commandPool();
 
             const VkCommandBufferAllocateInfo buffer_info = {
                 .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-                .commandPool = is_primary ? m_queue.commandPool() : m_commandPool.value(),
+                .commandPool = m_commandPool,
                 .level = is_primary ? VK_COMMAND_BUFFER_LEVEL_PRIMARY : VK_COMMAND_BUFFER_LEVEL_SECONDARY,
                 .commandBufferCount = 1
             };
@@ -59,12 +64,111 @@ namespace spark::render::vk
             return command_buffer;
         }
 
+        void copyToImage(const VkCommandBuffer command_buffer,
+                         const IVulkanBuffer& source,
+                         IVulkanImage& target,
+                         std::size_t source_offset,
+                         const std::size_t stride,
+                         const unsigned first_subresource,
+                         const unsigned subresources)
+        {
+            // A queue of another family than the graphics queue does not own the image, which it releases to the graphics queue after the copy
+            const unsigned graphics_family = m_queue.device().graphicsQueue().familyId();
+            const bool releases_ownership = m_queue.familyId() != graphics_family;
+
+            // Transition the sub-resources from their current layout to the one expected by the copy. Their previous content is discarded, so that
+            // the queue does not need to acquire them.
+            std::vector<VkImageMemoryBarrier> barriers(subresources);
+            std::ranges::generate(barriers,
+                                  [&, i = first_subresource]() mutable
+                                  {
+                                      const unsigned subresource = i++;
+                                      const auto [plane, layer, level] = target.resolveSubresource(subresource);
+
+                                      return VkImageMemoryBarrier {
+                                          .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                          .srcAccessMask = 0,
+                                          .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                          .oldLayout = releases_ownership ? VK_IMAGE_LAYOUT_UNDEFINED : conversions::to_image_layout(target.layout(subresource)),
+                                          .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                          .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                          .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                          .image = std::as_const(target).handle(),
+                                          .subresourceRange = VkImageSubresourceRange {
+                                              .aspectMask = target.aspectMask(plane),
+                                              .baseMipLevel = level,
+                                              .levelCount = 1,
+                                              .baseArrayLayer = layer,
+                                              .layerCount = 1
+                                          }
+                                      };
+                                  });
+
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, subresources, barriers.data());
+
+            std::vector<VkBufferImageCopy> copy_regions(subresources);
+            std::ranges::generate(copy_regions,
+                                  [&, i = first_subresource, offset = source_offset]() mutable
+                                  {
+                                      const auto [plane, layer, level] = target.resolveSubresource(i++);
+
+                                      const auto target_extent = target.extent(level).castTo<unsigned>();
+                                      return VkBufferImageCopy {
+                                          .bufferOffset = std::exchange(offset, offset + stride),
+                                          .bufferRowLength = 0,
+                                          .bufferImageHeight = 0,
+                                          .imageSubresource = VkImageSubresourceLayers {
+                                              .aspectMask = target.aspectMask(plane),
+                                              .mipLevel = level,
+                                              .baseArrayLayer = layer,
+                                              .layerCount = 1
+                                          },
+                                          .imageOffset = {0, 0, 0},
+                                          .imageExtent = {target_extent.x, target_extent.y, target_extent.z}
+                                      };
+                                  });
+
+            vkCmdCopyBufferToImage(command_buffer, std::as_const(source).handle(), std::as_const(target).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresources, copy_regions.data());
+
+            // Make the sub-resources readable by the shaders. Queues without shader stages only make them available, the reading queue must wait for
+            // this one. The release of the ownership is acquired by the graphics queue along with its wait for this one.
+            const bool has_shaders = (m_queue.type() & (QueueType::Graphics | QueueType::Compute)) != QueueType::None && !releases_ownership;
+            for (unsigned i = 0; i < subresources; ++i)
+            {
+                barriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barriers[i].dstAccessMask = has_shaders ? VK_ACCESS_SHADER_READ_BIT : 0;
+                barriers[i].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barriers[i].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                if (releases_ownership)
+                {
+                    barriers[i].srcQueueFamilyIndex = m_queue.familyId();
+                    barriers[i].dstQueueFamilyIndex = graphics_family;
+                    m_ownershipReleases.push_back(barriers[i]);
+                }
+                target.setLayout(first_subresource + i, ImageLayout::ShaderResource);
+            }
+
+            vkCmdPipelineBarrier(command_buffer,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 has_shaders ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                 0,
+                                 0,
+                                 nullptr,
+                                 0,
+                                 nullptr,
+                                 subresources,
+                                 barriers.data());
+        }
+
     private:
         const VulkanQueue& m_queue;
         const VulkanPipelineState* m_lastPipeline = nullptr;
         bool m_recording = false, m_secondary = false;
-        std::optional<VkCommandPool> m_commandPool;
+        VkCommandPool m_commandPool = VK_NULL_HANDLE;
+        bool m_ownsCommandPool = false, m_freedWithCommandPool = false;
         std::vector<std::shared_ptr<const IStateResource>> m_sharedResources;
+        std::vector<VkImageMemoryBarrier> m_ownershipReleases;
+        std::vector<std::optional<unsigned>> m_profileScopes;
     };
 
     VulkanCommandBuffer::VulkanCommandBuffer(const VulkanQueue& queue, const bool begin_recording, const bool is_primary)
@@ -73,7 +177,21 @@ namespace spark::render::vk
         if (!queue.isBound())
             throw base::BadArgumentException("You must bind the queue before creating a command buffer from it.");
 
-        handle() = m_impl->initialize(is_primary);
+        handle() = m_impl->initialize(is_primary, VK_NULL_HANDLE);
+
+        if (begin_recording)
+            begin();
+    }
+
+    VulkanCommandBuffer::VulkanCommandBuffer(const VulkanQueue& queue, const VkCommandPool command_pool, const bool begin_recording)
+        : Resource(VK_NULL_HANDLE), m_impl(std::make_unique<Impl>(queue))
+    {
+        if (!queue.isBound())
+            throw base::BadArgumentException("You must bind the queue before creating a command buffer from it.");
+        if (command_pool == VK_NULL_HANDLE)
+            throw base::NullPointerException("The command pool to allocate the command buffer from cannot be null.");
+
+        handle() = m_impl->initialize(true, command_pool);
 
         if (begin_recording)
             begin();
@@ -81,14 +199,13 @@ namespace spark::render::vk
 
     VulkanCommandBuffer::~VulkanCommandBuffer()
     {
-        if (!m_impl->m_commandPool.has_value())
-        {
-            vkFreeCommandBuffers(m_impl->m_queue.device().handle(), m_impl->m_queue.commandPool(), 1, &this->handle());
+        // The command buffers of a command pool owned by the queue are freed along with the pool
+        if (m_impl->m_freedWithCommandPool)
             return;
-        }
 
-        vkFreeCommandBuffers(m_impl->m_queue.device().handle(), m_impl->m_commandPool.value(), 1, &this->handle());
-        vkDestroyCommandPool(m_impl->m_queue.device().handle(), m_impl->m_commandPool.value(), nullptr);
+        vkFreeCommandBuffers(m_impl->m_queue.device().handle(), m_impl->m_commandPool, 1, &this->handle());
+        if (m_impl->m_ownsCommandPool)
+            vkDestroyCommandPool(m_impl->m_queue.device().handle(), m_impl->m_commandPool, nullptr);
     }
 
     void VulkanCommandBuffer::begin() const
@@ -102,6 +219,8 @@ namespace spark::render::vk
         if (vkBeginCommandBuffer(handle(), &begin_info) != VK_SUCCESS)
             throw base::NullPointerException("Failed to begin command buffer recording");
         m_impl->m_recording = true;
+        m_impl->m_ownershipReleases.clear();
+        m_impl->m_profileScopes.clear();
     }
 
     void VulkanCommandBuffer::begin(const VulkanRenderPass& render_pass) const
@@ -127,6 +246,8 @@ namespace spark::render::vk
         if (vkBeginCommandBuffer(handle(), &begin_info) != VK_SUCCESS)
             throw base::NullPointerException("Failed to begin command buffer recording");
         m_impl->m_recording = true;
+        m_impl->m_ownershipReleases.clear();
+        m_impl->m_profileScopes.clear();
     }
 
     void VulkanCommandBuffer::end() const
@@ -149,6 +270,24 @@ namespace spark::render::vk
         return m_impl->m_secondary;
     }
 
+    void VulkanCommandBuffer::beginProfileScope(const std::string_view name) const
+    {
+        // A command buffer can only count the pipeline statistics of one query at once, so the nested scopes only measure their time
+        const bool statistics = m_impl->m_profileScopes.empty();
+        m_impl->m_profileScopes.push_back(m_impl->m_queue.device().profiler().beginScope(handle(), name, statistics));
+    }
+
+    void VulkanCommandBuffer::endProfileScope() const
+    {
+        if (m_impl->m_profileScopes.empty())
+            throw base::BadArgumentException("Unable to end a profiling scope, since no scope is begun.");
+
+        const auto scope = m_impl->m_profileScopes.back();
+        m_impl->m_profileScopes.pop_back();
+        if (scope.has_value())
+            m_impl->m_queue.device().profiler().endScope(handle(), scope.value());
+    }
+
     void VulkanCommandBuffer::transfer(IVulkanBuffer& source, IVulkanBuffer& target, const unsigned source_element, const unsigned target_element, const unsigned elements) const
     {
         if (source.elements() < source_element + elements)
@@ -242,31 +381,7 @@ namespace spark::render::vk
                                                                   elements,
                                                                   source_element));
 
-        // TODO: Use a barrier to block the memory access during the transfer.
-
-        std::vector<VkBufferImageCopy> copy_regions(elements);
-        std::ranges::generate(copy_regions,
-                              [&, i = first_subresource]() mutable
-                              {
-                                  const auto [plane, layer, level] = target.resolveSubresource(i++);
-
-                                  const auto target_extent = target.extent().castTo<unsigned>();
-                                  return VkBufferImageCopy {
-                                      .bufferOffset = source.alignedElementSize() * source_element,
-                                      .bufferRowLength = 0,
-                                      .bufferImageHeight = 0,
-                                      .imageSubresource = VkImageSubresourceLayers {
-                                          .aspectMask = target.aspectMask(plane),
-                                          .mipLevel = level,
-                                          .baseArrayLayer = layer,
-                                          .layerCount = 1
-                                      },
-                                      .imageOffset = {0, 0, 0},
-                                      .imageExtent = {target_extent.x, target_extent.y, target_extent.z}
-                                  };
-                              });
-
-        vkCmdCopyBufferToImage(handle(), std::as_const(source).handle(), std::as_const(target).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, elements, copy_regions.data());
+        m_impl->copyToImage(handle(), source, target, source.alignedElementSize() * source_element, source.alignedElementSize(), first_subresource, elements);
     }
 
     void VulkanCommandBuffer::transfer(IVulkanImage& source,
@@ -332,6 +447,64 @@ namespace spark::render::vk
                        copy_regions.data());
     }
 
+    void VulkanCommandBuffer::copy(IVulkanBuffer& source, IVulkanBuffer& target, const std::size_t source_offset, const std::size_t target_offset, const std::size_t size) const
+    {
+        if (source.size() < source_offset + size)
+            throw base::ArgumentOutOfRangeException(std::format("The source buffer has only {0} bytes, but a copy of {1} bytes starting from byte {2} has been requested.",
+                                                                source.size(),
+                                                                size,
+                                                                source_offset));
+
+        if (target.size() < target_offset + size)
+            throw base::ArgumentOutOfRangeException(std::format("The target buffer has only {0} bytes, but a copy of {1} bytes starting from byte {2} has been requested.",
+                                                                target.size(),
+                                                                size,
+                                                                target_offset));
+
+        const VkBufferCopy copy_region = {
+            .srcOffset = source_offset,
+            .dstOffset = target_offset,
+            .size = size
+        };
+
+        vkCmdCopyBuffer(handle(), std::as_const(source).handle(), std::as_const(target).handle(), 1, &copy_region);
+    }
+
+    void VulkanCommandBuffer::copy(IVulkanBuffer& source, IVulkanImage& target, const std::size_t source_offset, const unsigned subresource) const
+    {
+        if (target.elements() <= subresource)
+            throw base::ArgumentOutOfRangeException(std::format("The target image has only {0} sub-resources, but a copy to sub-resource {1} has been requested.",
+                                                                target.elements(),
+                                                                subresource));
+
+        m_impl->copyToImage(handle(), source, target, source_offset, 0, subresource, 1);
+    }
+
+    void VulkanCommandBuffer::transferBarrier() const noexcept
+    {
+        // Queues without shader stages can only make the writes available, the queues reading them must wait for this one
+        const bool has_shaders = (m_impl->m_queue.type() & (QueueType::Graphics | QueueType::Compute)) != QueueType::None;
+        const VkMemoryBarrier barrier = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = has_shaders
+                                 ? VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT
+                                   | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT
+                                 : VK_ACCESS_TRANSFER_READ_BIT
+        };
+
+        vkCmdPipelineBarrier(handle(),
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             has_shaders ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0,
+                             1,
+                             &barrier,
+                             0,
+                             nullptr,
+                             0,
+                             nullptr);
+    }
+
     void VulkanCommandBuffer::transfer(std::shared_ptr<IVulkanBuffer> source,
                                        IVulkanBuffer& target,
                                        const unsigned source_element,
@@ -447,10 +620,41 @@ namespace spark::render::vk
         drawIndexed(index_buffer.elements(), instances, first_index, vertex_offset, first_instance);
     }
 
-    void VulkanCommandBuffer::dispatch() const noexcept
+    void VulkanCommandBuffer::drawIndexedIndirect(const IVulkanBuffer& arguments, const unsigned first_draw, const unsigned draws) const noexcept
     {
-        // TODO: Maybe use multiple threads for dispatching.
-        vkCmdDispatch(handle(), 1, 1, 1);
+        // The elements of the buffer are aligned to be bound as descriptors, so the draws are read with the aligned element size as stride
+        vkCmdDrawIndexedIndirect(handle(),
+                                 arguments.handle(),
+                                 arguments.alignedElementSize() * first_draw,
+                                 draws,
+                                 static_cast<unsigned>(arguments.alignedElementSize()));
+    }
+
+    void VulkanCommandBuffer::dispatch(const math::Vector3<unsigned>& thread_groups) const noexcept
+    {
+        vkCmdDispatch(handle(), thread_groups.x, thread_groups.y, thread_groups.z);
+    }
+
+    void VulkanCommandBuffer::dispatchBarrier() const noexcept
+    {
+        constexpr VkMemoryBarrier barrier = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_SHADER_READ_BIT
+            | VK_ACCESS_SHADER_WRITE_BIT
+        };
+
+        vkCmdPipelineBarrier(handle(),
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT
+                             | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0,
+                             1,
+                             &barrier,
+                             0,
+                             nullptr,
+                             0,
+                             nullptr);
     }
 
     void VulkanCommandBuffer::execute(const std::shared_ptr<const VulkanCommandBuffer> command_buffer) const
@@ -550,4 +754,22 @@ namespace spark::render::vk
     {
         m_impl->m_sharedResources.clear();
     }
+
+    void VulkanCommandBuffer::reset() const noexcept
+    {
+        // The command buffers allocated from a command pool of the queue are reset along with the whole pool
+        if (m_impl->m_ownsCommandPool)
+            vkResetCommandPool(m_impl->m_queue.device().handle(), m_impl->m_commandPool, 0);
+
+        m_impl->m_recording = false;
+        m_impl->m_lastPipeline = nullptr;
+        m_impl->m_sharedResources.clear();
+        m_impl->m_ownershipReleases.clear();
+        m_impl->m_profileScopes.clear();
+    }
+
+    std::span<const VkImageMemoryBarrier> VulkanCommandBuffer::ownershipReleases() const noexcept
+    {
+        return m_impl->m_ownershipReleases;
+    }
 }
@@ -0,0 +1,129 @@
+#include "spark/render/vk/VulkanComputePipeline.h"
+#include "spark/render/vk/VulkanCommandBuffer.h"
+#include "spark/render/vk/VulkanDescriptorSetLayout.h"
+#include "spark/render/vk/VulkanDevice.h"
+#include "spark/render/vk/VulkanPipelineLayout.h"
+#include "spark/render/vk/VulkanShaderModule.h"
+#include "spark/render/vk/VulkanShaderProgram.h"
+
+#include "spark/base/Exception.h"
+#include "spark/log/Logger.h"
+
+#include "spirv_reflect.h"
+#include "vulkan/vulkan.h"
+
+#include <format>
+
+namespace spark::render::vk
+{
+    struct VulkanComputePipeline::Impl
+    {
+        friend class VulkanComputePipeline;
+
+    public:
+        explicit Impl(const VulkanDevice& device, std::shared_ptr<VulkanPipelineLayout> layout, std::shared_ptr<VulkanShaderProgram> shader_program)
+            : m_device(device), m_layout(std::move(layout)), m_program(std::move(shader_program)) {}
+
+        VkPipeline initialize()
+        {
+            // A compute pipeline only runs a single compute shader
+            const auto shader_modules = m_program->shaders();
+            if (shader_modules.size() != 1 || shader_modules.front()->stage() != ShaderStage::Compute)
+                throw base::BadArgumentException(std::format("A compute pipeline needs a shader program with a single compute shader, but {} modules were given.",
+                                                             shader_modules.size()));
+            const VulkanShaderModule& shader_module = *shader_modules.front();
+
+            // Reflect the size of the thread groups from the `numthreads` attribute of the entry point
+            const auto& byte_code = shader_module.byteCode();
+            const spv_reflect::ShaderModule reflection(byte_code.size(), byte_code.c_str());
+            if (reflection.GetResult() != SPV_REFLECT_RESULT_SUCCESS)
+                throw base::UnknownException(std::format("Failed to reflect shader module {}", shader_module.fileName()));
+
+            const SpvReflectEntryPoint* entry_point = spvReflectGetEntryPoint(&reflection.GetShaderModule(), shader_module.entryPoint().c_str());
+            if (!entry_point)
+                throw base::BadArgumentException(std::format("The shader module {} has no entry point named \"{}\".", shader_module.fileName(), shader_module.entryPoint()));
+            m_threadGroupSize = {entry_point->local_size.x, entry_point->local_size.y, entry_point->local_size.z};
+
+            log::trace("Using compute shader {0} with thread groups of {1}x{2}x{3} threads...",
+                       shader_module.fileName(),
+                       m_threadGroupSize.x,
+                       m_threadGroupSize.y,
+                       m_threadGroupSize.z);
+
+            // Create pipeline
+            const VkComputePipelineCreateInfo pipeline_info = {
+                .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+                .stage = {
+                    .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                    .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+                    .module = shader_module.handle(),
+                    .pName = shader_module.entryPoint().c_str(),
+                },
+                .layout = std::as_const(*m_layout).handle(),
+                .basePipelineHandle = VK_NULL_HANDLE,
+            };
+
+            VkPipeline pipeline = VK_NULL_HANDLE;
+            if (vkCreateComputePipelines(m_device.handle(), m_device.pipelineCache(), 1, &pipeline_info, nullptr, &pipeline) != VK_SUCCESS)
+                throw base::NullPointerException("Failed to create compute pipeline.");
+            return pipeline;
+        }
+
+    private:
+        const VulkanDevice& m_device;
+
+        std::shared_ptr<VulkanPipelineLayout> m_layout;
+        std::shared_ptr<VulkanShaderProgram> m_program;
+        math::Vector3<unsigned> m_threadGroupSize;
+    };
+
+    VulkanComputePipeline::VulkanComputePipeline(const VulkanDevice& device,
+                                                 std::shared_ptr<VulkanShaderProgram> shader_program,
+                                                 std::shared_ptr<VulkanPipelineLayout> layout,
+                                                 const std::string& name)
+        : VulkanPipelineState(VK_NULL_HANDLE), m_impl(std::make_unique<Impl>(device, std::move(layout), std::move(shader_program)))
+    {
+        log::info("Creating compute pipeline \"{1}\" for layout {0}...", reinterpret_cast<void*>(m_impl->m_layout.get()), name);
+        handle() = m_impl->initialize();
+
+        if (!name.empty())
+            this->name() = name;
+    }
+
+    VulkanComputePipeline::~VulkanComputePipeline()
+    {
+        vkDestroyPipeline(m_impl->m_device.handle(), handle(), nullptr);
+    }
+
+    std::shared_ptr<const VulkanShaderProgram> VulkanComputePipeline::program() const noexcept
+    {
+        return m_impl->m_program;
+    }
+
+    std::shared_ptr<VulkanPipelineLayout> VulkanComputePipeline::layout() const noexcept
+    {
+        return m_impl->m_layout;
+    }
+
+    math::Vector3<unsigned> VulkanComputePipeline::threadGroupSize() const noexcept
+    {
+        return m_impl->m_threadGroupSize;
+    }
+
+    void VulkanComputePipeline::use(const VulkanCommandBuffer& command_buffer) const noexcept
+    {
+        vkCmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, handle());
+    }
+
+    void VulkanComputePipeline::bind(const VulkanCommandBuffer& command_buffer, const VulkanDescriptorSet& descriptor_set) const noexcept
+    {
+        vkCmdBindDescriptorSets(command_buffer.handle(),
+                                VK_PIPELINE_BIND_POINT_COMPUTE,
+                                std::as_const(*m_impl->m_layout).handle(),
+                                descriptor_set.layout().space(),
+                                1,
+                                &descriptor_set.handle(),
+                                0,
+                                nullptr);
+    }
+}
@@ -9,8 +9,20 @@
 
 #include "spark/base/Exception.h"
 
+#include <cstdint>
 #include <ranges>
 
+namespace
+{
+    /**
+     * \brief Gets the key of the image view bound to a \p descriptor of an array at \p binding, so that each element of the array keeps its own view.
+     */
+    std::uint64_t image_view_key(const unsigned binding, const unsigned descriptor)
+    {
+        return static_cast<std::uint64_t>(binding) << 32 | descriptor;
+    }
+}
+
 namespace spark::render::vk
 {
     struct VulkanDescriptorSet::Impl
@@ -24,7 +36,7 @@ namespace spark::render::vk
     private:
         const VulkanDescriptorSetLayout& m_layout;
         std::unordered_map<unsigned int, VkBufferView> m_bufferViews;
-        std::unordered_map<unsigned int, VkImageView> m_imageViews;
+        std::unordered_map<std::uint64_t, VkImageView> m_imageViews;
     };
 
     VulkanDescriptorSet::VulkanDescriptorSet(const VulkanDescriptorSetLayout& layout, const VkDescriptorSet descriptor_set)
@@ -218,10 +230,11 @@ namespace spark::render::vk
         }
 
         // Remove the image view, if there is one bound to the current descriptor.
-        if (m_impl->m_imageViews.contains(binding))
+        const std::uint64_t view_key = image_view_key(binding, descriptor);
+        if (m_impl->m_imageViews.contains(view_key))
         {
-            vkDestroyImageView(m_impl->m_layout.device().handle(), m_impl->m_imageViews[binding], nullptr);
-            m_impl->m_imageViews.erase(binding);
+            vkDestroyImageView(m_impl->m_layout.device().handle(), m_impl->m_imageViews[view_key], nullptr);
+            m_impl->m_imageViews.erase(view_key);
         }
 
         // Create a new image view
@@ -259,7 +272,7 @@ namespace spark::render::vk
         if (vkCreateImageView(m_impl->m_layout.device().handle(), &image_view_create_info, nullptr, &image_view) != VK_SUCCESS)
             throw base::NullPointerException("Failed to create image view.");
 
-        m_impl->m_imageViews[binding] = image_view;
+        m_impl->m_imageViews[view_key] = image_view;
         image_info.imageView = image_view;
 
         // Update the descriptor set
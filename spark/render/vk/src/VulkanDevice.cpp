@@ -2,6 +2,7 @@
 #include "spark/render/CommandQueue.h"
 #include "spark/render/vk/VulkanFactory.h"
 #include "spark/render/vk/VulkanGraphicsAdapter.h"
+#include "spark/render/vk/VulkanProfiler.h"
 #include "spark/render/vk/VulkanQueue.h"
 #include "spark/render/vk/VulkanSurface.h"
 #include "spark/render/DeviceState.h"
@@ -14,6 +15,10 @@
 
 #include "vulkan/vulkan.h"
 
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
 #include <ranges>
 #include <span>
 #include <vector>
@@ -98,9 +103,10 @@ namespace spark::render::vk
             // Add the requested extensions
             m_extensions.assign(extensions.begin(), extensions.end());
 
-            // Add the required extensions
+            // Add the required extensions, a headless device never presents and does not need a swap chain
             m_extensions.emplace_back(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
-            m_extensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+            if (!isHeadless())
+                m_extensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 
             // Load the queue families
             uint32_t queue_families = 0;
@@ -131,6 +137,7 @@ namespace spark::render::vk
             m_deviceState.clear();
             m_families.clear();
             m_swapChain.reset();
+            m_profiler.reset();
             m_surface.reset();
         }
 
@@ -143,7 +150,10 @@ namespace spark::render::vk
             std::ranges::transform(m_extensions, std::back_inserter(required_extensions), [](const auto& extension) { return extension.c_str(); });
 
             // Create queues
-            m_graphicsQueue = this->createQueue(QueueType::Graphics, QueuePriority::Realtime, std::as_const(*m_surface).handle());
+            if (isHeadless())
+                m_graphicsQueue = this->createQueue(QueueType::Graphics, QueuePriority::Realtime);
+            else
+                m_graphicsQueue = this->createQueue(QueueType::Graphics, QueuePriority::Realtime, std::as_const(*m_surface).handle());
             m_transferQueue = this->createQueue(QueueType::Transfer, QueuePriority::Normal);
             m_bufferQueue = this->createQueue(QueueType::Transfer, QueuePriority::Normal);
             m_computeQueue = this->createQueue(QueueType::Compute, QueuePriority::Normal);
@@ -192,11 +202,16 @@ namespace spark::render::vk
                                        return queue_info;
                                    });
 
-            // Allow geometry and tessellation shader stages
+            // Allow geometry and tessellation shader stages, and the pipeline statistics of the profiler when they are supported
+            VkPhysicalDeviceFeatures supported_features = {};
+            vkGetPhysicalDeviceFeatures(m_adapter.handle(), &supported_features);
+            m_hasPipelineStatistics = supported_features.pipelineStatisticsQuery == VK_TRUE;
+
             VkPhysicalDeviceFeatures device_features = {
                 .geometryShader = true,
                 .tessellationShader = true,
-                .samplerAnisotropy = true
+                .samplerAnisotropy = true,
+                .pipelineStatisticsQuery = m_hasPipelineStatistics
             };
 
             VkPhysicalDeviceVulkan13Features device_features_1_3 = {
@@ -256,6 +271,104 @@ namespace spark::render::vk
             return device;
         }
 
+        void createPipelineCache()
+        {
+            const VkPipelineCacheCreateInfo cache_info = {.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+            if (vkCreatePipelineCache(m_parent->handle(), &cache_info, nullptr, &m_pipelineCache) != VK_SUCCESS)
+                throw base::NullPointerException("Failed to create the pipeline cache.");
+        }
+
+        /**
+         * \brief Checks that a pipeline cache was written by the same adapter and driver, since some drivers do not reject the foreign caches.
+         * \param data The content of the cache file.
+         * \return `true` if the cache can be given to the driver, `false` otherwise.
+         */
+        [[nodiscard]] bool isPipelineCacheCompatible(const std::vector<char>& data) const
+        {
+            VkPipelineCacheHeaderVersionOne header = {};
+            if (data.size() < sizeof(header))
+                return false;
+
+            std::memcpy(&header, data.data(), sizeof(header));
+            return header.headerSize >= sizeof(header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.vendorID == m_adapter.vendorId() &&
+                   header.deviceID == m_adapter.deviceId() && lib::Uuid(header.pipelineCacheUUID) == m_adapter.pipelineCacheUuid();
+        }
+
+        void loadPipelineCache(const std::filesystem::path& directory)
+        {
+            // One file per adapter and driver, so that switching between several GPUs or drivers does not discard the cache of the others
+            m_pipelineCachePath = directory / std::format("pipelines_{:04x}_{:04x}_{}.bin", m_adapter.vendorId(), m_adapter.deviceId(), m_adapter.driverUuid().str());
+
+            std::ifstream file(m_pipelineCachePath, std::ios::in | std::ios::binary);
+            if (!file.is_open())
+            {
+                log::info("No pipeline cache found at {0}, the pipelines will be compiled.", m_pipelineCachePath.generic_string());
+                return;
+            }
+
+            const std::vector<char> data(std::istreambuf_iterator(file), std::istreambuf_iterator<char>());
+            if (!isPipelineCacheCompatible(data))
+            {
+                log::warning("The pipeline cache {0} was written by another adapter or driver, the pipelines will be compiled.", m_pipelineCachePath.generic_string());
+                return;
+            }
+
+            // Merge the loaded pipelines into the cache of the device, which may already hold the pipelines created before
+            const VkPipelineCacheCreateInfo cache_info = {
+                .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                .initialDataSize = data.size(),
+                .pInitialData = data.data()
+            };
+
+            VkPipelineCache loaded_cache = VK_NULL_HANDLE;
+            if (vkCreatePipelineCache(m_parent->handle(), &cache_info, nullptr, &loaded_cache) != VK_SUCCESS)
+            {
+                log::warning("The pipeline cache {0} is corrupted, the pipelines will be compiled.", m_pipelineCachePath.generic_string());
+                return;
+            }
+
+            const VkResult result = vkMergePipelineCaches(m_parent->handle(), m_pipelineCache, 1, &loaded_cache);
+            vkDestroyPipelineCache(m_parent->handle(), loaded_cache, nullptr);
+            if (result != VK_SUCCESS)
+                log::warning("Failed to merge the pipeline cache {0}, the pipelines will be compiled.", m_pipelineCachePath.generic_string());
+            else
+                log::info("Loaded {0} bytes of pipeline cache from {1}.", data.size(), m_pipelineCachePath.generic_string());
+        }
+
+        void savePipelineCache() const
+        {
+            if (m_pipelineCachePath.empty())
+                return;
+
+            std::size_t size = 0;
+            vkGetPipelineCacheData(m_parent->handle(), m_pipelineCache, &size, nullptr);
+            std::vector<char> data(size);
+            if (vkGetPipelineCacheData(m_parent->handle(), m_pipelineCache, &size, data.data()) != VK_SUCCESS)
+                throw base::UnknownException("Failed to read the pipeline cache.");
+            data.resize(size);
+
+            // Write the cache next to the previous one and replace it once complete, so that a crash never leaves a truncated cache
+            std::error_code error;
+            std::filesystem::create_directories(m_pipelineCachePath.parent_path(), error);
+            std::filesystem::path temporary_path = m_pipelineCachePath;
+            temporary_path += ".tmp";
+            {
+                std::ofstream file(temporary_path, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!file.is_open() || !file.write(data.data(), static_cast<std::streamsize>(data.size())))
+                    throw base::CouldNotOpenFileException(std::format("Failed to write the pipeline cache file: {}", temporary_path.generic_string()));
+            }
+
+            std::filesystem::rename(temporary_path, m_pipelineCachePath, error);
+            if (error)
+                throw base::CouldNotOpenFileException(std::format("Failed to replace the pipeline cache file {}: {}", m_pipelineCachePath.generic_string(), error.message()));
+            log::info("Saved {0} bytes of pipeline cache to {1}.", data.size(), m_pipelineCachePath.generic_string());
+        }
+
+        [[nodiscard]] bool isHeadless() const noexcept
+        {
+            return std::as_const(*m_surface).handle() == VK_NULL_HANDLE;
+        }
+
         [[nodiscard]] static bool IsFlagSet(auto val, auto flag)
         {
             return (static_cast<unsigned>(val) & static_cast<unsigned>(flag)) == static_cast<unsigned>(flag);
@@ -266,6 +379,19 @@ namespace spark::render::vk
             m_swapChain = std::make_unique<VulkanSwapChain>(*m_parent, format, frame_buffer_size, frame_buffers);
         }
 
+        void createProfiler()
+        {
+            // The timestamps written by the graphics queue measure the scopes, the profiler is disabled if it does not support them
+            uint32_t queue_families = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(m_adapter.handle(), &queue_families, nullptr);
+
+            std::vector<VkQueueFamilyProperties> family_properties(queue_families);
+            vkGetPhysicalDeviceQueueFamilyProperties(m_adapter.handle(), &queue_families, family_properties.data());
+
+            const unsigned timestamp_bits = m_adapter.limits().timestampPeriod > 0.f ? family_properties[m_graphicsQueue->familyId()].timestampValidBits : 0;
+            m_profiler = std::make_unique<VulkanProfiler>(*m_parent, timestamp_bits, m_hasPipelineStatistics);
+        }
+
         void createQueues() const
         {
             m_graphicsQueue->bind();
@@ -276,9 +402,22 @@ namespace spark::render::vk
 
         VulkanQueue* createQueue(QueueType type, const QueuePriority priority)
         {
-            const auto match = type == QueueType::Transfer
-                                   ? std::ranges::find_if(m_families, [](const auto& family) { return family.type() == QueueType::Transfer; })
-                                   : std::ranges::find_if(m_families, [&type](const auto& family) { return IsFlagSet(family.type(), type); });
+            auto match = std::ranges::find_if(m_families, [&type](const auto& family) { return IsFlagSet(family.type(), type); });
+
+            // Transfers prefer a dedicated transfer family, then any family without graphics, so that the uploads run alongside the rendering
+            if (type == QueueType::Transfer)
+            {
+                match = std::ranges::find_if(m_families, [](const auto& family) { return family.type() == QueueType::Transfer && family.active() < family.total(); });
+                if (match == m_families.end())
+                    match = std::ranges::find_if(m_families,
+                                                 [](const auto& family)
+                                                 {
+                                                     return IsFlagSet(family.type(), QueueType::Transfer) && !IsFlagSet(family.type(), QueueType::Graphics) &&
+                                                            family.active() < family.total();
+                                                 });
+                if (match == m_families.end())
+                    return nullptr;
+            }
 
             return match == m_families.end() ? nullptr : match->createQueue(*m_parent, priority);
         }
@@ -312,10 +451,15 @@ namespace spark::render::vk
         std::unique_ptr<VulkanSurface> m_surface;
         std::unique_ptr<VulkanSwapChain> m_swapChain;
         std::unique_ptr<VulkanFactory> m_factory;
+        std::unique_ptr<VulkanProfiler> m_profiler;
+        bool m_hasPipelineStatistics = false;
         VulkanQueue* m_graphicsQueue;
         VulkanQueue* m_transferQueue;
         VulkanQueue* m_bufferQueue;
         VulkanQueue* m_computeQueue;
+
+        VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+        std::filesystem::path m_pipelineCachePath;
     };
 
     VulkanDevice::VulkanDevice(const VulkanGraphicsAdapter& adapter,
@@ -352,14 +496,28 @@ namespace spark::render::vk
             log::info("Enabled validation layers: {0}", lib::join(extensions, ", "));
 
         handle() = m_impl->initialize();
+        m_impl->createPipelineCache();
         m_impl->createQueues();
+        m_impl->createProfiler();
         m_impl->m_factory = std::make_unique<VulkanFactory>(*this);
         m_impl->createSwapChain(format, frame_buffer_size, frame_buffers);
     }
 
     VulkanDevice::~VulkanDevice()
     {
+        // Keep the pipelines compiled during this run for the next one, failing to do so only slows down the next startup
+        try
+        {
+            m_impl->savePipelineCache();
+        }
+        catch (const std::exception& exception)
+        {
+            log::error("Unable to save the pipeline cache: {0}", exception.what());
+        }
+
+        const VkPipelineCache pipeline_cache = m_impl->m_pipelineCache;
         m_impl.reset();
+        vkDestroyPipelineCache(handle(), pipeline_cache, nullptr);
         vkDestroyDevice(handle(), nullptr);
     }
 
@@ -368,6 +526,11 @@ namespace spark::render::vk
         return m_impl->m_extensions;
     }
 
+    bool VulkanDevice::isHeadless() const noexcept
+    {
+        return m_impl->isHeadless();
+    }
+
     MultiSamplingLevel VulkanDevice::maximumMultiSamplingLevel(const Format format) const noexcept
     {
         const auto limits = m_impl->m_adapter.limits();
@@ -400,12 +563,32 @@ namespace spark::render::vk
         return 1000000.0 / static_cast<double>(graphicsAdapter().limits().timestampPeriod);
     }
 
+    const VulkanProfiler& VulkanDevice::profiler() const noexcept
+    {
+        return *m_impl->m_profiler;
+    }
+
     void VulkanDevice::wait() const
     {
         if (vkDeviceWaitIdle(handle()) != VK_SUCCESS)
             throw base::UnknownException("Failed to wait for device to become idle.");
     }
 
+    void VulkanDevice::loadPipelineCache(const std::filesystem::path& directory)
+    {
+        m_impl->loadPipelineCache(directory);
+    }
+
+    void VulkanDevice::savePipelineCache() const
+    {
+        m_impl->savePipelineCache();
+    }
+
+    VkPipelineCache VulkanDevice::pipelineCache() const noexcept
+    {
+        return m_impl->m_pipelineCache;
+    }
+
     DeviceState& VulkanDevice::state() noexcept
     {
         return m_impl->m_deviceState;
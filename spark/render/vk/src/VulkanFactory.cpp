@@ -86,6 +86,10 @@ namespace spark::render::vk
 
             alignment = m_impl->m_device.graphicsAdapter().limits().minTexelBufferOffsetAlignment;
             break;
+        case BufferType::Indirect:
+            usage_flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+            alignment = m_impl->m_device.graphicsAdapter().limits().minStorageBufferOffsetAlignment;
+            break;
         default:
             break;
         }
@@ -101,6 +105,7 @@ namespace spark::render::vk
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
             break;
         case BufferUsage::Resource:
+        case BufferUsage::Readback:
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             break;
         default:
@@ -116,12 +121,15 @@ namespace spark::render::vk
         {
         case BufferUsage::Staging:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
             break;
         case BufferUsage::Resource:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
             break;
         case BufferUsage::Dynamic:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
             break;
         case BufferUsage::Readback:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
@@ -172,6 +180,7 @@ namespace spark::render::vk
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
             break;
         case BufferUsage::Resource:
+        case BufferUsage::Readback:
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             break;
         default:
@@ -187,12 +196,15 @@ namespace spark::render::vk
         {
         case BufferUsage::Staging:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
             break;
         case BufferUsage::Resource:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
             break;
         case BufferUsage::Dynamic:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
             break;
         case BufferUsage::Readback:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
@@ -241,6 +253,7 @@ namespace spark::render::vk
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
             break;
         case BufferUsage::Resource:
+        case BufferUsage::Readback:
             usage_flags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             break;
         default:
@@ -256,12 +269,15 @@ namespace spark::render::vk
         {
         case BufferUsage::Staging:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
             break;
         case BufferUsage::Resource:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
             break;
         case BufferUsage::Dynamic:
             alloc_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
             break;
         case BufferUsage::Readback:
             alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
@@ -303,7 +319,8 @@ namespace spark::render::vk
         auto height = std::max(1u, size.y);
 
         unsigned queues[] = {m_impl->m_device.graphicsQueue().familyId()};
-        const VkImageUsageFlags usage = (helpers::has_depth(format) ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) |
+        // The color attachments can also be copied from, so that the offscreen swap chains built from them can be read back
+        const VkImageUsageFlags usage = (helpers::has_depth(format) ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT) |
                 VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
 
         const VkImageCreateInfo image_info = {
@@ -113,6 +113,16 @@ namespace spark::render::vk
                                });
     }
 
+    lib::Uuid VulkanGraphicsAdapter::driverUuid() const noexcept
+    {
+        return lib::Uuid(m_impl->idProperties().driverUUID);
+    }
+
+    lib::Uuid VulkanGraphicsAdapter::pipelineCacheUuid() const noexcept
+    {
+        return lib::Uuid(m_impl->properties().pipelineCacheUUID);
+    }
+
     VkPhysicalDeviceLimits VulkanGraphicsAdapter::limits() const noexcept
     {
         return m_impl->m_limits;
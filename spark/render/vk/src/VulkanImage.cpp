@@ -356,4 +356,11 @@ namespace spark::render::vk
             throw base::ArgumentOutOfRangeException(std::format("The image does not have a subresource {0}.", sub_resource));
         return m_impl->m_layouts[sub_resource];
     }
+
+    void VulkanImage::setLayout(const unsigned sub_resource, const ImageLayout layout)
+    {
+        if (sub_resource >= m_impl->m_layouts.size())
+            throw base::ArgumentOutOfRangeException(std::format("The image does not have a subresource {0}.", sub_resource));
+        m_impl->m_layouts[sub_resource] = layout;
+    }
 }
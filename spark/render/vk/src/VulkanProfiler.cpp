@@ -0,0 +1,275 @@
+#include "spark/render/vk/VulkanProfiler.h"
+#include "spark/render/vk/VulkanDevice.h"
+
+#include "spark/base/Exception.h"
+#include "spark/log/Logger.h"
+
+#include "vulkan/vulkan.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace spark::render::vk
+{
+    struct VulkanProfiler::Impl
+    {
+        friend class VulkanProfiler;
+
+        /// \brief The scopes recorded into a frame, whose queries are read once the GPU finished it.
+        struct Frame
+        {
+            std::atomic<unsigned> scopes = 0;
+            std::array<std::string, MaxScopes> names;
+            std::array<bool, MaxScopes> statistics {};
+        };
+
+    public:
+        explicit Impl(const VulkanDevice& device, const unsigned timestamp_bits, const bool pipeline_statistics)
+            : m_device(device), m_timestampBits(timestamp_bits), m_hasStatistics(pipeline_statistics)
+        {
+            if (m_timestampBits == 0)
+            {
+                log::warning("The graphics queue does not support timestamps, the GPU profiling is disabled.");
+                return;
+            }
+
+            const VkQueryPoolCreateInfo timestamp_pool_info = {
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .queryType = VK_QUERY_TYPE_TIMESTAMP,
+                .queryCount = Frames * MaxScopes * 2,
+            };
+
+            if (vkCreateQueryPool(m_device.handle(), &timestamp_pool_info, nullptr, &m_timestamps) != VK_SUCCESS)
+                throw base::NullPointerException("Failed to create the timestamp query pool.");
+            vkResetQueryPool(m_device.handle(), m_timestamps, 0, timestamp_pool_info.queryCount);
+
+            if (!m_hasStatistics)
+                return;
+
+            const VkQueryPoolCreateInfo statistics_pool_info = {
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+                .queryCount = Frames * MaxScopes,
+                .pipelineStatistics = StatisticFlags,
+            };
+
+            if (vkCreateQueryPool(m_device.handle(), &statistics_pool_info, nullptr, &m_statistics) != VK_SUCCESS)
+                throw base::NullPointerException("Failed to create the pipeline statistics query pool.");
+            vkResetQueryPool(m_device.handle(), m_statistics, 0, statistics_pool_info.queryCount);
+        }
+
+        ~Impl()
+        {
+            vkDestroyQueryPool(m_device.handle(), m_statistics, nullptr);
+            vkDestroyQueryPool(m_device.handle(), m_timestamps, nullptr);
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = delete;
+        Impl& operator=(const Impl& other) = delete;
+        Impl& operator=(Impl&& other) noexcept = delete;
+
+        [[nodiscard]] std::optional<unsigned> beginScope(const VkCommandBuffer command_buffer, const std::string_view name, const bool statistics)
+        {
+            if (!m_isFrameProfiled)
+                return std::nullopt;
+
+            // The scopes recorded by several threads get their own queries, and the frame is not profiled if it has too many of them
+            Frame& frame = m_frames[m_currentFrame];
+            const unsigned scope = frame.scopes.fetch_add(1, std::memory_order_relaxed);
+            if (scope >= MaxScopes)
+                return std::nullopt;
+
+            frame.names[scope] = name;
+            frame.statistics[scope] = statistics && m_hasStatistics;
+
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestamps, timestampQuery(m_currentFrame, scope));
+            if (frame.statistics[scope])
+                vkCmdBeginQuery(command_buffer, m_statistics, statisticsQuery(m_currentFrame, scope), 0);
+
+            // The scopes identify their frame, so that a scope still ends with the queries it began with if a frame is begun meanwhile
+            return m_currentFrame * MaxScopes + scope;
+        }
+
+        void endScope(const VkCommandBuffer command_buffer, const unsigned scope_id) const noexcept
+        {
+            const unsigned frame_index = scope_id / MaxScopes;
+            const unsigned scope = scope_id % MaxScopes;
+            if (m_frames[frame_index].statistics[scope])
+                vkCmdEndQuery(command_buffer, m_statistics, statisticsQuery(frame_index, scope));
+            vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestamps, timestampQuery(frame_index, scope) + 1);
+        }
+
+        void beginFrame()
+        {
+            if (m_timestampBits == 0)
+                return;
+
+            m_currentFrame = (m_currentFrame + 1) % Frames;
+            Frame& frame = m_frames[m_currentFrame];
+            const unsigned scopes = std::min(frame.scopes.load(std::memory_order_relaxed), MaxScopes);
+
+            // Read the results of the frame which used the queries before, or keep them if the GPU did not finish it
+            std::vector<GpuProfileSample> samples;
+            if (scopes > 0 && !readSamples(m_currentFrame, scopes, samples))
+            {
+                m_isFrameProfiled = false;
+                m_skippedFrames++;
+                return;
+            }
+
+            if (scopes > 0)
+            {
+                if (frame.scopes.load(std::memory_order_relaxed) > MaxScopes)
+                {
+                    log::warning("A frame recorded more than {0} profiling scopes, its GPU profile is discarded.", MaxScopes);
+                    m_skippedFrames++;
+                }
+                else
+                {
+                    m_results = merge_profile_samples(samples, m_device.ticksPerMillisecond(), m_timestampBits);
+                    m_resolvedFrames++;
+                }
+
+                vkResetQueryPool(m_device.handle(), m_timestamps, timestampQuery(m_currentFrame, 0), MaxScopes * 2);
+                if (m_hasStatistics)
+                    vkResetQueryPool(m_device.handle(), m_statistics, statisticsQuery(m_currentFrame, 0), MaxScopes);
+            }
+
+            frame.scopes.store(0, std::memory_order_relaxed);
+            m_isFrameProfiled = true;
+        }
+
+        /**
+         * \brief Reads the queries of the scopes of a frame, without waiting for them.
+         * \param frame_index The index of the frame.
+         * \param scopes The number of scopes of the frame.
+         * \param samples Gets a sample for each scope of the frame.
+         * \return `true` if all the queries of the frame are available, `false` otherwise.
+         */
+        [[nodiscard]] bool readSamples(const unsigned frame_index, const unsigned scopes, std::vector<GpuProfileSample>& samples) const
+        {
+            std::vector<std::uint64_t> timestamps(static_cast<std::size_t>(scopes) * 2);
+            if (vkGetQueryPoolResults(m_device.handle(),
+                                      m_timestamps,
+                                      timestampQuery(frame_index, 0),
+                                      scopes * 2,
+                                      timestamps.size() * sizeof(std::uint64_t),
+                                      timestamps.data(),
+                                      sizeof(std::uint64_t),
+                                      VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+                return false;
+
+            const Frame& frame = m_frames[frame_index];
+            samples.resize(scopes);
+            for (unsigned scope = 0; scope < scopes; ++scope)
+            {
+                GpuProfileSample& sample = samples[scope];
+                sample.name = frame.names[scope];
+                sample.beginTicks = timestamps[scope * 2];
+                sample.endTicks = timestamps[scope * 2 + 1];
+
+                // The statistics are only counted by the outermost scopes, the others leave their query unused
+                if (!frame.statistics[scope])
+                    continue;
+
+                std::array<std::uint64_t, 5> statistics {};
+                if (vkGetQueryPoolResults(m_device.handle(),
+                                          m_statistics,
+                                          statisticsQuery(frame_index, scope),
+                                          1,
+                                          sizeof(statistics),
+                                          statistics.data(),
+                                          sizeof(statistics),
+                                          VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+                    return false;
+
+                // The results are written in the order of the bits of the statistic flags
+                sample.statistics = {
+                    .inputPrimitives = statistics[0],
+                    .vertexShaderInvocations = statistics[1],
+                    .clippingPrimitives = statistics[2],
+                    .fragmentShaderInvocations = statistics[3],
+                    .computeShaderInvocations = statistics[4]
+                };
+            }
+            return true;
+        }
+
+        [[nodiscard]] static unsigned timestampQuery(const unsigned frame_index, const unsigned scope) noexcept
+        {
+            return (frame_index * MaxScopes + scope) * 2;
+        }
+
+        [[nodiscard]] static unsigned statisticsQuery(const unsigned frame_index, const unsigned scope) noexcept
+        {
+            return frame_index * MaxScopes + scope;
+        }
+
+    private:
+        static constexpr VkQueryPipelineStatisticFlags StatisticFlags = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+                                                                        VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+                                                                        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+                                                                        VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+                                                                        VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
+        const VulkanDevice& m_device;
+        unsigned m_timestampBits;
+        bool m_hasStatistics;
+        VkQueryPool m_timestamps = VK_NULL_HANDLE;
+        VkQueryPool m_statistics = VK_NULL_HANDLE;
+
+        std::array<Frame, Frames> m_frames;
+        unsigned m_currentFrame = 0;
+        bool m_isFrameProfiled = true;
+
+        std::vector<GpuProfileScope> m_results;
+        std::size_t m_resolvedFrames = 0;
+        std::size_t m_skippedFrames = 0;
+    };
+
+    VulkanProfiler::VulkanProfiler(const VulkanDevice& device, const unsigned timestamp_bits, const bool pipeline_statistics)
+        : m_impl(std::make_unique<Impl>(device, timestamp_bits, pipeline_statistics)) {}
+
+    VulkanProfiler::~VulkanProfiler() = default;
+
+    std::optional<unsigned> VulkanProfiler::beginScope(const VkCommandBuffer command_buffer, const std::string_view name, const bool statistics) const
+    {
+        if (!isEnabled())
+            return std::nullopt;
+        return m_impl->beginScope(command_buffer, name, statistics);
+    }
+
+    void VulkanProfiler::endScope(const VkCommandBuffer command_buffer, const unsigned scope) const noexcept
+    {
+        m_impl->endScope(command_buffer, scope);
+    }
+
+    bool VulkanProfiler::isEnabled() const noexcept
+    {
+        return m_impl->m_timestampBits > 0;
+    }
+
+    void VulkanProfiler::beginFrame() const
+    {
+        m_impl->beginFrame();
+    }
+
+    std::span<const GpuProfileScope> VulkanProfiler::results() const noexcept
+    {
+        return m_impl->m_results;
+    }
+
+    std::size_t VulkanProfiler::resolvedFrames() const noexcept
+    {
+        return m_impl->m_resolvedFrames;
+    }
+
+    std::size_t VulkanProfiler::skippedFrames() const noexcept
+    {
+        return m_impl->m_skippedFrames;
+    }
+}
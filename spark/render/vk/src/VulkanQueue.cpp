@@ -6,7 +6,16 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <iterator>
+#include <limits>
 #include <mutex>
+#include <span>
+#include <utility>
 
 namespace spark::render::vk
 {
@@ -14,6 +23,105 @@ namespace spark::render::vk
     {
         friend class VulkanQueue;
 
+    public:
+        /**
+         * \brief Keeps the command buffers which are not used anymore, to hand them out again instead of allocating new ones.
+         *
+         * The primary command buffers are allocated from transient command pools. A pool is reset at once, once all its command buffers came back, which
+         * only happens after the fence of their last submission is passed since the queue holds them until then. The secondary command buffers are
+         * recorded in parallel, so each keeps its own command pool, reset when it comes back.
+         *
+         * It is shared with the deleters of the command buffers, which can come back after the queue is released. They are destroyed instead.
+         */
+        struct CommandBufferRecycler
+        {
+            /// \brief The index of the pool of the secondary command buffers, which have their own command pool.
+            static constexpr std::size_t SecondaryPool = std::numeric_limits<std::size_t>::max();
+
+            struct CommandPool
+            {
+                VkCommandPool handle = VK_NULL_HANDLE;
+                std::vector<std::unique_ptr<VulkanCommandBuffer>> available;
+                std::vector<std::unique_ptr<VulkanCommandBuffer>> returned;
+                std::size_t outstanding = 0;
+            };
+
+            explicit CommandBufferRecycler(const VkDevice device)
+                : device(device) {}
+
+            void recycle(VulkanCommandBuffer* command_buffer, const std::size_t pool) noexcept
+            {
+                std::unique_ptr<VulkanCommandBuffer> recycled(command_buffer);
+                std::scoped_lock lock(mutex);
+                if (released)
+                    return;
+
+                recycled->reset();
+                if (pool == SecondaryPool)
+                    secondaries.push_back(std::move(recycled));
+                else
+                {
+                    pools[pool].returned.push_back(std::move(recycled));
+                    --pools[pool].outstanding;
+                }
+            }
+
+            void release() noexcept
+            {
+                std::scoped_lock lock(mutex);
+                released = true;
+                secondaries.clear();
+
+                // The command buffers of the pools are freed along with them
+                for (CommandPool& pool : pools)
+                {
+                    pool.available.clear();
+                    pool.returned.clear();
+                    vkDestroyCommandPool(device, pool.handle, nullptr);
+                }
+                pools.clear();
+            }
+
+            VkDevice device;
+            std::mutex mutex;
+            std::vector<CommandPool> pools;
+            std::vector<std::unique_ptr<VulkanCommandBuffer>> secondaries;
+            std::size_t current = 0, allocations = 0;
+            bool released = false;
+        };
+
+        /**
+         * \brief The submissions not handed to the GPU yet, kept in inline storage so that submitting does not allocate.
+         *
+         * The command buffers are grouped into batches, each waiting for its semaphores before its first command buffer and signaling the timeline
+         * semaphore, then its other semaphores, after its last one. A submission joins the open batch unless it waits for semaphores, and a submission
+         * signaling semaphores closes its batch.
+         */
+        struct PendingSubmits
+        {
+            static constexpr std::size_t MaxBatches = 16, MaxCommandBuffers = 64, MaxSemaphores = 32;
+
+            struct Batch
+            {
+                std::size_t fence = 0;
+                unsigned firstWait = 0, waits = 0;
+                unsigned firstCommandBuffer = 0, commandBuffers = 0;
+                unsigned firstSignal = 0, signals = 0;
+            };
+
+            std::array<Batch, MaxBatches> batches = {};
+            std::array<VkCommandBuffer, MaxCommandBuffers> commandBuffers = {};
+            std::array<VkSemaphore, MaxSemaphores> waitSemaphores = {};
+            std::array<VkPipelineStageFlags, MaxSemaphores> waitStages = {};
+            std::array<std::uint64_t, MaxSemaphores> waitValues = {};
+            std::array<VkSemaphore, MaxSemaphores> signalSemaphores = {};
+            std::array<std::uint64_t, MaxSemaphores> signalValues = {};
+            std::array<VkTimelineSemaphoreSubmitInfo, MaxBatches> timelineInfos = {};
+            std::array<VkSubmitInfo, MaxBatches> submitInfos = {};
+            unsigned batchCount = 0, commandBufferCount = 0, waitCount = 0, signalCount = 0;
+            bool isOpen = false;
+        };
+
     public:
         explicit Impl(VulkanQueue* parent, const VulkanDevice& device, const QueueType type, const QueuePriority priority, const unsigned family_id, const unsigned queue_id)
             : m_parent(parent), m_device(device), m_type(type), m_priority(priority), m_familyId(family_id), m_queueId(queue_id) {}
@@ -62,12 +170,254 @@ namespace spark::render::vk
             if (vkCreateSemaphore(m_device.handle(), &semaphore_info, nullptr, &m_timelineSemaphore) != VK_SUCCESS)
                 throw base::NullPointerException("Failed to create timeline semaphore");
 
+            m_recycler = std::make_shared<CommandBufferRecycler>(m_device.handle());
             m_isBound = true;
         }
 
+        std::shared_ptr<VulkanCommandBuffer> acquirePrimary()
+        {
+            std::scoped_lock lock(m_recycler->mutex);
+            auto& pools = m_recycler->pools;
+
+            // Once command buffers of the current pool came back, the pool is left until all of them come back, so that it can be reset at once
+            if (pools.empty() || (pools[m_recycler->current].available.empty() && !pools[m_recycler->current].returned.empty()))
+            {
+                const auto reusable = std::ranges::find_if(pools, [](const auto& pool) { return pool.outstanding == 0 && !pool.returned.empty(); });
+                if (reusable != pools.end())
+                {
+                    vkResetCommandPool(m_device.handle(), reusable->handle, 0);
+                    std::ranges::move(reusable->returned, std::back_inserter(reusable->available));
+                    reusable->returned.clear();
+                    m_recycler->current = static_cast<std::size_t>(std::distance(pools.begin(), reusable));
+                } else
+                {
+                    const VkCommandPoolCreateInfo pool_info = {
+                        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                        .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                        .queueFamilyIndex = m_familyId
+                    };
+
+                    VkCommandPool command_pool = VK_NULL_HANDLE;
+                    if (vkCreateCommandPool(m_device.handle(), &pool_info, nullptr, &command_pool) != VK_SUCCESS)
+                        throw base::NullPointerException("Failed to create command pool");
+
+                    pools.push_back({.handle = command_pool});
+                    m_recycler->current = pools.size() - 1;
+                    ++m_recycler->allocations;
+                }
+            }
+
+            auto& pool = pools[m_recycler->current];
+            std::unique_ptr<VulkanCommandBuffer> command_buffer;
+            if (!pool.available.empty())
+            {
+                command_buffer = std::move(pool.available.back());
+                pool.available.pop_back();
+            } else
+            {
+                command_buffer = std::make_unique<VulkanCommandBuffer>(*m_parent, pool.handle);
+                ++m_recycler->allocations;
+            }
+
+            ++pool.outstanding;
+            return {command_buffer.release(),
+                    [recycler = m_recycler, index = m_recycler->current](VulkanCommandBuffer* recycled) { recycler->recycle(recycled, index); }};
+        }
+
+        std::shared_ptr<VulkanCommandBuffer> acquireSecondary()
+        {
+            std::scoped_lock lock(m_recycler->mutex);
+            std::unique_ptr<VulkanCommandBuffer> command_buffer;
+            if (!m_recycler->secondaries.empty())
+            {
+                command_buffer = std::move(m_recycler->secondaries.back());
+                m_recycler->secondaries.pop_back();
+            } else
+            {
+                // A secondary command buffer allocates its command pool along with itself
+                command_buffer = std::make_unique<VulkanCommandBuffer>(*m_parent, false, false);
+                m_recycler->allocations += 2;
+            }
+
+            return {command_buffer.release(),
+                    [recycler = m_recycler](VulkanCommandBuffer* recycled) { recycler->recycle(recycled, CommandBufferRecycler::SecondaryPool); }};
+        }
+
+        /**
+         * \brief Adds \p command_buffers to the pending submissions, the queue mutex being locked.
+         * \return The fence signaled once the command buffers are executed.
+         */
+        std::size_t enqueue(const std::span<const std::shared_ptr<const VulkanCommandBuffer>> command_buffers,
+                            const std::span<VkSemaphore> wait_for_semaphores,
+                            const std::span<VkPipelineStageFlags> wait_for_stages,
+                            const std::span<VkSemaphore> signal_semaphores)
+        {
+            if (wait_for_semaphores.size() != wait_for_stages.size())
+                throw base::BadArgumentException(std::format("{0} semaphores to wait for are given for {1} pipeline stages.", wait_for_semaphores.size(), wait_for_stages.size()));
+            // The waits for the other queues are added to the semaphores of the submission, which must fit in the storage once it is flushed
+            const std::size_t waits = wait_for_semaphores.size() + m_queueWaitCount;
+            if (command_buffers.size() > PendingSubmits::MaxCommandBuffers || waits > PendingSubmits::MaxSemaphores ||
+                signal_semaphores.size() + 2 > PendingSubmits::MaxSemaphores)
+                throw base::ArgumentOutOfRangeException(std::format("A submission can hold up to {0} command buffers and {1} semaphores, including the waits for other queues.",
+                                                                    PendingSubmits::MaxCommandBuffers,
+                                                                    PendingSubmits::MaxSemaphores));
+
+            PendingSubmits& pending = m_pending;
+            const std::size_t acquire_buffers = m_ownershipAcquires.empty() ? 0 : 1;
+
+            // The waits of a batch happen before its first command buffer, so a submission waiting for semaphores starts a new batch
+            if (pending.isOpen && waits > 0)
+                closeBatch({});
+
+            // Hand the pending batches to the GPU when the storage is full. The open batch adds at most one signal when it is closed.
+            if (pending.commandBufferCount + command_buffers.size() + acquire_buffers > PendingSubmits::MaxCommandBuffers ||
+                pending.waitCount + waits > PendingSubmits::MaxSemaphores ||
+                pending.signalCount + signal_semaphores.size() + 2 > PendingSubmits::MaxSemaphores ||
+                (!pending.isOpen && pending.batchCount == PendingSubmits::MaxBatches))
+                flush();
+
+            if (!pending.isOpen)
+            {
+                pending.batches[pending.batchCount++] = {
+                    .fence = ++m_fence,
+                    .firstWait = pending.waitCount,
+                    .waits = static_cast<unsigned>(waits),
+                    .firstCommandBuffer = pending.commandBufferCount
+                };
+
+                for (std::size_t i = 0; i < wait_for_semaphores.size(); ++i, ++pending.waitCount)
+                {
+                    pending.waitSemaphores[pending.waitCount] = wait_for_semaphores[i];
+                    pending.waitStages[pending.waitCount] = wait_for_stages[i];
+                    pending.waitValues[pending.waitCount] = 0;
+                }
+
+                // The waits for the other queues are timeline semaphore waits, with the awaited fence as value
+                for (unsigned i = 0; i < m_queueWaitCount; ++i, ++pending.waitCount)
+                {
+                    pending.waitSemaphores[pending.waitCount] = m_queueWaits[i].first;
+                    pending.waitStages[pending.waitCount] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+                    pending.waitValues[pending.waitCount] = m_queueWaits[i].second;
+                }
+                m_queueWaitCount = 0;
+                pending.isOpen = true;
+            }
+
+            PendingSubmits::Batch& batch = pending.batches[pending.batchCount - 1];
+
+            // Acquire the images released by the awaited queues before the command buffers sampling them
+            if (acquire_buffers > 0)
+            {
+                const auto acquire = acquirePrimary();
+                acquire->begin();
+                vkCmdPipelineBarrier(std::as_const(*acquire).handle(),
+                                     VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                     0,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr,
+                                     static_cast<unsigned>(m_ownershipAcquires.size()),
+                                     m_ownershipAcquires.data());
+                m_ownershipAcquires.clear();
+
+                acquire->end();
+                pending.commandBuffers[pending.commandBufferCount++] = std::as_const(*acquire).handle();
+                ++batch.commandBuffers;
+                m_submittedCommandBuffers.emplace_back(batch.fence, acquire);
+            }
+
+            // End the command buffers recording, and hold them until the fence of their batch is passed. The images they release to another queue are
+            // acquired by it once it waits for this fence.
+            for (const auto& command_buffer : command_buffers)
+            {
+                command_buffer->end();
+                pending.commandBuffers[pending.commandBufferCount++] = command_buffer->handle();
+                ++batch.commandBuffers;
+                m_submittedCommandBuffers.emplace_back(batch.fence, command_buffer);
+
+                for (const VkImageMemoryBarrier& release : command_buffer->ownershipReleases())
+                    m_ownershipReleases.emplace_back(batch.fence, release);
+            }
+
+            if (!signal_semaphores.empty())
+                closeBatch(signal_semaphores);
+            return batch.fence;
+        }
+
+        void closeBatch(const std::span<VkSemaphore> signal_semaphores)
+        {
+            PendingSubmits& pending = m_pending;
+            PendingSubmits::Batch& batch = pending.batches[pending.batchCount - 1];
+            batch.firstSignal = pending.signalCount;
+            batch.signals = static_cast<unsigned>(signal_semaphores.size()) + 1;
+
+            pending.signalSemaphores[pending.signalCount] = m_timelineSemaphore;
+            pending.signalValues[pending.signalCount++] = batch.fence;
+            for (const VkSemaphore semaphore : signal_semaphores)
+            {
+                pending.signalSemaphores[pending.signalCount] = semaphore;
+                pending.signalValues[pending.signalCount++] = 0;
+            }
+            pending.isOpen = false;
+        }
+
+        /**
+         * \brief Hands the pending batches to the GPU in a single `vkQueueSubmit`, the queue mutex being locked.
+         */
+        void flush()
+        {
+            PendingSubmits& pending = m_pending;
+            if (pending.isOpen)
+                closeBatch({});
+            if (pending.batchCount == 0)
+                return;
+
+            for (unsigned i = 0; i < pending.batchCount; ++i)
+            {
+                const PendingSubmits::Batch& batch = pending.batches[i];
+                pending.timelineInfos[i] = {
+                    .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+                    .pNext = nullptr,
+                    .waitSemaphoreValueCount = batch.waits,
+                    .pWaitSemaphoreValues = pending.waitValues.data() + batch.firstWait,
+                    .signalSemaphoreValueCount = batch.signals,
+                    .pSignalSemaphoreValues = pending.signalValues.data() + batch.firstSignal
+                };
+
+                pending.submitInfos[i] = {
+                    .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                    .pNext = &pending.timelineInfos[i],
+                    .waitSemaphoreCount = batch.waits,
+                    .pWaitSemaphores = pending.waitSemaphores.data() + batch.firstWait,
+                    .pWaitDstStageMask = pending.waitStages.data() + batch.firstWait,
+                    .commandBufferCount = batch.commandBuffers,
+                    .pCommandBuffers = pending.commandBuffers.data() + batch.firstCommandBuffer,
+                    .signalSemaphoreCount = batch.signals,
+                    .pSignalSemaphores = pending.signalSemaphores.data() + batch.firstSignal
+                };
+            }
+
+            const VkResult result = vkQueueSubmit(m_parent->handle(), pending.batchCount, pending.submitInfos.data(), VK_NULL_HANDLE);
+            m_submittedFence = pending.batches[pending.batchCount - 1].fence;
+            pending.batchCount = pending.commandBufferCount = pending.waitCount = pending.signalCount = 0;
+
+            if (result != VK_SUCCESS)
+                throw base::NullPointerException("Failed to submit command buffer");
+        }
+
         void release()
         {
+            // The submitted command buffers come back to the recycler, which destroys them along with its pools
             m_submittedCommandBuffers.clear();
+            m_pending = {};
+            m_queueWaitCount = 0;
+            m_ownershipAcquires.clear();
+            m_ownershipReleases.clear();
+            if (m_recycler)
+                m_recycler->release();
+            m_recycler.reset();
 
             if (m_timelineSemaphore)
                 vkDestroySemaphore(m_device.handle(), m_timelineSemaphore, nullptr);
@@ -88,10 +438,22 @@ namespace spark::render::vk
         VkSemaphore m_timelineSemaphore = VK_NULL_HANDLE;
         VkCommandPool m_commandPool = VK_NULL_HANDLE;
 
-        std::vector<std::tuple<std::size_t, std::shared_ptr<const VulkanCommandBuffer>>> m_submittedCommandBuffers;
+        // The submitted command buffers are ordered by fence, so that they are retired from the front once their fence is passed
+        std::deque<std::pair<std::size_t, std::shared_ptr<const VulkanCommandBuffer>>> m_submittedCommandBuffers;
+        std::shared_ptr<CommandBufferRecycler> m_recycler;
+        PendingSubmits m_pending;
+
+        // The timeline waits for other queues and the ownership acquisitions added to the next submission, and the ownership releases of the
+        // submitted command buffers, ordered by fence
+        static constexpr std::size_t MaxQueueWaits = 8;
+        std::array<std::pair<VkSemaphore, std::size_t>, MaxQueueWaits> m_queueWaits = {};
+        unsigned m_queueWaitCount = 0;
+        std::vector<VkImageMemoryBarrier> m_ownershipAcquires;
+        std::deque<std::pair<std::size_t, VkImageMemoryBarrier>> m_ownershipReleases;
         std::mutex m_mutex;
 
-        std::size_t m_fence = 0;
+        std::size_t m_fence = 0, m_submittedFence = 0;
+        bool m_isBatching = false;
         unsigned m_familyId = 0;
         unsigned m_queueId = 0;
         bool m_isBound = false;
@@ -152,8 +514,66 @@ namespace spark::render::vk
         m_impl->release();
     }
 
-    void VulkanQueue::waitFor(std::size_t fence) const noexcept
+    void VulkanQueue::beginBatch() const noexcept
+    {
+        std::scoped_lock lock(m_impl->m_mutex);
+        m_impl->m_isBatching = true;
+    }
+
+    std::size_t VulkanQueue::endBatch() const
+    {
+        std::scoped_lock lock(m_impl->m_mutex);
+        m_impl->m_isBatching = false;
+        m_impl->flush();
+        return m_impl->m_fence;
+    }
+
+    void VulkanQueue::waitForQueue(const ICommandQueue& queue, const std::size_t fence) const
+    {
+        const auto* other = dynamic_cast<const VulkanQueue*>(&queue);
+        if (!other)
+            throw base::BadArgumentException("A Vulkan queue can only wait for another Vulkan queue.");
+        if (other == this)
+            return;
+
+        // The awaited work must be submitted for the wait to end, and the images it releases are acquired along with the wait
+        std::vector<VkImageMemoryBarrier> acquires;
+        {
+            std::scoped_lock lock(other->m_impl->m_mutex);
+            if (fence > other->m_impl->m_submittedFence)
+                other->m_impl->flush();
+
+            auto& releases = other->m_impl->m_ownershipReleases;
+            while (!releases.empty() && releases.front().first <= fence)
+            {
+                VkImageMemoryBarrier& acquire = acquires.emplace_back(releases.front().second);
+                acquire.srcAccessMask = 0;
+                acquire.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                releases.pop_front();
+            }
+        }
+
+        std::scoped_lock lock(m_impl->m_mutex);
+        const auto waits = std::span(m_impl->m_queueWaits).first(m_impl->m_queueWaitCount);
+        if (const auto wait = std::ranges::find(waits, other->timelineSemaphore(), &std::pair<VkSemaphore, std::size_t>::first); wait != waits.end())
+            wait->second = std::max(wait->second, fence);
+        else if (m_impl->m_queueWaitCount < Impl::MaxQueueWaits)
+            m_impl->m_queueWaits[m_impl->m_queueWaitCount++] = {other->timelineSemaphore(), fence};
+        else
+            throw base::ArgumentOutOfRangeException(std::format("A submission can wait for up to {0} other queues.", Impl::MaxQueueWaits));
+
+        m_impl->m_ownershipAcquires.insert(m_impl->m_ownershipAcquires.end(), acquires.begin(), acquires.end());
+    }
+
+    void VulkanQueue::waitFor(std::size_t fence) const
     {
+        // The deferred work must reach the GPU before waiting for it
+        {
+            std::scoped_lock lock(m_impl->m_mutex);
+            if (fence > m_impl->m_submittedFence)
+                m_impl->flush();
+        }
+
         std::size_t completed = 0;
         vkGetSemaphoreCounterValue(m_impl->m_device.handle(), m_impl->m_timelineSemaphore, &completed);
 
@@ -168,20 +588,17 @@ namespace spark::render::vk
             };
 
             vkWaitSemaphores(m_impl->m_device.handle(), &wait_info, std::numeric_limits<std::size_t>::max());
+            completed = fence;
         }
 
-        // Release all shared command buffers
-        const auto [from, to] = std::ranges::remove_if(m_impl->m_submittedCommandBuffers,
-                                                       [&completed](auto& pair)
-                                                       {
-                                                           auto& [current_fence, current_command_buffer] = pair;
-                                                           if (current_fence > completed)
-                                                               return false;
-
-                                                           current_command_buffer->releaseSharedState();
-                                                           return true;
-                                                       });
-        m_impl->m_submittedCommandBuffers.erase(from, to);
+        // Retire the command buffers from the oldest one, until the first one still in flight
+        std::scoped_lock lock(m_impl->m_mutex);
+        auto& submitted = m_impl->m_submittedCommandBuffers;
+        while (!submitted.empty() && submitted.front().first <= completed)
+        {
+            submitted.front().second->releaseSharedState();
+            submitted.pop_front();
+        }
     }
 
     std::size_t VulkanQueue::currentFence() const noexcept
@@ -189,9 +606,31 @@ namespace spark::render::vk
         return m_impl->m_fence;
     }
 
-    std::shared_ptr<VulkanCommandBuffer> VulkanQueue::createCommandBuffer(bool begin_recording, const bool secondary) const noexcept
+    std::size_t VulkanQueue::completedFence() const noexcept
+    {
+        std::size_t completed = 0;
+        vkGetSemaphoreCounterValue(m_impl->m_device.handle(), m_impl->m_timelineSemaphore, &completed);
+        return completed;
+    }
+
+    std::size_t VulkanQueue::commandBufferAllocations() const noexcept
+    {
+        if (!m_impl->m_recycler)
+            return 0;
+
+        std::scoped_lock lock(m_impl->m_recycler->mutex);
+        return m_impl->m_recycler->allocations;
+    }
+
+    std::shared_ptr<VulkanCommandBuffer> VulkanQueue::createCommandBuffer(const bool begin_recording, const bool secondary) const
     {
-        return std::make_shared<VulkanCommandBuffer>(*this, begin_recording, !secondary);
+        if (!m_impl->m_isBound)
+            return std::make_shared<VulkanCommandBuffer>(*this, begin_recording, !secondary);
+
+        auto command_buffer = secondary ? m_impl->acquireSecondary() : m_impl->acquirePrimary();
+        if (begin_recording)
+            command_buffer->begin();
+        return command_buffer;
     }
 
     std::size_t VulkanQueue::submit(std::shared_ptr<const VulkanCommandBuffer> command_buffer,
@@ -206,47 +645,9 @@ namespace spark::render::vk
             throw base::BadArgumentException("Cannot submit a secondary command buffer.");
 
         std::scoped_lock lock(m_impl->m_mutex);
-
-        // End the command buffer recording
-        command_buffer->end();
-
-        // Create an array of semaphores to signal
-        std::vector<VkSemaphore> semaphores_to_signal(signal_semaphores.size());
-        std::ranges::generate(semaphores_to_signal, [&signal_semaphores, i = 0]() mutable { return signal_semaphores[i++]; });
-        semaphores_to_signal.insert(semaphores_to_signal.begin(), m_impl->m_timelineSemaphore);
-
-        // Submit the command buffer
-        const std::size_t fence = ++m_impl->m_fence;
-        std::vector<std::size_t> wait_values(wait_for_semaphores.size(), 0);
-        std::vector<std::size_t> signal_values(semaphores_to_signal.size(), 0);
-        signal_values[0] = fence;
-
-        const VkTimelineSemaphoreSubmitInfo timeline_info = {
-            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
-            .pNext = nullptr,
-            .waitSemaphoreValueCount = static_cast<unsigned>(wait_values.size()),
-            .pWaitSemaphoreValues = wait_values.data(),
-            .signalSemaphoreValueCount = static_cast<unsigned>(signal_values.size()),
-            .pSignalSemaphoreValues = signal_values.data()
-        };
-
-        const VkSubmitInfo submit_info = {
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-            .pNext = &timeline_info,
-            .waitSemaphoreCount = static_cast<unsigned>(wait_for_semaphores.size()),
-            .pWaitSemaphores = wait_for_semaphores.data(),
-            .pWaitDstStageMask = wait_for_stages.data(),
-            .commandBufferCount = 1,
-            .pCommandBuffers = &command_buffer->handle(),
-            .signalSemaphoreCount = static_cast<unsigned>(semaphores_to_signal.size()),
-            .pSignalSemaphores = semaphores_to_signal.data()
-        };
-
-        if (vkQueueSubmit(this->handle(), 1, &submit_info, nullptr) != VK_SUCCESS)
-            throw base::NullPointerException("Failed to submit command buffer");
-
-        // Store the command buffer
-        m_impl->m_submittedCommandBuffers.emplace_back(fence, command_buffer);
+        const std::size_t fence = m_impl->enqueue({&command_buffer, 1}, wait_for_semaphores, wait_for_stages, signal_semaphores);
+        if (!m_impl->m_isBatching)
+            m_impl->flush();
         return fence;
     }
 
@@ -261,73 +662,29 @@ namespace spark::render::vk
         if (std::ranges::any_of(command_buffers, [](auto& buffer) { return buffer->isSecondary(); }))
             throw base::BadArgumentException("Cannot submit a secondary command buffer.");
 
-        std::unique_lock lock(m_impl->m_mutex);
-
-        // End the command buffers recording
-        std::vector<VkCommandBuffer> command_buffer_handles(command_buffers.size());
-        for (const auto& command_buffer : command_buffers)
-        {
-            command_buffer->end();
-            command_buffer_handles.emplace_back(command_buffer->handle());
-        }
-
-        // Create an array of semaphores to signal
-        std::vector<VkSemaphore> semaphores_to_signal(signal_semaphores.size() + 1);
-        std::ranges::generate(semaphores_to_signal, [&signal_semaphores, i = 0]() mutable { return signal_semaphores[i++]; });
-        semaphores_to_signal.insert(semaphores_to_signal.begin(), m_impl->m_timelineSemaphore);
-
-        // Submit the command buffers
-        const std::size_t fence = ++m_impl->m_fence;
-        std::vector<std::size_t> wait_for_fences(wait_for_semaphores.size(), 0);
-        std::vector<std::size_t> signal_values(semaphores_to_signal.size(), 0);
-        signal_values.front() = fence;
-
-        const VkTimelineSemaphoreSubmitInfo timeline_info = {
-            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
-            .pNext = nullptr,
-            .waitSemaphoreValueCount = static_cast<unsigned>(wait_for_stages.size()),
-            .pWaitSemaphoreValues = wait_for_fences.data(),
-            .signalSemaphoreValueCount = static_cast<unsigned>(signal_values.size()),
-            .pSignalSemaphoreValues = signal_values.data()
-        };
-
-        const VkSubmitInfo submit_info = {
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-            .pNext = &timeline_info,
-            .waitSemaphoreCount = static_cast<unsigned>(wait_for_semaphores.size()),
-            .pWaitSemaphores = wait_for_semaphores.data(),
-            .pWaitDstStageMask = wait_for_stages.data(),
-            .commandBufferCount = static_cast<unsigned>(command_buffer_handles.size()),
-            .pCommandBuffers = command_buffer_handles.data(),
-            .signalSemaphoreCount = static_cast<unsigned>(semaphores_to_signal.size()),
-            .pSignalSemaphores = semaphores_to_signal.data()
-        };
-
-        if (vkQueueSubmit(handle(), 1, &submit_info, nullptr) != VK_SUCCESS)
-            throw base::NullPointerException("Failed to submit command buffer");
-
-        // Store the command buffer
-        for (const auto& buffer : command_buffers)
-            m_impl->m_submittedCommandBuffers.emplace_back(fence, buffer);
+        std::scoped_lock lock(m_impl->m_mutex);
+        const std::size_t fence = m_impl->enqueue(command_buffers, wait_for_semaphores, wait_for_stages, signal_semaphores);
+        if (!m_impl->m_isBatching)
+            m_impl->flush();
         return fence;
     }
 
-    std::size_t VulkanQueue::submit(const std::shared_ptr<VulkanCommandBuffer> command_buffer) const noexcept
+    std::size_t VulkanQueue::submit(const std::shared_ptr<VulkanCommandBuffer> command_buffer) const
     {
         return submit(std::static_pointer_cast<const VulkanCommandBuffer>(command_buffer), {}, {}, {});
     }
 
-    std::size_t VulkanQueue::submit(const std::shared_ptr<const VulkanCommandBuffer> command_buffer) const noexcept
+    std::size_t VulkanQueue::submit(const std::shared_ptr<const VulkanCommandBuffer> command_buffer) const
     {
         return submit(command_buffer, {}, {}, {});
     }
 
-    std::size_t VulkanQueue::submit(const std::vector<std::shared_ptr<const VulkanCommandBuffer>>& command_buffers) const noexcept
+    std::size_t VulkanQueue::submit(const std::vector<std::shared_ptr<const VulkanCommandBuffer>>& command_buffers) const
     {
         return submit(command_buffers, {}, {}, {});
     }
 
-    std::size_t VulkanQueue::submit(const std::vector<std::shared_ptr<VulkanCommandBuffer>>& command_buffers) const noexcept
+    std::size_t VulkanQueue::submit(const std::vector<std::shared_ptr<VulkanCommandBuffer>>& command_buffers) const
     {
         std::vector<std::shared_ptr<const VulkanCommandBuffer>> buffers;
         buffers.reserve(command_buffers.size());
@@ -52,6 +52,9 @@ namespace spark::render::vk
             std::optional<VkAttachmentReference> depth_target, present_target;
             std::optional<VkAttachmentDescription> present_attachment;
 
+            // The offscreen images of a headless device are never presented, they are left ready to be read back instead
+            const VkImageLayout present_layout = m_device.isHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
             // Map input attachments
             std::ranges::for_each(m_inputAttachments,
                                   [&, this, i = 0](const VulkanInputAttachmentMapping& input_attachment) mutable
@@ -200,7 +203,7 @@ namespace spark::render::vk
 
                                               // If we have a multi-sampled present attachment, we also need to attach a resolve attachment for it.
                                               if (m_samples == MultiSamplingLevel::X1)
-                                                  attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                                                  attachment.finalLayout = present_layout;
                                               else
                                               {
                                                   attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
@@ -212,7 +215,7 @@ namespace spark::render::vk
                                                       .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
                                                       .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
                                                       .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                                                      .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                                                      .finalLayout = present_layout,
                                                   };
                                               }
 
@@ -269,6 +272,20 @@ namespace spark::render::vk
                 dependencies.push_back(dependency);
             }
 
+            // Make the color writes visible to the copies reading back the offscreen images
+            if (present_target.has_value() && m_device.isHeadless())
+            {
+                constexpr VkSubpassDependency dependency = {
+                    .srcSubpass = 0,
+                    .dstSubpass = VK_SUBPASS_EXTERNAL,
+                    .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                    .dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                    .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+                };
+                dependencies.push_back(dependency);
+            }
+
             // Setup render pass state
             const VkRenderPassCreateInfo render_pass_info = {
                 .sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
@@ -420,8 +437,8 @@ namespace spark::render::vk
         vkCmdExecuteCommands(std::as_const(*command_buffer).handle(), static_cast<unsigned>(secondary_command_buffers.size()), secondary_command_buffers.data());
         vkCmdEndRenderPass(std::as_const(*command_buffer).handle());
 
-        // Submit the command buffer
-        if (!this->hasPresentRenderTarget())
+        // Submit the command buffer, the frames of a headless device are not presented and have no swap chain image to wait for
+        if (!this->hasPresentRenderTarget() || m_impl->m_device.isHeadless())
             frame_buffer->lastFence() = m_impl->m_device.graphicsQueue().submit(command_buffer);
         else
         {
@@ -431,6 +448,9 @@ namespace spark::render::vk
             std::array<VkSemaphore, 1> signal_semaphores = {frame_buffer->semaphore()};
             frame_buffer->lastFence() = m_impl->m_device.graphicsQueue().submit(command_buffer, wait_for_semaphores, wait_for_stages, signal_semaphores);
 
+            // The semaphore must be signaled by submitted work before presenting, so the work deferred by a batch is handed to the GPU first
+            m_impl->m_device.graphicsQueue().endBatch();
+
             // Present the swap chain
             m_impl->m_device.swapChain().present(*frame_buffer);
         }
@@ -246,7 +246,7 @@ namespace spark::render::vk
             };
 
             VkPipeline pipeline = VK_NULL_HANDLE;
-            if (vkCreateGraphicsPipelines(m_renderPass.device().handle(), VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline) != VK_SUCCESS)
+            if (vkCreateGraphicsPipelines(m_renderPass.device().handle(), m_renderPass.device().pipelineCache(), 1, &pipeline_info, nullptr, &pipeline) != VK_SUCCESS)
                 throw base::NullPointerException("Failed to create graphics pipeline.");
             return pipeline;
         }
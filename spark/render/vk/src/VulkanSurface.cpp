@@ -21,7 +21,9 @@ namespace spark::render::vk
 
     VulkanSurface::~VulkanSurface()
     {
-        vkDestroySurfaceKHR(m_impl->m_instance, handle(), nullptr);
+        // The surfaces of headless devices have no handle, and their instance may not enable the surface extension
+        if (handle() != VK_NULL_HANDLE)
+            vkDestroySurfaceKHR(m_impl->m_instance, handle(), nullptr);
     }
 
     const VkInstance& VulkanSurface::instance() const noexcept
@@ -1,5 +1,6 @@
 #include "spark/render/vk/VulkanSwapChain.h"
 #include "spark/render/vk/Conversions.h"
+#include "spark/render/vk/VulkanCommandBuffer.h"
 #include "spark/render/vk/VulkanDevice.h"
 #include "spark/render/vk/VulkanFrameBuffer.h"
 
@@ -7,6 +8,8 @@
 #include "spark/math/Vector2.h"
 #include "spark/math/Vector3.h"
 
+#include <array>
+
 namespace spark::render::vk
 {
     struct VulkanSwapChain::Impl
@@ -15,13 +18,19 @@ namespace spark::render::vk
 
     public:
         explicit Impl(const VulkanDevice& device)
-            : m_device(device) {}
+            : m_device(device), m_offscreen(device.isHeadless()) {}
 
         void initialize(const Format format, const math::Vector2<unsigned>& render_area, const unsigned buffers)
         {
             if (format == Format::None || format == Format::Other)
                 throw base::BadArgumentException("The provided surface format is invalid");
 
+            if (m_offscreen)
+            {
+                initializeOffscreen(format, render_area, buffers);
+                return;
+            }
+
             auto adapter = m_device.graphicsAdapter().handle();
             auto surface = m_device.surface().handle();
 
@@ -153,6 +162,48 @@ namespace spark::render::vk
             m_handle = swap_chain;
         }
 
+        void initializeOffscreen(const Format format, const math::Vector2<unsigned>& render_area, const unsigned buffers)
+        {
+            if (std::ranges::find(OffscreenFormats, format) == OffscreenFormats.end())
+                throw base::BadArgumentException("The provided surface format is not supported by offscreen swap chains");
+
+            const unsigned images = std::max(1u, buffers);
+            const math::Vector2<unsigned> actual_render_area = {std::max(1u, render_area.x), std::max(1u, render_area.y)};
+
+            log::trace("Creating offscreen swap chain for device {0} {{ Images: {1}, Extent: {2}x{3} Px, Format: {4} }}...",
+                       reinterpret_cast<const void*>(&m_device),
+                       images,
+                       actual_render_area.x,
+                       actual_render_area.y,
+                       format);
+
+            // The images are plain color attachments, which are rendered to and copied from instead of being presented
+            m_presentImages.clear();
+            for (unsigned i = 0; i < images; ++i)
+                m_presentImages.push_back(m_device.factory().createAttachment(std::format("Offscreen Image {}", i), format, actual_render_area, MultiSamplingLevel::X1));
+
+            // Nothing signals the swap semaphores without presentation engine, but they are kept for the render passes asking for them
+            constexpr VkSemaphoreCreateInfo semaphore_info = {
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            };
+
+            m_swapSemaphores.resize(images);
+            std::ranges::generate(m_swapSemaphores,
+                                  [&]
+                                  {
+                                      VkSemaphore semaphore = VK_NULL_HANDLE;
+                                      if (vkCreateSemaphore(m_device.handle(), &semaphore_info, nullptr, &semaphore) != VK_SUCCESS)
+                                          throw base::NullPointerException("Failed to create swap semaphore");
+                                      return semaphore;
+                                  });
+
+            // Store state variables
+            m_renderArea = actual_render_area;
+            m_format = format;
+            m_buffers = images;
+            m_currentImage = 0;
+        }
+
         void reset(const Format format, const math::Vector2<unsigned>& render_area, const unsigned buffers)
         {
             cleanup();
@@ -161,8 +212,10 @@ namespace spark::render::vk
 
         void cleanup()
         {
-            // Destroy the swap chain
-            vkDestroySwapchainKHR(m_device.handle(), m_handle, nullptr);
+            // Destroy the swap chain, the offscreen swap chains only own their images
+            if (m_handle != VK_NULL_HANDLE)
+                vkDestroySwapchainKHR(m_device.handle(), m_handle, nullptr);
+            m_handle = VK_NULL_HANDLE;
 
             // Destroy the swap chain semaphores
             for (const auto& semaphore : m_swapSemaphores)
@@ -180,6 +233,11 @@ namespace spark::render::vk
         {
             unsigned next_image = 0;
             m_currentImage++;
+
+            // The offscreen images are used in order, the render pass waiting for the previous frame drawn to the image before reusing it
+            if (m_offscreen)
+                return m_currentImage % m_buffers;
+
             if (vkAcquireNextImageKHR(m_device.handle(), m_handle, UINT64_MAX, m_swapSemaphores[m_currentImage % m_buffers], VK_NULL_HANDLE, &next_image) != VK_SUCCESS)
                 throw base::NullPointerException("Failed to acquire next image");
             return next_image;
@@ -187,6 +245,9 @@ namespace spark::render::vk
 
         void present(const VulkanFrameBuffer& frame_buffer)
         {
+            if (m_offscreen)
+                return;
+
             // Draw the frame, if the result of the render pass it should be presented to the swap chain.
             std::array<VkSwapchainKHR, 1> swap_chains = {m_handle};
             std::array<VkSemaphore, 1> signal_semaphores = {frame_buffer.semaphore()};
@@ -207,6 +268,68 @@ namespace spark::render::vk
                 throw base::NullPointerException("Failed to present frame buffer");
         }
 
+        [[nodiscard]] std::vector<std::byte> readBack(const unsigned back_buffer) const
+        {
+            if (!m_offscreen)
+                throw base::BadArgumentException("Only the images of an offscreen swap chain can be read back.");
+            if (back_buffer >= m_buffers)
+                throw base::ArgumentOutOfRangeException(std::format("Back buffer index {} is out of range", back_buffer));
+
+            const auto& image = *m_presentImages[back_buffer];
+            const auto& queue = m_device.graphicsQueue();
+            std::vector<std::byte> texels(static_cast<std::size_t>(m_renderArea.x) * m_renderArea.y * helpers::format_size(m_format));
+            auto buffer = m_device.factory().createBuffer("Readback Buffer", BufferType::Storage, BufferUsage::Readback, texels.size(), 1, false);
+
+            // The render passes leave the image as a transfer source after the color writes, copy it and make the copy visible to the host
+            const auto command_buffer = queue.createCommandBuffer(true, false);
+            const VkBufferImageCopy copy_info = {
+                .bufferOffset = 0,
+                .bufferRowLength = 0,
+                .bufferImageHeight = 0,
+                .imageSubresource = VkImageSubresourceLayers {
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel = 0,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1
+                },
+                .imageOffset = {0, 0, 0},
+                .imageExtent = {m_renderArea.x, m_renderArea.y, 1}
+            };
+            vkCmdCopyImageToBuffer(std::as_const(*command_buffer).handle(),
+                                   image.handle(),
+                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                   std::as_const(*buffer).handle(),
+                                   1,
+                                   &copy_info);
+
+            const VkBufferMemoryBarrier host_barrier = {
+                .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .buffer = std::as_const(*buffer).handle(),
+                .offset = 0,
+                .size = VK_WHOLE_SIZE
+            };
+            vkCmdPipelineBarrier(std::as_const(*command_buffer).handle(),
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_HOST_BIT,
+                                 0,
+                                 0,
+                                 nullptr,
+                                 1,
+                                 &host_barrier,
+                                 0,
+                                 nullptr);
+            command_buffer->end();
+
+            // The copy is submitted after the frames drawn to the image, so waiting for it also waits for them
+            queue.waitFor(queue.submit(command_buffer));
+            buffer->map(texels.data(), texels.size(), 0, false);
+            return texels;
+        }
+
         [[nodiscard]] static std::vector<Format> GetSurfaceFormats(const VkPhysicalDevice adapter, const VkSurfaceKHR surface) noexcept
         {
             unsigned formats = 0;
@@ -244,7 +367,11 @@ namespace spark::render::vk
         }
 
     private:
+        /// \brief The formats of the offscreen images, which are the usual formats of the surfaces and are supported as color attachment by all devices.
+        inline static constexpr std::array OffscreenFormats = {Format::B8G8R8A8_UNORM, Format::B8G8R8A8_SRGB, Format::R8G8B8A8_UNORM, Format::R8G8B8A8_SRGB};
+
         const VulkanDevice& m_device;
+        bool m_offscreen = false;
         std::vector<std::unique_ptr<IVulkanImage>> m_presentImages;
         math::Vector2<unsigned> m_renderArea;
         Format m_format = Format::None;
@@ -288,6 +415,8 @@ namespace spark::render::vk
 
     std::vector<Format> VulkanSwapChain::surfaceFormats() const noexcept
     {
+        if (m_impl->m_offscreen)
+            return {Impl::OffscreenFormats.begin(), Impl::OffscreenFormats.end()};
         return Impl::GetSurfaceFormats(m_impl->m_device.graphicsAdapter().handle(), m_impl->m_device.surface().handle());
     }
 
@@ -320,4 +449,14 @@ namespace spark::render::vk
     {
         m_impl->present(frame_buffer);
     }
+
+    bool VulkanSwapChain::isOffscreen() const noexcept
+    {
+        return m_impl->m_offscreen;
+    }
+
+    std::vector<std::byte> VulkanSwapChain::readBack(const unsigned back_buffer) const
+    {
+        return m_impl->readBack(back_buffer);
+    }
 }